@@ -0,0 +1,89 @@
+#ifndef MANTID_API_ALGORITHMTRACER_H_
+#define MANTID_API_ALGORITHMTRACER_H_
+
+#include "MantidAPI/DllConfig.h"
+
+#include <chrono>
+#include <string>
+
+namespace Mantid {
+namespace API {
+class Algorithm;
+
+/** AlgorithmTracer : records the executions of algorithms, child algorithms
+  included, in a trace file which can be opened in the Chrome trace viewer
+  (chrome://tracing) or in Perfetto.
+
+  Tracing is enabled by setting algorithms.trace.file to the name of the file
+  to write, and stops when the setting is cleared. Each execution of an
+  algorithm is written as a complete event ("ph":"X") when it finishes, with:
+  - its start time and duration, in microseconds;
+  - the thread that ran it, numbered from 1 in the order threads first ran
+    an algorithm;
+  - whether it was a child algorithm and whether it succeeded;
+  - the peak resident memory of the process afterwards, and the change of
+    the resident memory during the execution;
+  - the memory used by each of its output workspaces.
+  Child algorithms run within their parent on the same thread, so the viewers
+  show them nested under it.
+
+  Events are appended to the file as they finish, so the file may be read
+  while the process runs, or after a crash; the viewers accept a file without
+  the closing bracket written when tracing stops.
+
+  Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+namespace AlgorithmTracer {
+
+/// True if the executions of algorithms are being traced
+MANTID_API_DLL bool isEnabled();
+/// The name of the trace file; empty if tracing is disabled
+MANTID_API_DLL std::string traceFile();
+/// Write the trace to the given file; an empty name stops tracing
+MANTID_API_DLL void setTraceFile(const std::string &fileName);
+/// Write the trace to the file named by algorithms.trace.file
+MANTID_API_DLL void setTraceFileToConfigValue();
+
+/** Span : records one execution of an algorithm, from its construction to its
+ * destruction, if tracing is enabled when it is constructed.
+ */
+class MANTID_API_DLL Span {
+public:
+  explicit Span(const Algorithm &alg);
+  ~Span();
+  Span(const Span &) = delete;
+  Span &operator=(const Span &) = delete;
+
+private:
+  /// The algorithm being traced; nullptr if tracing is disabled
+  const Algorithm *m_alg;
+  /// When the execution started
+  std::chrono::steady_clock::time_point m_start;
+  /// The resident memory of the process when the execution started
+  size_t m_startRSS;
+};
+
+} // namespace AlgorithmTracer
+} // namespace API
+} // namespace Mantid
+
+#endif /* MANTID_API_ALGORITHMTRACER_H_ */
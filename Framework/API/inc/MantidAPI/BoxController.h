@@ -9,6 +9,7 @@
 #include <nexus/NeXusFile.hpp>
 
 #include <boost/optional.hpp>
+#include <array>
 #include <numeric>
 #include <vector>
 
@@ -33,7 +34,8 @@ public:
    * @return BoxController instance
    */
   BoxController(size_t nd)
-      : nd(nd), m_maxId(0), m_SplitThreshold(1024), m_splitTopInto(boost::none),
+      : nd(nd), m_maxId(0), m_SplitThreshold(1024),
+        m_useSpaceFillingCurve(false), m_splitTopInto(boost::none),
         m_numSplit(1), m_numTopSplit(1),
         m_fileIO(boost::shared_ptr<API::IBoxControllerIO>()) {
     // TODO: Smarter ways to determine all of these values
@@ -86,6 +88,18 @@ public:
   /** @return the mutex for avoiding simultaneous assignments of box Ids. */
   inline std::mutex &getIdMutex() { return m_idMutex; }
 
+  //-----------------------------------------------------------------------------------
+  /** @return the mutex guarding one child of a grid box while events are added
+   * to the box from several threads. Children share a fixed number of
+   * mutexes, so that the mutex of a child box survives the box being split.
+   * @param gridBoxId :: ID of the grid box
+   * @param childIndex :: index of the child in the grid box
+   */
+  std::mutex &getChildMutex(size_t gridBoxId, size_t childIndex) {
+    const size_t key = gridBoxId * 1031 + childIndex;
+    return m_childMutexes[key % m_childMutexes.size()];
+  }
+
   //-----------------------------------------------------------------------------------
   /** Return true if the MDBox should split, given :
    *
@@ -106,6 +120,16 @@ public:
    */
   void setSplitThreshold(size_t threshold) { m_SplitThreshold = threshold; }
 
+  //-----------------------------------------------------------------------------------
+  /** Return true if the events of the boxes that do not split are kept sorted
+   * along a space-filling curve, and the boxes are saved in the curve order */
+  bool useSpaceFillingCurve() const { return m_useSpaceFillingCurve; }
+
+  /** Set whether to keep the events and the boxes in space-filling curve order
+   * @param use :: true to order them along the curve
+   */
+  void setUseSpaceFillingCurve(bool use) { m_useSpaceFillingCurve = use; }
+
   //-----------------------------------------------------------------------------------
   /** Return into how many to split along a dimension
    *
@@ -441,6 +465,9 @@ private:
   /// Splitting threshold
   size_t m_SplitThreshold;
 
+  /// Order events in boxes and boxes in the file along a space-filling curve
+  bool m_useSpaceFillingCurve;
+
   /// This empirically-determined number of events takes a noticeable time to
   /// process and triggers box splitting.
   size_t m_significantEventsNumber;
@@ -496,6 +523,9 @@ private:
   /// Mutex for getting IDs
   std::mutex m_idMutex;
 
+  /// Mutexes for adding events to the children of grid boxes concurrently
+  std::array<std::mutex, 256> m_childMutexes;
+
   // the class which does actual IO operations, including MRU support list
   boost::shared_ptr<IBoxControllerIO> m_fileIO;
 
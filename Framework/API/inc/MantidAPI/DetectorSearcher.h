@@ -3,8 +3,9 @@
 
 #include "MantidAPI/DllConfig.h"
 #include "MantidGeometry/Instrument.h"
+#include "MantidGeometry/Instrument/ComponentInfo.h"
 #include "MantidGeometry/Instrument/DetectorInfo.h"
-#include "MantidGeometry/Objects/InstrumentRayTracer.h"
+#include "MantidGeometry/Objects/DetectorBVH.h"
 #include "MantidKernel/NearestNeighbours.h"
 #include "MantidKernel/V3D.h"
 
@@ -17,8 +18,8 @@
   This class solves the problem of finding a detector given a Qlab vector. Two
   search strategies are used depending on the instrument's geometry.
 
-  1) For rectangular detector geometries the InstrumentRayTracer class is used
-  to recursively search the instrument tree.
+  1) For rectangular detector geometries a DetectorBVH is used to find the
+  first detector hit by a ray from the sample.
 
   2) For geometries which do not use rectangular detectors ray tracing to every
   component is very expensive. In this case it is quicker to use a
@@ -60,6 +61,7 @@ public:
 
   /// Create a new DetectorSearcher with the given instrument & detectors
   DetectorSearcher(Geometry::Instrument_const_sptr instrument,
+                   const Geometry::ComponentInfo &compInfo,
                    const Geometry::DetectorInfo &detInfo);
   /// Find a detector that intsects with the given Qlab vector
   DetectorSearchResult findDetectorIndex(const Kernel::V3D &q);
@@ -86,7 +88,7 @@ private:
 
   // Instance variables
 
-  /// flag for whether to use InstrumentRayTracer or NearestNeighbours
+  /// flag for whether to use DetectorBVH or NearestNeighbours
   const bool m_usingFullRayTrace;
   /// flag for whether the crystallography convention is to be used
   const double m_crystallography_convention;
@@ -98,8 +100,8 @@ private:
   std::vector<size_t> m_indexMap;
   /// Detector search cache for fast look-up of detectors
   std::unique_ptr<Kernel::NearestNeighbours<3>> m_detectorCacheSearch;
-  /// instrument ray tracer object for searching in rectangular detectors
-  std::unique_ptr<Geometry::InstrumentRayTracer> m_rayTracer;
+  /// bounding volume hierarchy for searching in rectangular detectors
+  std::unique_ptr<Geometry::DetectorBVH> m_detectorBVH;
 };
 }
 }
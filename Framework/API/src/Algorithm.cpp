@@ -2,6 +2,7 @@
 #include "MantidAPI/AlgorithmHistory.h"
 #include "MantidAPI/AlgorithmManager.h"
 #include "MantidAPI/AlgorithmProxy.h"
+#include "MantidAPI/AlgorithmTracer.h"
 #include "MantidAPI/AnalysisDataService.h"
 #include "MantidAPI/DeprecatedAlgorithm.h"
 #include "MantidAPI/IWorkspaceProperty.h"
@@ -13,6 +14,7 @@
 #include "MantidKernel/EmptyValues.h"
 #include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/Strings.h"
+#include "MantidKernel/TaskRuntime.h"
 #include "MantidKernel/Timer.h"
 #include "MantidKernel/UsageService.h"
 
@@ -557,9 +559,14 @@ bool Algorithm::execute() {
         m_running = true;
       }
 
+      // OpenMP thread counts are per thread; apply the framework-wide limit
+      // to the thread running this algorithm
+      TaskRuntime::applyToCurrentThread();
       startTime = Mantid::Types::Core::DateAndTime::getCurrentTime();
       // Start a timer
       Timer timer;
+      // Record the execution if algorithms are being traced
+      AlgorithmTracer::Span traceSpan(*this);
       // Call the concrete algorithm's exec method
       this->exec(getExecutionMode());
       registerFeatureUsage();
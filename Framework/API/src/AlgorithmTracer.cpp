@@ -0,0 +1,232 @@
+#include "MantidAPI/AlgorithmTracer.h"
+#include "MantidAPI/Algorithm.h"
+#include "MantidAPI/IWorkspaceProperty.h"
+#include "MantidAPI/Workspace.h"
+#include "MantidKernel/ConfigService.h"
+#include "MantidKernel/Logger.h"
+#include "MantidKernel/Memory.h"
+
+#include <Poco/NObserver.h>
+#include <Poco/Process.h>
+
+#include <json/json.h>
+
+#include <atomic>
+#include <exception>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+using namespace Mantid::Kernel;
+
+namespace Mantid {
+namespace API {
+namespace AlgorithmTracer {
+
+namespace {
+/// static logger
+Logger g_log("AlgorithmTracer");
+
+/// The setting naming the trace file
+const std::string TRACE_FILE_KEY("algorithms.trace.file");
+
+/// An open trace file
+struct Trace {
+  explicit Trace(const std::string &name)
+      : fileName(name), file(name.c_str(), std::ios::out | std::ios::trunc),
+        epoch(std::chrono::steady_clock::now()) {}
+  /// Close the JSON array of the events
+  ~Trace() { file << (firstEvent ? "[\n" : "\n") << "]\n"; }
+
+  /// Write an event, one line per event
+  void write(const ::Json::Value &event) {
+    ::Json::FastWriter writer;
+    std::string line = writer.write(event);
+    // FastWriter ends the text with a newline; the separator goes after it
+    if (!line.empty() && line.back() == '\n')
+      line.pop_back();
+    file << (firstEvent ? "[\n" : ",\n") << line;
+    file.flush();
+    firstEvent = false;
+  }
+
+  /// @return the number of the thread, counting from 1
+  int threadNumber(std::thread::id id) {
+    auto inserted = threads.emplace(id, static_cast<int>(threads.size()) + 1);
+    return inserted.first->second;
+  }
+
+  std::string fileName;
+  std::ofstream file;
+  bool firstEvent = true;
+  /// Time 0 of the events
+  std::chrono::steady_clock::time_point epoch;
+  /// Numbers given to the threads which have run algorithms
+  std::map<std::thread::id, int> threads;
+};
+
+/// True if a trace is being written; read without taking the lock
+std::atomic<bool> g_enabled{false};
+/// Serialises writing the trace and changing the file
+std::mutex g_traceMutex;
+/// The trace being written, if any
+std::unique_ptr<Trace> g_trace;
+
+/// @return statistics giving the memory used by the process
+const MemoryStats &memoryStats() {
+  // Only the process statistics are used, which are not cached
+  static const MemoryStats stats(MEMORY_STATS_IGNORE_SYSTEM);
+  return stats;
+}
+
+/// Start writing a new trace, closing the one being written if any
+void openTrace(const std::string &fileName) {
+  std::lock_guard<std::mutex> lock(g_traceMutex);
+  if (g_trace && g_trace->fileName == fileName)
+    return;
+  g_enabled = false;
+  g_trace.reset();
+  if (fileName.empty())
+    return;
+  std::unique_ptr<Trace> trace(new Trace(fileName));
+  if (!trace->file) {
+    g_log.warning() << "Cannot open the algorithm trace file " << fileName
+                    << "; algorithms are not traced.\n";
+    return;
+  }
+  g_log.notice() << "Writing a trace of algorithm executions to " << fileName
+                 << "\n";
+  g_trace = std::move(trace);
+  g_enabled = true;
+}
+
+/// Keeps the trace file in step with the algorithms.trace.file setting
+class ConfigListener {
+public:
+  ConfigListener() : m_observer(*this, &ConfigListener::handleConfigChange) {
+    ConfigService::Instance().addObserver(m_observer);
+  }
+
+private:
+  void handleConfigChange(ConfigValChangeNotification_ptr notification) {
+    if (notification->key() == TRACE_FILE_KEY)
+      setTraceFileToConfigValue();
+  }
+
+  Poco::NObserver<ConfigListener, ConfigValChangeNotification> m_observer;
+};
+
+/// Set the file from the configuration and start following it
+void initialize() {
+  static std::once_flag once;
+  std::call_once(once, []() {
+    openTrace(ConfigService::Instance().getString(TRACE_FILE_KEY));
+    // Deliberately never deleted: it may outlive the ConfigService
+    new ConfigListener;
+  });
+}
+
+/// @return the output workspaces of an algorithm with their memory use
+::Json::Value outputWorkspaceBytes(const Algorithm &alg) {
+  ::Json::Value bytes(::Json::objectValue);
+  for (const auto prop : alg.getProperties()) {
+    if (prop->direction() == Direction::Input)
+      continue;
+    const auto wsProp = dynamic_cast<const IWorkspaceProperty *>(prop);
+    if (!wsProp)
+      continue;
+    if (const auto ws = wsProp->getWorkspace())
+      bytes[prop->name()] = static_cast<::Json::UInt64>(ws->getMemorySize());
+  }
+  return bytes;
+}
+} // namespace
+
+/// @return true if the executions of algorithms are being traced
+bool isEnabled() {
+  initialize();
+  return g_enabled.load(std::memory_order_relaxed);
+}
+
+/// @return the name of the trace file; empty if tracing is disabled
+std::string traceFile() {
+  initialize();
+  std::lock_guard<std::mutex> lock(g_traceMutex);
+  return g_trace ? g_trace->fileName : std::string();
+}
+
+/** Start writing a new trace, closing the one being written if any. The
+ * setting is followed again when it next changes.
+ * @param fileName :: the file to write; an empty name stops tracing
+ */
+void setTraceFile(const std::string &fileName) {
+  initialize();
+  openTrace(fileName);
+}
+
+/// Set the trace file from the algorithms.trace.file setting
+void setTraceFileToConfigValue() {
+  initialize();
+  openTrace(ConfigService::Instance().getString(TRACE_FILE_KEY));
+}
+
+/** Start recording an execution if tracing is enabled
+ * @param alg :: the algorithm being executed
+ */
+Span::Span(const Algorithm &alg)
+    : m_alg(isEnabled() ? &alg : nullptr), m_startRSS(0) {
+  if (!m_alg)
+    return;
+  m_startRSS = memoryStats().getCurrentRSS();
+  m_start = std::chrono::steady_clock::now();
+}
+
+/// Write the event of the execution to the trace
+Span::~Span() {
+  if (!m_alg)
+    return;
+  try {
+    const auto end = std::chrono::steady_clock::now();
+    // An exception leaving exec() unwinds through the span
+    const bool succeeded = m_alg->isExecuted() && !std::uncaught_exception();
+    const auto &stats = memoryStats();
+    const auto endRSS = static_cast<::Json::Int64>(stats.getCurrentRSS());
+
+    ::Json::Value args;
+    args["version"] = m_alg->version();
+    args["succeeded"] = succeeded;
+    args["peakRSSBytes"] = static_cast<::Json::UInt64>(stats.getPeakRSS());
+    args["changeOfRSSBytes"] =
+        endRSS - static_cast<::Json::Int64>(m_startRSS);
+    args["outputWorkspaceBytes"] = outputWorkspaceBytes(*m_alg);
+
+    ::Json::Value event;
+    event["name"] = m_alg->name();
+    event["cat"] = m_alg->isChild() ? "child algorithm" : "algorithm";
+    event["ph"] = "X";
+    event["pid"] = static_cast<::Json::Int64>(Poco::Process::id());
+    event["args"] = args;
+
+    using Microseconds = std::chrono::duration<double, std::micro>;
+    std::lock_guard<std::mutex> lock(g_traceMutex);
+    // Tracing may have stopped during the execution
+    if (!g_trace)
+      return;
+    event["ts"] = Microseconds(m_start - g_trace->epoch).count();
+    event["dur"] = Microseconds(end - m_start).count();
+    event["tid"] = g_trace->threadNumber(std::this_thread::get_id());
+    g_trace->write(event);
+  } catch (std::exception &ex) {
+    g_log.warning() << "Cannot trace the execution of " << m_alg->name()
+                    << ": " << ex.what() << "\n";
+  } catch (...) {
+    g_log.warning() << "Cannot trace the execution of " << m_alg->name()
+                    << "\n";
+  }
+}
+
+} // namespace AlgorithmTracer
+} // namespace API
+} // namespace Mantid
@@ -37,6 +37,7 @@ BoxController *BoxController::clone() const {
 BoxController::BoxController(const BoxController &other)
     : nd(other.nd), m_maxId(other.m_maxId),
       m_SplitThreshold(other.m_SplitThreshold),
+      m_useSpaceFillingCurve(other.m_useSpaceFillingCurve),
       m_significantEventsNumber(other.m_significantEventsNumber),
       m_maxDepth(other.m_maxDepth), m_numEventsAtMax(other.m_numEventsAtMax),
       m_splitInto(other.m_splitInto), m_splitTopInto(other.m_splitTopInto),
@@ -51,6 +52,7 @@ BoxController::BoxController(const BoxController &other)
 bool BoxController::operator==(const BoxController &other) const {
   if (nd != other.nd || m_maxId != other.m_maxId ||
       m_SplitThreshold != other.m_SplitThreshold ||
+      m_useSpaceFillingCurve != other.m_useSpaceFillingCurve ||
       m_maxDepth != other.m_maxDepth || m_numSplit != other.m_numSplit ||
       m_splitInto.size() != other.m_splitInto.size() ||
       m_numMDBoxes.size() != other.m_numMDBoxes.size() ||
@@ -154,6 +156,11 @@ std::string BoxController::toXMLString() const {
   element->appendChild(text);
   pBoxElement->appendChild(element);
 
+  element = pDoc->createElement("SpaceFillingCurve");
+  text = pDoc->createTextNode(this->useSpaceFillingCurve() ? "1" : "0");
+  element->appendChild(text);
+  pBoxElement->appendChild(element);
+
   element = pDoc->createElement("MaxDepth");
   text = pDoc->createTextNode(
       boost::str(boost::format("%d") % this->getMaxDepth()));
@@ -239,6 +246,13 @@ void BoxController::fromXMLString(const std::string &xml) {
   Strings::convert(pBoxElement->getChildElement("SplitThreshold")->innerText(),
                    ival);
   this->setSplitThreshold(ival);
+  // Box controllers saved before the SpaceFillingCurve element was added keep
+  // their events in insertion order
+  Poco::AutoPtr<NodeList> curveNodes =
+      pBoxElement->getElementsByTagName("SpaceFillingCurve");
+  this->setUseSpaceFillingCurve(
+      curveNodes->length() > 0 &&
+      pBoxElement->getChildElement("SpaceFillingCurve")->innerText() == "1");
   Strings::convert(pBoxElement->getChildElement("MaxDepth")->innerText(), ival);
   this->setMaxDepth(ival);
 
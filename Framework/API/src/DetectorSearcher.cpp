@@ -1,12 +1,14 @@
 #include "MantidAPI/DetectorSearcher.h"
 #include "MantidGeometry/Instrument/ReferenceFrame.h"
+#include "MantidGeometry/Objects/BoundingBox.h"
+#include "MantidGeometry/Objects/Track.h"
 #include "MantidKernel/ConfigService.h"
 #include "MantidKernel/NearestNeighbours.h"
 
 #include <tuple>
 
 using Mantid::Kernel::V3D;
-using Mantid::Geometry::InstrumentRayTracer;
+using Mantid::Geometry::DetectorBVH;
 using namespace Mantid;
 using namespace Mantid::API;
 
@@ -22,9 +24,11 @@ double getQSign() {
  * given instrument geometry
  *
  * @param instrument :: the instrument to find detectors in
+ * @param compInfo :: the Geometry::ComponentInfo object for this instrument
  * @param detInfo :: the Geometry::DetectorInfo object for this instrument
  */
 DetectorSearcher::DetectorSearcher(Geometry::Instrument_const_sptr instrument,
+                                   const Geometry::ComponentInfo &compInfo,
                                    const Geometry::DetectorInfo &detInfo)
     : m_usingFullRayTrace(instrument->containsRectDetectors() ==
                           Geometry::Instrument::ContainsState::Full),
@@ -33,9 +37,8 @@ DetectorSearcher::DetectorSearcher(Geometry::Instrument_const_sptr instrument,
 
   /* Choose the search strategy to use
    * If the instrument uses rectangular detectors (e.g. TOPAZ) then it is faster
-   * to run a full ray trace starting from the top of the instrument. This is
-   * due to the speed up of looking up a single pixel in the rectangular
-   * detector.
+   * to run a full ray trace through a bounding volume hierarchy of all the
+   * detectors.
    *
    * If the instrument does not use rectangular detectors (e.g. WISH, CORELLI)
    * then it is faster to use a nearest neighbour search to find the closest
@@ -44,7 +47,7 @@ DetectorSearcher::DetectorSearcher(Geometry::Instrument_const_sptr instrument,
   if (!m_usingFullRayTrace) {
     createDetectorCache();
   } else {
-    m_rayTracer = Kernel::make_unique<InstrumentRayTracer>(instrument);
+    m_detectorBVH = Kernel::make_unique<DetectorBVH>(compInfo, detInfo);
   }
 }
 
@@ -118,18 +121,13 @@ DetectorSearcher::findDetectorIndex(const V3D &q) {
 DetectorSearcher::DetectorSearchResult
 DetectorSearcher::searchUsingInstrumentRayTracing(const V3D &q) {
   const auto direction = convertQtoDirection(q);
-  m_rayTracer->traceFromSample(direction);
-  const auto det = m_rayTracer->getDetectorResult();
+  // Monitors are not in the hierarchy
+  const auto hit = m_detectorBVH->trace(m_detInfo.samplePosition(), direction);
 
-  if (!det)
+  if (!hit.found || m_detInfo.isMasked(hit.detectorIndex))
     return std::make_tuple(false, 0);
 
-  const auto detIndex = m_detInfo.indexOf(det->getID());
-
-  if (m_detInfo.isMasked(detIndex) || m_detInfo.isMonitor(detIndex))
-    return std::make_tuple(false, 0);
-
-  return std::make_tuple(true, detIndex);
+  return std::make_tuple(true, hit.detectorIndex);
 }
 
 /** Find the index of a detector given a vector in Qlab space using a nearest
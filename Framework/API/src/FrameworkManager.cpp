@@ -9,6 +9,7 @@
 #include "MantidKernel/Memory.h"
 #include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/PropertyManagerDataService.h"
+#include "MantidKernel/TaskRuntime.h"
 #include "MantidKernel/UsageService.h"
 
 #include <nexus/NeXusFile.hpp>
@@ -232,21 +233,15 @@ void FrameworkManagerImpl::disableNexusOutput() {
  */
 void FrameworkManagerImpl::setNumOMPThreadsToConfigValue() {
   // Set the number of threads to use for this process
-  int maxCores(0);
-  int retVal = Kernel::ConfigService::Instance().getValue(
-      "MultiThreaded.MaxCores", maxCores);
-  if (retVal > 0 && maxCores > 0) {
-    setNumOMPThreads(maxCores);
-  }
+  Kernel::TaskRuntime::setMaxThreadsToConfigValue();
 }
 
 /**
- * Set the number of OpenMP cores to use based on the config value
+ * Set the number of cores to use by OpenMP, TBB and new thread pools
  * @param nthreads :: The maximum number of threads to use
  */
 void FrameworkManagerImpl::setNumOMPThreads(const int nthreads) {
-  g_log.debug() << "Setting maximum number of threads to " << nthreads << "\n";
-  PARALLEL_SET_NUM_THREADS(nthreads);
+  Kernel::TaskRuntime::setMaxThreads(nthreads);
 }
 
 /**
@@ -0,0 +1,178 @@
+#ifndef MANTID_API_ALGORITHMTRACERTEST_H_
+#define MANTID_API_ALGORITHMTRACERTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidAPI/Algorithm.h"
+#include "MantidAPI/AlgorithmTracer.h"
+#include "MantidAPI/WorkspaceProperty.h"
+#include "MantidKernel/ConfigService.h"
+#include "MantidTestHelpers/FakeObjects.h"
+
+#include <Poco/File.h>
+#include <json/json.h>
+
+#include <fstream>
+
+using namespace Mantid::API;
+using namespace Mantid::Kernel;
+
+namespace {
+/// Creates a small workspace
+class TracerChildAlgorithm : public Algorithm {
+public:
+  const std::string name() const override { return "TracerChildAlgorithm"; }
+  int version() const override { return 1; }
+  const std::string category() const override { return "Cat"; }
+  const std::string summary() const override { return "Test summary"; }
+
+  void init() override {
+    declareProperty(make_unique<WorkspaceProperty<>>("OutputWorkspace", "",
+                                                     Direction::Output));
+  }
+  void exec() override {
+    auto ws = boost::make_shared<WorkspaceTester>();
+    ws->initialize(2, 11, 10);
+    setProperty("OutputWorkspace", MatrixWorkspace_sptr(ws));
+  }
+};
+
+/// Runs TracerChildAlgorithm, or fails if asked to
+class TracerParentAlgorithm : public Algorithm {
+public:
+  const std::string name() const override { return "TracerParentAlgorithm"; }
+  int version() const override { return 2; }
+  const std::string category() const override { return "Cat"; }
+  const std::string summary() const override { return "Test summary"; }
+
+  void init() override { declareProperty("Fail", false); }
+  void exec() override {
+    if (getProperty("Fail"))
+      throw std::runtime_error("Failed as asked");
+    TracerChildAlgorithm child;
+    child.initialize();
+    child.setChild(true);
+    child.setPropertyValue("OutputWorkspace", "unused");
+    child.execute();
+  }
+};
+} // namespace
+
+class AlgorithmTracerTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static AlgorithmTracerTest *createSuite() {
+    return new AlgorithmTracerTest();
+  }
+  static void destroySuite(AlgorithmTracerTest *suite) { delete suite; }
+
+  AlgorithmTracerTest()
+      : m_fileName(ConfigService::Instance().getTempDir() +
+                   "/AlgorithmTracerTest.json") {}
+
+  void tearDown() override {
+    AlgorithmTracer::setTraceFile("");
+    Poco::File file(m_fileName);
+    if (file.exists())
+      file.remove();
+  }
+
+  void test_tracing_is_disabled_by_default() {
+    TS_ASSERT(!AlgorithmTracer::isEnabled());
+    TS_ASSERT(AlgorithmTracer::traceFile().empty());
+  }
+
+  void test_tracing_follows_the_setting() {
+    auto &config = ConfigService::Instance();
+    config.setString("algorithms.trace.file", m_fileName);
+    TS_ASSERT(AlgorithmTracer::isEnabled());
+    TS_ASSERT_EQUALS(AlgorithmTracer::traceFile(), m_fileName);
+    config.setString("algorithms.trace.file", "");
+    TS_ASSERT(!AlgorithmTracer::isEnabled());
+  }
+
+  void test_nothing_is_written_when_disabled() {
+    TracerParentAlgorithm alg;
+    alg.initialize();
+    alg.execute();
+    TS_ASSERT(!Poco::File(m_fileName).exists());
+  }
+
+  void test_empty_trace_is_valid() {
+    AlgorithmTracer::setTraceFile(m_fileName);
+    AlgorithmTracer::setTraceFile("");
+    const auto events = readTrace();
+    TS_ASSERT(events.isArray());
+    TS_ASSERT_EQUALS(events.size(), 0);
+  }
+
+  void test_child_is_nested_in_parent() {
+    AlgorithmTracer::setTraceFile(m_fileName);
+    TracerParentAlgorithm alg;
+    alg.initialize();
+    TS_ASSERT(alg.execute());
+    AlgorithmTracer::setTraceFile("");
+
+    const auto events = readTrace();
+    TS_ASSERT_EQUALS(events.size(), 2);
+    if (events.size() != 2)
+      return;
+    // Events are written as the executions finish
+    const auto &child = events[0];
+    const auto &parent = events[1];
+    TS_ASSERT_EQUALS(child["name"].asString(), "TracerChildAlgorithm");
+    TS_ASSERT_EQUALS(child["cat"].asString(), "child algorithm");
+    TS_ASSERT_EQUALS(parent["name"].asString(), "TracerParentAlgorithm");
+    TS_ASSERT_EQUALS(parent["cat"].asString(), "algorithm");
+    for (const auto *event : {&child, &parent}) {
+      TS_ASSERT_EQUALS((*event)["ph"].asString(), "X");
+      TS_ASSERT_EQUALS((*event)["tid"].asInt(), 1);
+      TS_ASSERT((*event)["args"]["succeeded"].asBool());
+      TS_ASSERT_LESS_THAN(0, (*event)["args"]["peakRSSBytes"].asDouble());
+    }
+    TS_ASSERT_EQUALS(parent["args"]["version"].asInt(), 2);
+    TS_ASSERT_LESS_THAN_EQUALS(parent["ts"].asDouble(),
+                               child["ts"].asDouble());
+    TS_ASSERT_LESS_THAN_EQUALS(
+        child["ts"].asDouble() + child["dur"].asDouble(),
+        parent["ts"].asDouble() + parent["dur"].asDouble());
+
+    WorkspaceTester ws;
+    ws.initialize(2, 11, 10);
+    TS_ASSERT_EQUALS(
+        child["args"]["outputWorkspaceBytes"]["OutputWorkspace"].asDouble(),
+        static_cast<double>(ws.getMemorySize()));
+    TS_ASSERT(parent["args"]["outputWorkspaceBytes"].empty());
+  }
+
+  void test_failed_execution_is_traced() {
+    AlgorithmTracer::setTraceFile(m_fileName);
+    TracerParentAlgorithm alg;
+    alg.initialize();
+    alg.setProperty("Fail", true);
+    alg.setRethrows(true);
+    TS_ASSERT_THROWS(alg.execute(), std::runtime_error);
+    AlgorithmTracer::setTraceFile("");
+
+    const auto events = readTrace();
+    TS_ASSERT_EQUALS(events.size(), 1);
+    if (events.size() != 1)
+      return;
+    TS_ASSERT_EQUALS(events[0]["name"].asString(), "TracerParentAlgorithm");
+    TS_ASSERT(!events[0]["args"]["succeeded"].asBool());
+  }
+
+private:
+  ::Json::Value readTrace() const {
+    std::ifstream file(m_fileName.c_str());
+    ::Json::Value events;
+    ::Json::Reader reader;
+    TSM_ASSERT("The trace is not valid JSON", reader.parse(file, events));
+    return events;
+  }
+
+  std::string m_fileName;
+};
+
+#endif /* MANTID_API_ALGORITHMTRACERTEST_H_ */
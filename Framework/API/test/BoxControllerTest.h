@@ -233,6 +233,7 @@ public:
     TS_ASSERT_EQUALS(a.getMaxDepth(), b.getMaxDepth());
     TS_ASSERT_EQUALS(a.getMaxId(), b.getMaxId());
     TS_ASSERT_EQUALS(a.getSplitThreshold(), b.getSplitThreshold());
+    TS_ASSERT_EQUALS(a.useSpaceFillingCurve(), b.useSpaceFillingCurve());
     TS_ASSERT_EQUALS(a.getNumMDBoxes(), b.getNumMDBoxes());
     TS_ASSERT_EQUALS(a.getNumSplit(), b.getNumSplit());
     TS_ASSERT_EQUALS(a.getMaxNumMDBoxes(), b.getMaxNumMDBoxes());
@@ -293,6 +294,34 @@ public:
     compareBoxControllers(a, b);
   }
 
+  void test_xmlWithSpaceFillingCurve() {
+    BoxController a(2);
+    a.setSplitInto(10);
+    TS_ASSERT(!a.useSpaceFillingCurve());
+    a.setUseSpaceFillingCurve(true);
+
+    BoxController b(2);
+    b.fromXMLString(a.toXMLString());
+    TS_ASSERT(b.useSpaceFillingCurve());
+    compareBoxControllers(a, b);
+    TS_ASSERT(a == b);
+  }
+
+  void test_xmlWithoutSpaceFillingCurve_keepsInsertionOrder() {
+    BoxController a(2);
+    a.setSplitInto(10);
+    std::string xml = a.toXMLString();
+    const std::string element = "<SpaceFillingCurve>0</SpaceFillingCurve>";
+    const size_t pos = xml.find(element);
+    TS_ASSERT_DIFFERS(pos, std::string::npos);
+    xml.erase(pos, element.size());
+
+    BoxController b(2);
+    b.setUseSpaceFillingCurve(true);
+    b.fromXMLString(xml);
+    TS_ASSERT(!b.useSpaceFillingCurve());
+  }
+
   void test_Clone() {
     BoxController a(2);
     a.setMaxDepth(4);
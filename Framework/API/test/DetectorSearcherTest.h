@@ -28,10 +28,10 @@ public:
     ExperimentInfo expInfo2;
     expInfo2.setInstrument(inst2);
 
-    TS_ASSERT_THROWS_NOTHING(
-        DetectorSearcher searcher(inst1, expInfo1.detectorInfo()))
-    TS_ASSERT_THROWS_NOTHING(
-        DetectorSearcher searcher(inst2, expInfo2.detectorInfo()))
+    TS_ASSERT_THROWS_NOTHING(DetectorSearcher searcher(
+        inst1, expInfo1.componentInfo(), expInfo1.detectorInfo()))
+    TS_ASSERT_THROWS_NOTHING(DetectorSearcher searcher(
+        inst2, expInfo2.componentInfo(), expInfo2.detectorInfo()))
   }
 
   void test_search_cylindrical() {
@@ -41,7 +41,8 @@ public:
     ExperimentInfo expInfo;
     expInfo.setInstrument(inst);
 
-    DetectorSearcher searcher(inst, expInfo.detectorInfo());
+    DetectorSearcher searcher(inst, expInfo.componentInfo(),
+                              expInfo.detectorInfo());
     const auto checkResult = [&searcher](const V3D &q, size_t index) {
       const auto result = searcher.findDetectorIndex(q);
       TS_ASSERT(std::get<0>(result))
@@ -85,7 +86,7 @@ public:
     expInfo.setInstrument(inst);
     const auto &info = expInfo.detectorInfo();
 
-    DetectorSearcher searcher(inst, info);
+    DetectorSearcher searcher(inst, expInfo.componentInfo(), info);
     const auto resultNull = searcher.findDetectorIndex(V3D(0, 0, 0));
     TS_ASSERT(!std::get<0>(resultNull))
 
@@ -100,7 +101,7 @@ public:
     expInfo.setInstrument(inst);
     const auto &info = expInfo.detectorInfo();
 
-    DetectorSearcher searcher(inst, info);
+    DetectorSearcher searcher(inst, expInfo.componentInfo(), info);
     const auto resultNull = searcher.findDetectorIndex(V3D(0, 0, 0));
     TS_ASSERT(!std::get<0>(resultNull))
 
@@ -115,7 +116,7 @@ public:
     expInfo.setInstrument(inst);
     const auto &info = expInfo.detectorInfo();
 
-    DetectorSearcher searcher(inst, info);
+    DetectorSearcher searcher(inst, expInfo.componentInfo(), info);
     const auto checkResult = [&searcher](V3D q, size_t index) {
       const auto result = searcher.findDetectorIndex(q);
       TS_ASSERT(std::get<0>(result))
@@ -148,7 +149,7 @@ public:
     expInfo.setInstrument(inst);
     const auto &info = expInfo.detectorInfo();
 
-    DetectorSearcher searcher(inst, info);
+    DetectorSearcher searcher(inst, expInfo.componentInfo(), info);
 
     std::vector<double> xDirections(100);
     std::vector<double> yDirections(100);
@@ -193,7 +194,7 @@ public:
     expInfo.setInstrument(inst);
     const auto &info = expInfo.detectorInfo();
 
-    DetectorSearcher searcher(inst, info);
+    DetectorSearcher searcher(inst, expInfo.componentInfo(), info);
 
     std::vector<double> xDirections(50);
     std::vector<double> yDirections(50);
@@ -3,6 +3,7 @@
 
 #include "MantidAPI/Algorithm.h"
 #include "MantidDataObjects/EventWorkspace.h"
+#include "MantidGeometry/Instrument/Parameter.h"
 #include "MantidKernel/Unit.h"
 
 namespace Mantid {
@@ -145,6 +146,9 @@ protected:
   /// EventWorkspace
   Kernel::Unit_const_sptr m_inputUnit; ///< The unit of the input workspace
   Kernel::Unit_sptr m_outputUnit;      ///< The unit we're going to
+  /// The Efixed parameter of each detector, by detector index. Only filled
+  /// for indirect geometry when no Efixed is given.
+  std::vector<Geometry::Parameter_sptr> m_efixedParameters;
 };
 
 } // namespace Algorithm
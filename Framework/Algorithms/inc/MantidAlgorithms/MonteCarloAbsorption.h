@@ -67,7 +67,8 @@ private:
   API::MatrixWorkspace_uptr doSimulation(
       const API::MatrixWorkspace &inputWS, const size_t nevents, int nlambda,
       const int seed, const InterpolationOption &interpolateOpt,
-      const bool useSparseInstrument, const size_t maxScatterPtAttempts);
+      const bool useSparseInstrument, const size_t maxScatterPtAttempts,
+      const bool reuseTracks);
   API::MatrixWorkspace_uptr
   createOutputWorkspace(const API::MatrixWorkspace &inputWS) const;
   std::unique_ptr<IBeamProfile>
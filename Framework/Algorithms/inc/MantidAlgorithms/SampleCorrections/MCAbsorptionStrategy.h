@@ -4,6 +4,7 @@
 #include "MantidAlgorithms/DllConfig.h"
 #include "MantidAlgorithms/SampleCorrections/MCInteractionVolume.h"
 #include <tuple>
+#include <vector>
 
 namespace Mantid {
 namespace API {
@@ -22,6 +23,10 @@ class IBeamProfile;
   instance has a fixed nominal source position, nominal sample
   position & sample + containers shapes.
 
+  The correction can also be calculated for many pairs of wavelengths at once
+  from one set of events. Each event is then traced once, and the attenuation
+  of all the events is evaluated for each pair of wavelengths in turn.
+
   The error on all points is defined to be \f$\frac{1}{\sqrt{N}}\f$, where N is
   the number of events generated.
 
@@ -55,6 +60,11 @@ public:
                                        const Kernel::V3D &finalPos,
                                        double lambdaBefore,
                                        double lambdaAfter) const;
+  void calculate(Kernel::PseudoRandomNumberGenerator &rng,
+                 const Kernel::V3D &finalPos,
+                 const std::vector<double> &lambdasBefore,
+                 const std::vector<double> &lambdasAfter,
+                 std::vector<double> &factors) const;
 
 private:
   const IBeamProfile &m_beamProfile;
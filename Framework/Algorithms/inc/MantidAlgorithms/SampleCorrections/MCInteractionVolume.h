@@ -4,6 +4,8 @@
 #include "MantidAlgorithms/DllConfig.h"
 #include "MantidGeometry/Objects/BoundingBox.h"
 
+#include <vector>
+
 namespace Mantid {
 namespace API {
 class Sample;
@@ -11,6 +13,7 @@ class Sample;
 namespace Geometry {
 class Object;
 class SampleEnvironment;
+class Track;
 }
 namespace Kernel {
 class PseudoRandomNumberGenerator;
@@ -22,7 +25,8 @@ class IBeamProfile;
 /**
   Defines a volume where interactions of Tracks and Objects can take place.
   Given an initial Track, end point & wavelengths it calculates the absorption
-  correction factor.
+  correction factor. It can also give the lengths of the paths through each
+  of its objects, from which the correction at any wavelength follows.
 
   Copyright &copy; 2016 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
   National Laboratory & European Spallation Source
@@ -60,12 +64,29 @@ public:
                              const Kernel::V3D &startPos,
                              const Kernel::V3D &endPos, double lambdaBefore,
                              double lambdaAfter) const;
+  /// @return The number of objects: the sample, then each environment
+  /// component
+  size_t numberOfObjects() const { return m_objects.size(); }
+  /// @return The object at the given index
+  const Geometry::Object &getObject(const size_t index) const {
+    return *m_objects[index];
+  }
+  bool calculatePathLengths(Kernel::PseudoRandomNumberGenerator &rng,
+                            const Kernel::V3D &startPos,
+                            const Kernel::V3D &endPos, double *lengthsBefore,
+                            double *lengthsAfter) const;
 
 private:
+  Kernel::V3D
+  generateScatterPoint(Kernel::PseudoRandomNumberGenerator &rng) const;
+  void addPathLengths(const Geometry::Track &path, double *lengths) const;
+
   const Geometry::Object &m_sample;
   const Geometry::SampleEnvironment *m_env;
   const Geometry::BoundingBox m_activeRegion;
   const size_t m_maxScatterAttempts;
+  /// The sample, then each environment component
+  std::vector<const Geometry::Object *> m_objects;
 };
 
 } // namespace Algorithms
@@ -9,10 +9,13 @@
 #include "MantidDataObjects/EventWorkspace.h"
 #include "MantidDataObjects/Workspace2D.h"
 #include "MantidGeometry/Instrument.h"
+#include "MantidGeometry/Instrument/DetectorInfo.h"
+#include "MantidGeometry/Instrument/ParameterMap.h"
 #include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/CompositeValidator.h"
 #include "MantidKernel/ListValidator.h"
 #include "MantidKernel/UnitFactory.h"
+#include "MantidTypes/SpectrumDefinition.h"
 
 #include <numeric>
 
@@ -424,12 +427,14 @@ bool ConvertUnits::getDetectorValues(const API::SpectrumInfo &spectrumInfo,
     if (emode == 2 && efixed == EMPTY_DBL()) // indirect
     {
       if (spectrumInfo.hasUniqueDetector(wsIndex)) {
-        const auto &det = spectrumInfo.detector(wsIndex);
-        auto par = ws.constInstrumentParameters().getRecursive(&det, "Efixed");
+        const size_t detIndex =
+            spectrumInfo.spectrumDefinition(wsIndex)[0].first;
+        const auto &par = m_efixedParameters[detIndex];
         if (par) {
           efixed = par->value<double>();
-          g_log.debug() << "Detector: " << det.getID() << " EFixed: " << efixed
-                        << "\n";
+          g_log.debug() << "Detector: "
+                        << ws.detectorInfo().detectorIDs()[detIndex]
+                        << " EFixed: " << efixed << "\n";
         }
       }
       // Non-unique detector (i.e., DetectorGroup): use single provided value
@@ -508,6 +513,12 @@ ConvertUnits::convertViaTOF(Kernel::Unit_const_sptr fromUnit,
     efixedProp = 0.0;
   }
 
+  // Look up Efixed for all of the detectors at once rather than per spectrum
+  m_efixedParameters.clear();
+  if (emode == 2 && efixedProp == EMPTY_DBL())
+    m_efixedParameters =
+        inputWS->constInstrumentParameters().getRecursiveForDetectors("Efixed");
+
   std::vector<std::string> parameters =
       inputWS->getInstrument()->getStringParameter("show-signed-theta");
   bool signedTheta =
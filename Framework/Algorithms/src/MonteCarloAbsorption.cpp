@@ -131,6 +131,13 @@ void MonteCarloAbsorption::init() {
       Kernel::make_unique<EnabledWhenProperty>(
           "SparseInstrument", ePropertyCriterion::IS_NOT_DEFAULT));
 
+  // Trace each event once for all the wavelength points of a spectrum
+  declareProperty("ReuseTracksAcrossWavelengths", false,
+                  "If true, each spectrum is simulated with one set of events "
+                  "for all of its wavelength points, so each event is traced "
+                  "once instead of once per point. The points of a spectrum "
+                  "are then not statistically independent.");
+
   // Control the number of attempts made to generate a random point in the
   // object
   declareProperty("MaxScatterPtAttempts", 5000, positiveInt,
@@ -154,10 +161,12 @@ void MonteCarloAbsorption::exec() {
   InterpolationOption interpolateOpt;
   interpolateOpt.set(getPropertyValue("Interpolation"));
   const bool useSparseInstrument = getProperty("SparseInstrument");
+  const bool reuseTracks = getProperty("ReuseTracksAcrossWavelengths");
   const int maxScatterPtAttempts = getProperty("MaxScatterPtAttempts");
   auto outputWS = doSimulation(*inputWS, static_cast<size_t>(nevents), nlambda,
                                seed, interpolateOpt, useSparseInstrument,
-                               static_cast<size_t>(maxScatterPtAttempts));
+                               static_cast<size_t>(maxScatterPtAttempts),
+                               reuseTracks);
 
   setProperty("OutputWorkspace", std::move(outputWS));
 }
@@ -190,12 +199,15 @@ std::map<std::string, std::string> MonteCarloAbsorption::validateInputs() {
  * @param useSparseInstrument If true, use sparse instrument in simulation
  * @param maxScatterPtAttempts The maximum number of tries to generate a
  * scatter point within the object
+ * @param reuseTracks If true, use the same events for all the wavelength
+ * points of a spectrum
  * @return A new workspace containing the correction factors & errors
  */
 MatrixWorkspace_uptr MonteCarloAbsorption::doSimulation(
     const MatrixWorkspace &inputWS, const size_t nevents, int nlambda,
     const int seed, const InterpolationOption &interpolateOpt,
-    const bool useSparseInstrument, const size_t maxScatterPtAttempts) {
+    const bool useSparseInstrument, const size_t maxScatterPtAttempts,
+    const bool reuseTracks) {
   auto outputWS = createOutputWorkspace(inputWS);
   const auto inputNbins = static_cast<int>(inputWS.blocksize());
   if (isEmpty(nlambda) || nlambda > inputNbins) {
@@ -237,6 +249,16 @@ MatrixWorkspace_uptr MonteCarloAbsorption::doSimulation(
   MCAbsorptionStrategy strategy(*beamProfile, inputWS.sample(), nevents,
                                 maxScatterPtAttempts);
 
+  // Indices of the wavelength points to simulate
+  std::vector<int> simulatedPoints;
+  for (int j = 0; j < nbins; j += lambdaStepSize) {
+    simulatedPoints.push_back(j);
+    // Ensure we have the last point for the interpolation
+    if (lambdaStepSize > 1 && j + lambdaStepSize >= nbins && j + 1 != nbins) {
+      j = nbins - lambdaStepSize - 1;
+    }
+  }
+
   const auto &spectrumInfo = simulationWS.spectrumInfo();
 
   PARALLEL_FOR_IF(Kernel::threadSafe(simulationWS))
@@ -258,9 +280,10 @@ MatrixWorkspace_uptr MonteCarloAbsorption::doSimulation(
 
     auto &outY = simulationWS.mutableY(i);
     const auto lambdas = simulationWS.points(i);
-    // Simulation for each requested wavelength point
-    for (int j = 0; j < nbins; j += lambdaStepSize) {
-      prog.report(reportMsg);
+    std::vector<double> lambdasIn, lambdasOut;
+    lambdasIn.reserve(simulatedPoints.size());
+    lambdasOut.reserve(simulatedPoints.size());
+    for (const auto j : simulatedPoints) {
       const double lambdaStep = lambdas[j];
       double lambdaIn(lambdaStep), lambdaOut(lambdaStep);
       if (efixed.emode() == DeltaEMode::Direct) {
@@ -270,12 +293,23 @@ MatrixWorkspace_uptr MonteCarloAbsorption::doSimulation(
       } else {
         // elastic case already initialized
       }
-      std::tie(outY[j], std::ignore) =
-          strategy.calculate(rng, detPos, lambdaIn, lambdaOut);
-
-      // Ensure we have the last point for the interpolation
-      if (lambdaStepSize > 1 && j + lambdaStepSize >= nbins && j + 1 != nbins) {
-        j = nbins - lambdaStepSize - 1;
+      lambdasIn.push_back(lambdaIn);
+      lambdasOut.push_back(lambdaOut);
+    }
+    if (reuseTracks) {
+      // One set of events for all the wavelength points
+      std::vector<double> factors;
+      strategy.calculate(rng, detPos, lambdasIn, lambdasOut, factors);
+      for (size_t k = 0; k < simulatedPoints.size(); ++k) {
+        outY[simulatedPoints[k]] = factors[k];
+      }
+      prog.reportIncrement(static_cast<int>(simulatedPoints.size()), reportMsg);
+    } else {
+      // Simulation for each requested wavelength point
+      for (size_t k = 0; k < simulatedPoints.size(); ++k) {
+        prog.report(reportMsg);
+        std::tie(outY[simulatedPoints[k]], std::ignore) =
+            strategy.calculate(rng, detPos, lambdasIn[k], lambdasOut[k]);
       }
     }
 
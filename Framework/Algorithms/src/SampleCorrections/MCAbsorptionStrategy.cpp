@@ -5,12 +5,33 @@
 
 #include "MantidAlgorithms/SampleCorrections/RectangularBeamProfile.h"
 #include "MantidGeometry/Objects/Object.h"
+#include "MantidKernel/Material.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
 
 namespace Mantid {
 using Kernel::PseudoRandomNumberGenerator;
 
 namespace Algorithms {
 
+namespace {
+/**
+ * Create the error raised when no valid track could be generated
+ * @param maxAttempts The number of attempts made
+ * @return An exception describing the problem
+ */
+std::runtime_error tooManyAttemptsError(const size_t maxAttempts) {
+  return std::runtime_error("Unable to generate valid track through "
+                            "sample interaction volume after " +
+                            std::to_string(maxAttempts) +
+                            " attempts. Try increasing the maximum "
+                            "threshold or if this does not help then "
+                            "please check the defined shape.");
+}
+} // namespace
+
 /**
  * Constructor
  * @param beamProfile A reference to the object the beam profile
@@ -59,12 +80,7 @@ MCAbsorptionStrategy::calculate(Kernel::PseudoRandomNumberGenerator &rng,
         break;
       }
       if (attempts == m_maxScatterAttempts) {
-        throw std::runtime_error("Unable to generate valid track through "
-                                 "sample interaction volume after " +
-                                 std::to_string(m_maxScatterAttempts) +
-                                 " attempts. Try increasing the maximum "
-                                 "threshold or if this does not help then "
-                                 "please check the defined shape.");
+        throw tooManyAttemptsError(m_maxScatterAttempts);
       }
     } while (true);
   }
@@ -72,5 +88,86 @@ MCAbsorptionStrategy::calculate(Kernel::PseudoRandomNumberGenerator &rng,
   return make_tuple(factor / static_cast<double>(m_nevents), m_error);
 }
 
+/**
+ * Compute the correction for a final position of the neutron and many pairs
+ * of wavelengths before and after scattering. The same events are used for
+ * every pair, and are generated as the single wavelength calculate generates
+ * them, so the first factor equals the one it returns for the first pair.
+ * @param rng A reference to a PseudoRandomNumberGenerator
+ * @param finalPos Defines the final position of the neutron, assumed to be
+ * where it is detected
+ * @param lambdasBefore Wavelengths, in \f$\\A^-1\f$, before scattering
+ * @param lambdasAfter Wavelengths, in \f$\\A^-1\f$, after scattering. Must be
+ * the same size as lambdasBefore.
+ * @param factors Output: the correction factor for each pair of wavelengths.
+ * The error on each is the same as for the single wavelength calculate.
+ */
+void MCAbsorptionStrategy::calculate(Kernel::PseudoRandomNumberGenerator &rng,
+                                     const Kernel::V3D &finalPos,
+                                     const std::vector<double> &lambdasBefore,
+                                     const std::vector<double> &lambdasAfter,
+                                     std::vector<double> &factors) const {
+  if (lambdasBefore.size() != lambdasAfter.size()) {
+    throw std::invalid_argument("MCAbsorptionStrategy::calculate - The number "
+                                "of wavelengths before and after scattering "
+                                "differ.");
+  }
+  const auto scatterBounds = m_scatterVol.getBoundingBox();
+  const size_t nobjects = m_scatterVol.numberOfObjects();
+  // Path lengths through each object, stored object by object so that the
+  // loops over events below run over contiguous memory
+  std::vector<double> lengthsBefore(nobjects * m_nevents);
+  std::vector<double> lengthsAfter(nobjects * m_nevents);
+  std::vector<double> eventBefore(nobjects), eventAfter(nobjects);
+  for (size_t i = 0; i < m_nevents; ++i) {
+    size_t attempts(0);
+    do {
+      const auto neutron = m_beamProfile.generatePoint(rng, scatterBounds);
+      if (m_scatterVol.calculatePathLengths(rng, neutron.startPos, finalPos,
+                                            eventBefore.data(),
+                                            eventAfter.data())) {
+        for (size_t j = 0; j < nobjects; ++j) {
+          lengthsBefore[j * m_nevents + i] = eventBefore[j];
+          lengthsAfter[j * m_nevents + i] = eventAfter[j];
+        }
+        break;
+      }
+      ++attempts;
+      if (attempts == m_maxScatterAttempts) {
+        throw tooManyAttemptsError(m_maxScatterAttempts);
+      }
+    } while (true);
+  }
+
+  factors.resize(lambdasBefore.size());
+  std::vector<double> exponents(m_nevents);
+  for (size_t k = 0; k < lambdasBefore.size(); ++k) {
+    std::fill(exponents.begin(), exponents.end(), 0.0);
+    for (size_t j = 0; j < nobjects; ++j) {
+      // Attenuation coefficients in m^-1, from the number density in
+      // inverse cubic angstroms and the cross sections in barns
+      const auto &material = m_scatterVol.getObject(j).material();
+      const double muBefore =
+          100. * material.numberDensity() *
+          (material.totalScatterXSection(lambdasBefore[k]) +
+           material.absorbXSection(lambdasBefore[k]));
+      const double muAfter =
+          100. * material.numberDensity() *
+          (material.totalScatterXSection(lambdasAfter[k]) +
+           material.absorbXSection(lambdasAfter[k]));
+      const double *before = lengthsBefore.data() + j * m_nevents;
+      const double *after = lengthsAfter.data() + j * m_nevents;
+      for (size_t i = 0; i < m_nevents; ++i) {
+        exponents[i] += muBefore * before[i] + muAfter * after[i];
+      }
+    }
+    double factor(0.0);
+    for (const double exponent : exponents) {
+      factor += std::exp(-exponent);
+    }
+    factors[k] = factor / static_cast<double>(m_nevents);
+  }
+}
+
 } // namespace Algorithms
 } // namespace Mantid
@@ -6,6 +6,8 @@
 #include "MantidKernel/Material.h"
 #include "MantidKernel/PseudoRandomNumberGenerator.h"
 
+#include <algorithm>
+
 namespace Mantid {
 using Geometry::Track;
 using Kernel::V3D;
@@ -55,6 +57,12 @@ MCInteractionVolume::MCInteractionVolume(
   } catch (std::runtime_error &) {
     // swallow this as no defined environment from getEnvironment
   }
+  m_objects.push_back(&m_sample);
+  if (m_env) {
+    for (size_t i = 0; i < m_env->nelements(); ++i) {
+      m_objects.push_back(&m_env->getComponent(i));
+    }
+  }
 }
 
 /**
@@ -87,14 +95,7 @@ double MCInteractionVolume::calculateAbsorption(
   // is calculated in reverse, i.e. defining the track from the scatter pt
   // backwards for simplicity with how the Track object works. This avoids
   // having to understand exactly which object the scattering occurred in.
-  V3D scatterPos;
-  if (m_env && (rng.nextValue() > 0.5)) {
-    scatterPos =
-        m_env->generatePoint(rng, m_activeRegion, m_maxScatterAttempts);
-  } else {
-    scatterPos = m_sample.generatePointInObject(rng, m_activeRegion,
-                                                m_maxScatterAttempts);
-  }
+  const V3D scatterPos = generateScatterPoint(rng);
   auto toStart = startPos - scatterPos;
   toStart.normalize();
   Track beforeScatter(scatterPos, toStart);
@@ -135,5 +136,86 @@ double MCInteractionVolume::calculateAbsorption(
          calculateAttenuation(afterScatter, lambdaAfter);
 }
 
+/**
+ * Generate a scatter point and the tracks to it from a start point and from
+ * it to an end point, as calculateAbsorption does, and return the lengths of
+ * the tracks inside each object of the volume. The random numbers used are
+ * the same as those of calculateAbsorption.
+ * @param rng A reference to a PseudoRandomNumberGenerator producing
+ * random number between [0,1]
+ * @param startPos Origin of the initial track
+ * @param endPos Final position of neutron after scattering (assumed to be
+ * outside of the "volume")
+ * @param lengthsBefore Output: the length, in metres, of the track before
+ * scattering inside each object. Holds numberOfObjects() values.
+ * @param lengthsAfter Output: the length, in metres, of the track after
+ * scattering inside each object. Holds numberOfObjects() values.
+ * @return False if the track was not valid, in which case the lengths are
+ * undefined
+ */
+bool MCInteractionVolume::calculatePathLengths(
+    Kernel::PseudoRandomNumberGenerator &rng, const Kernel::V3D &startPos,
+    const Kernel::V3D &endPos, double *lengthsBefore,
+    double *lengthsAfter) const {
+  const V3D scatterPos = generateScatterPoint(rng);
+  auto toStart = startPos - scatterPos;
+  toStart.normalize();
+  Track beforeScatter(scatterPos, toStart);
+  int nlinks = m_sample.interceptSurface(beforeScatter);
+  if (m_env) {
+    nlinks += m_env->interceptSurfaces(beforeScatter);
+  }
+  if (nlinks == 0) {
+    return false;
+  }
+
+  V3D scatteredDirec = endPos - scatterPos;
+  scatteredDirec.normalize();
+  Track afterScatter(scatterPos, scatteredDirec);
+  m_sample.interceptSurface(afterScatter);
+  if (m_env) {
+    m_env->interceptSurfaces(afterScatter);
+  }
+  addPathLengths(beforeScatter, lengthsBefore);
+  addPathLengths(afterScatter, lengthsAfter);
+  return true;
+}
+
+/**
+ * Generate a scatter point. If there is an environment present then first
+ * select whether the scattering occurs on the sample or the environment.
+ * @param rng A reference to a PseudoRandomNumberGenerator producing
+ * random number between [0,1]
+ * @return A point inside the sample or one of the environment components
+ */
+V3D MCInteractionVolume::generateScatterPoint(
+    Kernel::PseudoRandomNumberGenerator &rng) const {
+  if (m_env && (rng.nextValue() > 0.5)) {
+    return m_env->generatePoint(rng, m_activeRegion, m_maxScatterAttempts);
+  }
+  return m_sample.generatePointInObject(rng, m_activeRegion,
+                                        m_maxScatterAttempts);
+}
+
+/**
+ * Sum the lengths of the segments of a track inside each object of the volume
+ * @param path A track through the volume
+ * @param lengths Output: the length of the track inside each object
+ */
+void MCInteractionVolume::addPathLengths(const Track &path,
+                                         double *lengths) const {
+  std::fill_n(lengths, m_objects.size(), 0.0);
+  for (const auto &segment : path) {
+    const auto object =
+        std::find(m_objects.cbegin(), m_objects.cend(), segment.object);
+    if (object == m_objects.cend()) {
+      throw std::logic_error(
+          "MCInteractionVolume - track passes through an unknown object.");
+    }
+    lengths[std::distance(m_objects.cbegin(), object)] +=
+        segment.distInsideObject;
+  }
+}
+
 } // namespace Algorithms
 } // namespace Mantid
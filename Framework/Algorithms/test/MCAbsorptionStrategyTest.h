@@ -58,10 +58,62 @@ public:
     TS_ASSERT_DELTA(1.0 / std::sqrt(nevents), error, 1e-08);
   }
 
+  void test_Simulation_For_Many_Wavelengths_Generates_Events_Once() {
+    using Mantid::Kernel::V3D;
+    using namespace MonteCarloTesting;
+    using namespace ::testing;
+
+    auto testSampleSphere = MonteCarloTesting::createTestSample(
+        MonteCarloTesting::TestSampleType::SolidSphere);
+    MockBeamProfile testBeamProfile;
+    EXPECT_CALL(testBeamProfile, defineActiveRegion(_))
+        .WillOnce(Return(testSampleSphere.getShape().getBoundingBox()));
+    const size_t nevents(10), maxTries(100);
+    MCAbsorptionStrategy mcabsorb(testBeamProfile, testSampleSphere, nevents,
+                                  maxTries);
+    // 3 random numbers per event expected, for all wavelengths together
+    MockRNG rng;
+    EXPECT_CALL(rng, nextValue())
+        .Times(Exactly(30))
+        .WillRepeatedly(Return(0.5));
+    const Mantid::Algorithms::IBeamProfile::Ray testRay = {V3D(-2, 0, 0),
+                                                           V3D(1, 0, 0)};
+    EXPECT_CALL(testBeamProfile, generatePoint(_, _))
+        .Times(Exactly(static_cast<int>(nevents)))
+        .WillRepeatedly(Return(testRay));
+    const V3D endPos(0.7, 0.7, 1.4);
+    const std::vector<double> lambdasBefore{2.5, 1.5}, lambdasAfter{3.5, 2.0};
+
+    std::vector<double> factors;
+    mcabsorb.calculate(rng, endPos, lambdasBefore, lambdasAfter, factors);
+    TS_ASSERT_EQUALS(2, factors.size());
+    TS_ASSERT_DELTA(0.0043828472, factors[0], 1e-08);
+    // Absorption falls with the wavelength
+    TS_ASSERT_LESS_THAN(factors[0], factors[1]);
+  }
+
   //----------------------------------------------------------------------------
   // Failure cases
   //----------------------------------------------------------------------------
 
+  void test_Simulation_For_Many_Wavelengths_Needs_Pairs_Of_Wavelengths() {
+    using Mantid::Kernel::V3D;
+    using namespace MonteCarloTesting;
+    using namespace ::testing;
+
+    auto testSampleSphere = MonteCarloTesting::createTestSample(
+        MonteCarloTesting::TestSampleType::SolidSphere);
+    MockBeamProfile testBeamProfile;
+    EXPECT_CALL(testBeamProfile, defineActiveRegion(_))
+        .WillOnce(Return(testSampleSphere.getShape().getBoundingBox()));
+    MCAbsorptionStrategy mcabsorb(testBeamProfile, testSampleSphere, 10, 100);
+    MockRNG rng;
+    std::vector<double> factors;
+    TS_ASSERT_THROWS(mcabsorb.calculate(rng, V3D(0.7, 0.7, 1.4), {2.5, 1.5},
+                                        {3.5}, factors),
+                     std::invalid_argument);
+  }
+
   void test_thin_object_fails_to_generate_point_in_sample() {
     using Mantid::Algorithms::RectangularBeamProfile;
     using namespace Mantid::Geometry;
@@ -125,6 +125,44 @@ public:
     Mock::VerifyAndClearExpectations(&rng);
   }
 
+  void test_Path_Lengths_Give_Same_Absorption_As_calculateAbsorption() {
+    using Mantid::Kernel::V3D;
+    using namespace MonteCarloTesting;
+    using namespace ::testing;
+
+    // Testing inputs
+    const V3D startPos(-2.0, 0.0, 0.0), endPos(2.0, 0.0, 0.0);
+    const double lambdaBefore(2.5), lambdaAfter(3.5);
+
+    auto sample = createTestSample(TestSampleType::SamplePlusContainer);
+    MockRNG rng;
+    // force scatter in sample
+    EXPECT_CALL(rng, nextValue())
+        .Times(Exactly(4))
+        .WillRepeatedly(Return(0.25));
+
+    MCInteractionVolume interactor(sample,
+                                   sample.getEnvironment().boundingBox());
+    TS_ASSERT_EQUALS(2, interactor.numberOfObjects());
+    TS_ASSERT_EQUALS(&sample.getShape(), &interactor.getObject(0));
+    double lengthsBefore[2], lengthsAfter[2];
+    TS_ASSERT(interactor.calculatePathLengths(rng, startPos, endPos,
+                                              lengthsBefore, lengthsAfter));
+    double factor(1.0);
+    for (size_t i = 0; i < 2; ++i) {
+      const auto &material = interactor.getObject(i).material();
+      const double muBefore = material.totalScatterXSection(lambdaBefore) +
+                              material.absorbXSection(lambdaBefore);
+      const double muAfter = material.totalScatterXSection(lambdaAfter) +
+                             material.absorbXSection(lambdaAfter);
+      factor *= std::exp(-100 * material.numberDensity() *
+                         (muBefore * lengthsBefore[i] +
+                          muAfter * lengthsAfter[i]));
+    }
+    TS_ASSERT_DELTA(0.73100698, factor, 1e-8);
+    Mock::VerifyAndClearExpectations(&rng);
+  }
+
   //----------------------------------------------------------------------------
   // Failure cases
   //----------------------------------------------------------------------------
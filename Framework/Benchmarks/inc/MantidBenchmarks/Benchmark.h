@@ -0,0 +1,163 @@
+#ifndef MANTID_BENCHMARKS_BENCHMARK_H_
+#define MANTID_BENCHMARKS_BENCHMARK_H_
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace Mantid {
+namespace Benchmarks {
+
+/** State : drives the timed loop of one benchmark run and collects what it
+  measures. A benchmark function is given a State and runs the code to
+  measure in a loop:
+
+  @code
+  void sortEvents(State &state) {
+    auto events = makeEvents(state.range());
+    while (state.keepRunning()) {
+      state.pauseTiming();
+      EventList list(events);
+      state.resumeTiming();
+      list.sortTof();
+    }
+    state.setItemsProcessed(state.iterations() * state.range());
+  }
+  @endcode
+
+  The harness chooses the number of iterations so that a run lasts long
+  enough to be timed reliably.
+
+  Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+class State {
+public:
+  using Clock = std::chrono::steady_clock;
+
+  State(int64_t range, int64_t iterations);
+
+  /// @return the parameter of this run, e.g. the number of events
+  int64_t range() const { return m_range; }
+  /// @return the number of iterations of this run
+  int64_t iterations() const { return m_iterations; }
+
+  /// @return true while there are iterations left to run
+  bool keepRunning() {
+    if (m_done < m_iterations) {
+      if (m_done++ == 0)
+        resumeTiming();
+      return true;
+    }
+    pauseTiming();
+    return false;
+  }
+  /// Stop the clock, e.g. while the input of the next iteration is made
+  void pauseTiming();
+  /// Restart the clock
+  void resumeTiming();
+
+  /// Set the number of items, e.g. events, handled over all iterations
+  void setItemsProcessed(int64_t items) { m_itemsProcessed = items; }
+  int64_t itemsProcessed() const { return m_itemsProcessed; }
+  /// @return the time the clock ran, in seconds
+  double elapsedSeconds() const {
+    return std::chrono::duration<double>(m_elapsed).count();
+  }
+
+private:
+  int64_t m_range;
+  int64_t m_iterations;
+  int64_t m_done = 0;
+  int64_t m_itemsProcessed = 0;
+  bool m_timing = false;
+  Clock::time_point m_start;
+  Clock::duration m_elapsed = Clock::duration::zero();
+};
+
+/// A benchmark function and the ranges it runs with
+struct Benchmark {
+  using Function = std::function<void(State &)>;
+  /// Group of the benchmark, e.g. the class it measures
+  std::string group;
+  std::string name;
+  Function function;
+  std::vector<int64_t> ranges;
+};
+
+/// The result of running a benchmark with one range
+struct Result {
+  std::string group;
+  /// name/range
+  std::string name;
+  int64_t iterations;
+  /// Mean time of one iteration
+  double secondsPerIteration;
+  /// Items handled per second; 0 if the benchmark does not count items
+  double itemsPerSecond;
+};
+
+/// @return the registered benchmarks
+std::vector<Benchmark> &registeredBenchmarks();
+/// Register a benchmark; used through MANTID_BENCHMARK
+int registerBenchmark(const std::string &group, const std::string &name,
+                      Benchmark::Function function,
+                      std::vector<int64_t> ranges);
+
+/// Run a benchmark with a range for at least minSeconds
+Result run(const Benchmark &benchmark, int64_t range, double minSeconds);
+
+/// Write results as a table
+void writeTable(std::ostream &out, const std::vector<Result> &results);
+/// Write results as xUnit XML, as read by xunit_to_sql.py
+void writeXUnit(std::ostream &out, const std::vector<Result> &results);
+
+/** Keep the compiler from optimising away a value that is not used otherwise
+ * @param value :: the value to keep
+ */
+template <typename T> inline void doNotOptimize(const T &value) {
+#if defined(__GNUC__)
+  asm volatile("" : : "r,m"(value) : "memory");
+#else
+  static volatile const void *sink;
+  sink = &value;
+#endif
+}
+
+} // namespace Benchmarks
+} // namespace Mantid
+
+#define MANTID_BENCHMARK_CONCAT_(a, b) a##b
+#define MANTID_BENCHMARK_CONCAT(a, b) MANTID_BENCHMARK_CONCAT_(a, b)
+
+/** Register a benchmark function of a group, to be run once for each of the
+ * ranges that follow, e.g.
+ * MANTID_BENCHMARK(EventList, sortTof, 1000, 100000)
+ */
+#define MANTID_BENCHMARK(group, function, ...)                                 \
+  static const int MANTID_BENCHMARK_CONCAT(g_benchmark_, __LINE__) =           \
+      Mantid::Benchmarks::registerBenchmark(#group, #function, function,       \
+                                            {__VA_ARGS__})
+
+#endif /* MANTID_BENCHMARKS_BENCHMARK_H_ */
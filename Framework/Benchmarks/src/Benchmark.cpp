@@ -0,0 +1,157 @@
+#include "MantidBenchmarks/Benchmark.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <ostream>
+#include <sstream>
+
+namespace Mantid {
+namespace Benchmarks {
+
+namespace {
+/// Most iterations of a run
+const int64_t MAX_ITERATIONS = 1000000000;
+
+/// @return the time in seconds with a unit suited to its size
+std::string formatTime(double seconds) {
+  std::ostringstream text;
+  text << std::fixed << std::setprecision(3);
+  if (seconds < 1e-6)
+    text << seconds * 1e9 << " ns";
+  else if (seconds < 1e-3)
+    text << seconds * 1e6 << " us";
+  else if (seconds < 1.)
+    text << seconds * 1e3 << " ms";
+  else
+    text << seconds << " s";
+  return text.str();
+}
+} // namespace
+
+State::State(int64_t range, int64_t iterations)
+    : m_range(range), m_iterations(iterations) {}
+
+void State::pauseTiming() {
+  if (!m_timing)
+    return;
+  m_elapsed += Clock::now() - m_start;
+  m_timing = false;
+}
+
+void State::resumeTiming() {
+  if (m_timing)
+    return;
+  m_timing = true;
+  m_start = Clock::now();
+}
+
+/// @return the registered benchmarks
+std::vector<Benchmark> &registeredBenchmarks() {
+  static std::vector<Benchmark> benchmarks;
+  return benchmarks;
+}
+
+/** Register a benchmark
+ * @param group :: the group of the benchmark, e.g. the class it measures
+ * @param name :: the name of the benchmark within the group
+ * @param function :: the benchmark function
+ * @param ranges :: the ranges to run the function with, one run per range
+ * @return the number of benchmarks registered so far
+ */
+int registerBenchmark(const std::string &group, const std::string &name,
+                      Benchmark::Function function,
+                      std::vector<int64_t> ranges) {
+  auto &benchmarks = registeredBenchmarks();
+  benchmarks.push_back(
+      Benchmark{group, name, std::move(function), std::move(ranges)});
+  return static_cast<int>(benchmarks.size());
+}
+
+/** Run a benchmark with one range. The number of iterations grows from 1
+ * until a run takes at least minSeconds.
+ * @param benchmark :: the benchmark to run
+ * @param range :: the parameter of the run
+ * @param minSeconds :: the shortest time the result can be taken from
+ * @return the result of the last run
+ */
+Result run(const Benchmark &benchmark, int64_t range, double minSeconds) {
+  int64_t iterations = 1;
+  while (true) {
+    State state(range, iterations);
+    benchmark.function(state);
+    const double seconds = state.elapsedSeconds();
+    if (seconds >= minSeconds || iterations >= MAX_ITERATIONS) {
+      Result result;
+      result.group = benchmark.group;
+      result.name = benchmark.name + "/" + std::to_string(range);
+      result.iterations = iterations;
+      result.secondsPerIteration = seconds / static_cast<double>(iterations);
+      result.itemsPerSecond =
+          seconds > 0. ? static_cast<double>(state.itemsProcessed()) / seconds
+                       : 0.;
+      return result;
+    }
+    // Aim 40% past the minimum, growing by at least 2 and at most 100 times
+    const auto done = static_cast<double>(iterations);
+    const double estimate =
+        seconds > 0. ? 1.4 * minSeconds / seconds * done : 100. * done;
+    const double next = std::min(std::max(estimate, 2. * done), 100. * done);
+    iterations = std::min(static_cast<int64_t>(next), MAX_ITERATIONS);
+  }
+}
+
+/** Write results as a table
+ * @param out :: the stream to write to
+ * @param results :: the results to write
+ */
+void writeTable(std::ostream &out, const std::vector<Result> &results) {
+  size_t width = 9;
+  for (const auto &result : results)
+    width = std::max(width, result.group.size() + result.name.size() + 1);
+  out << std::left << std::setw(static_cast<int>(width) + 2) << "Benchmark"
+      << std::right << std::setw(14) << "Time" << std::setw(12)
+      << "Iterations" << std::setw(16) << "Items/s"
+      << "\n";
+  for (const auto &result : results) {
+    out << std::left << std::setw(static_cast<int>(width) + 2)
+        << (result.group + "." + result.name) << std::right << std::setw(14)
+        << formatTime(result.secondsPerIteration) << std::setw(12)
+        << result.iterations << std::setw(16);
+    if (result.itemsPerSecond > 0.) {
+      std::ostringstream items;
+      items << std::scientific << std::setprecision(3)
+            << result.itemsPerSecond;
+      out << items.str();
+    } else {
+      out << "-";
+    }
+    out << "\n";
+  }
+}
+
+/** Write results as xUnit XML. Each result is a test case of the class
+ * Benchmarks.<group> whose time is the mean time of one iteration, so that
+ * xunit_to_sql.py can add the results to the database that
+ * check_performance.py compares revisions with.
+ * @param out :: the stream to write to
+ * @param results :: the results to write
+ */
+void writeXUnit(std::ostream &out, const std::vector<Result> &results) {
+  out << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+      << "<testsuites>\n"
+      << "<testsuite name=\"Benchmarks\" tests=\"" << results.size()
+      << "\" failures=\"0\" errors=\"0\">\n";
+  out << std::setprecision(9);
+  for (const auto &result : results) {
+    out << "  <testcase classname=\"Benchmarks." << result.group
+        << "\" name=\"" << result.name
+        << "\" time=\"" << result.secondsPerIteration << "\" iterations=\""
+        << result.iterations << "\" itemsPerSecond=\""
+        << result.itemsPerSecond << "\"/>\n";
+  }
+  out << "</testsuite>\n"
+      << "</testsuites>\n";
+}
+
+} // namespace Benchmarks
+} // namespace Mantid
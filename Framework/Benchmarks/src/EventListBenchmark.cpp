@@ -0,0 +1,97 @@
+#include "MantidBenchmarks/Benchmark.h"
+#include "MantidDataObjects/EventList.h"
+#include "MantidTypes/Core/DateAndTime.h"
+
+#include <random>
+
+using Mantid::Benchmarks::State;
+using Mantid::DataObjects::EventList;
+using Mantid::Types::Core::DateAndTime;
+using Mantid::Types::Event::TofEvent;
+
+namespace {
+/// Number of bins of the histograms
+const size_t NUM_BINS = 2000;
+/// Largest time-of-flight of the events, in microseconds
+const double MAX_TOF = 20000.;
+
+/// @return events with random times-of-flight, from 10 pulses a second
+std::vector<TofEvent> makeEvents(int64_t numEvents) {
+  std::mt19937 generator(1);
+  std::uniform_real_distribution<double> tof(0., MAX_TOF);
+  const DateAndTime start("2010-01-01T00:00:00");
+  std::vector<TofEvent> events;
+  events.reserve(static_cast<size_t>(numEvents));
+  for (int64_t i = 0; i < numEvents; ++i)
+    events.emplace_back(tof(generator),
+                        start + 0.1 * static_cast<double>(i / 100));
+  return events;
+}
+
+/// @return evenly spaced bin edges covering all events
+Mantid::MantidVec makeBinEdges() {
+  Mantid::MantidVec edges(NUM_BINS + 1);
+  for (size_t i = 0; i <= NUM_BINS; ++i)
+    edges[i] = MAX_TOF * static_cast<double>(i) / NUM_BINS;
+  return edges;
+}
+
+void sortTof(State &state) {
+  const auto events = makeEvents(state.range());
+  while (state.keepRunning()) {
+    state.pauseTiming();
+    EventList list(events);
+    state.resumeTiming();
+    list.sortTof();
+  }
+  state.setItemsProcessed(state.iterations() * state.range());
+}
+
+void generateHistogram(State &state) {
+  EventList list(makeEvents(state.range()));
+  list.sortTof();
+  const auto edges = makeBinEdges();
+  Mantid::MantidVec counts;
+  Mantid::MantidVec errors;
+  while (state.keepRunning()) {
+    list.generateHistogram(edges, counts, errors);
+    Mantid::Benchmarks::doNotOptimize(counts.data());
+  }
+  state.setItemsProcessed(state.iterations() * state.range());
+}
+
+void generateHistogramUnsorted(State &state) {
+  const auto events = makeEvents(state.range());
+  const auto edges = makeBinEdges();
+  Mantid::MantidVec counts;
+  Mantid::MantidVec errors;
+  while (state.keepRunning()) {
+    state.pauseTiming();
+    EventList list(events);
+    state.resumeTiming();
+    list.generateHistogram(edges, counts, errors);
+    Mantid::Benchmarks::doNotOptimize(counts.data());
+  }
+  state.setItemsProcessed(state.iterations() * state.range());
+}
+
+void filterByPulseTime(State &state) {
+  const EventList list(makeEvents(state.range()));
+  // Keep the middle half of the run
+  const double runSeconds = 0.1 * static_cast<double>(state.range() / 100);
+  const DateAndTime runStart("2010-01-01T00:00:00");
+  const DateAndTime start = runStart + 0.25 * runSeconds;
+  const DateAndTime stop = runStart + 0.75 * runSeconds;
+  while (state.keepRunning()) {
+    EventList output;
+    list.filterByPulseTime(start, stop, output);
+    Mantid::Benchmarks::doNotOptimize(output.getNumberEvents());
+  }
+  state.setItemsProcessed(state.iterations() * state.range());
+}
+} // namespace
+
+MANTID_BENCHMARK(EventList, sortTof, 1000, 100000, 1000000);
+MANTID_BENCHMARK(EventList, generateHistogram, 1000, 100000, 1000000);
+MANTID_BENCHMARK(EventList, generateHistogramUnsorted, 1000, 100000, 1000000);
+MANTID_BENCHMARK(EventList, filterByPulseTime, 1000, 100000, 1000000);
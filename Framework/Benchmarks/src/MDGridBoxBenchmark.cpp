@@ -0,0 +1,94 @@
+#include "MantidBenchmarks/Benchmark.h"
+#include "MantidAPI/BoxController.h"
+#include "MantidDataObjects/MDBox.h"
+#include "MantidDataObjects/MDGridBox.h"
+#include "MantidDataObjects/MDLeanEvent.h"
+
+#include <memory>
+#include <random>
+
+using Mantid::API::BoxController;
+using Mantid::Benchmarks::State;
+using Mantid::coord_t;
+using namespace Mantid::DataObjects;
+
+namespace {
+using Event = MDLeanEvent<3>;
+using GridBox = MDGridBox<Event, 3>;
+
+/// Size of the box along each dimension
+const coord_t BOX_SIZE = 10.f;
+
+/// @return events at random positions in the box
+std::vector<Event> makeEvents(int64_t numEvents) {
+  std::mt19937 generator(1);
+  std::uniform_real_distribution<coord_t> position(0.f, BOX_SIZE);
+  std::vector<Event> events;
+  events.reserve(static_cast<size_t>(numEvents));
+  for (int64_t i = 0; i < numEvents; ++i) {
+    const coord_t centre[3] = {position(generator), position(generator),
+                               position(generator)};
+    events.emplace_back(1.f, 1.f, centre);
+  }
+  return events;
+}
+
+/// A box split 5 times along each dimension, as ConvertToMD makes by default
+struct Grid {
+  Grid() : controller(new BoxController(3)) {
+    controller->setSplitThreshold(1000);
+    controller->setSplitInto(5);
+    controller->setMaxDepth(20);
+    MDBox<Event, 3> top(controller.get());
+    for (size_t d = 0; d < 3; ++d)
+      top.setExtents(d, 0., BOX_SIZE);
+    top.calcVolume();
+    box.reset(new GridBox(&top));
+  }
+
+  std::unique_ptr<BoxController> controller;
+  /// Deleted before the box controller it refers to
+  std::unique_ptr<GridBox> box;
+};
+
+void addEvents(State &state) {
+  const auto events = makeEvents(state.range());
+  while (state.keepRunning()) {
+    state.pauseTiming();
+    Grid grid;
+    state.resumeTiming();
+    grid.box->addEvents(events);
+    state.pauseTiming();
+  }
+  state.setItemsProcessed(state.iterations() * state.range());
+}
+
+void addEventsThenSplit(State &state) {
+  const auto events = makeEvents(state.range());
+  while (state.keepRunning()) {
+    state.pauseTiming();
+    Grid grid;
+    state.resumeTiming();
+    grid.box->addEvents(events);
+    grid.box->splitAllIfNeeded(nullptr);
+    state.pauseTiming();
+  }
+  state.setItemsProcessed(state.iterations() * state.range());
+}
+
+void addEventsAndSplit(State &state) {
+  const auto events = makeEvents(state.range());
+  while (state.keepRunning()) {
+    state.pauseTiming();
+    Grid grid;
+    state.resumeTiming();
+    grid.box->addEventsAndSplit(events);
+    state.pauseTiming();
+  }
+  state.setItemsProcessed(state.iterations() * state.range());
+}
+} // namespace
+
+MANTID_BENCHMARK(MDGridBox, addEvents, 10000, 1000000);
+MANTID_BENCHMARK(MDGridBox, addEventsThenSplit, 10000, 1000000);
+MANTID_BENCHMARK(MDGridBox, addEventsAndSplit, 10000, 1000000);
@@ -0,0 +1,79 @@
+#include "MantidBenchmarks/Benchmark.h"
+#include "MantidGeometry/Objects/CompiledObject.h"
+#include "MantidGeometry/Objects/Object.h"
+#include "MantidGeometry/Objects/Track.h"
+#include "MantidGeometry/Surfaces/Surface.h"
+#include "MantidGeometry/Surfaces/SurfaceFactory.h"
+
+#include <map>
+#include <random>
+
+using Mantid::Benchmarks::State;
+using Mantid::Kernel::V3D;
+using namespace Mantid::Geometry;
+
+namespace {
+/// A can of radius 3 along x: a capped cylinder holding a sample
+Object makeCylinder() {
+  const std::map<int, std::string> definitions{
+      {31, "cx 3.0"}, {32, "px 1.2"}, {33, "px -3.2"}};
+  std::map<int, boost::shared_ptr<Surface>> surfaces;
+  for (const auto &definition : definitions) {
+    surfaces[definition.first] =
+        SurfaceFactory::Instance()->processLine(definition.second);
+    surfaces[definition.first]->setName(definition.first);
+  }
+  Object cylinder;
+  cylinder.setObject(21, "-31 -32 33");
+  cylinder.populate(surfaces);
+  return cylinder;
+}
+
+/// Tracks starting inside the cylinder in random directions, as the
+/// absorption corrections trace from scattering points
+void makeTracks(int64_t numTracks, std::vector<V3D> &starts,
+                std::vector<V3D> &directions) {
+  std::mt19937 generator(1);
+  std::uniform_real_distribution<double> position(-2., 1.);
+  std::normal_distribution<double> component;
+  for (int64_t i = 0; i < numTracks; ++i) {
+    starts.emplace_back(position(generator), position(generator) / 2.,
+                        position(generator) / 2.);
+    V3D direction(component(generator), component(generator),
+                  component(generator));
+    direction.normalize();
+    directions.push_back(direction);
+  }
+}
+
+void interceptSurface(State &state) {
+  const auto cylinder = makeCylinder();
+  std::vector<V3D> starts, directions;
+  makeTracks(state.range(), starts, directions);
+  while (state.keepRunning()) {
+    for (size_t i = 0; i < starts.size(); ++i) {
+      Track track(starts[i], directions[i]);
+      cylinder.interceptSurface(track);
+      Mantid::Benchmarks::doNotOptimize(track.count());
+    }
+  }
+  state.setItemsProcessed(state.iterations() * state.range());
+}
+
+void compiledTrace(State &state) {
+  const auto cylinder = makeCylinder();
+  const auto compiled = CompiledObject::compile(cylinder);
+  std::vector<V3D> starts, directions;
+  makeTracks(state.range(), starts, directions);
+  std::vector<CompiledObject::Segments> segments(starts.size());
+  while (state.keepRunning()) {
+    compiled->trace(starts.data(), directions.data(), starts.size(),
+                    segments.data());
+    Mantid::Benchmarks::doNotOptimize(segments.data());
+  }
+  state.setItemsProcessed(state.iterations() * state.range());
+}
+} // namespace
+
+MANTID_BENCHMARK(Object, interceptSurface, 1000, 100000);
+MANTID_BENCHMARK(Object, compiledTrace, 1000, 100000);
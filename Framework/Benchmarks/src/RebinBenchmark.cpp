@@ -0,0 +1,78 @@
+#include "MantidBenchmarks/Benchmark.h"
+#include "MantidHistogramData/Histogram.h"
+#include "MantidHistogramData/LinearGenerator.h"
+#include "MantidHistogramData/Rebin.h"
+#include "MantidKernel/VectorHelper.h"
+
+#include <cmath>
+#include <random>
+
+using Mantid::Benchmarks::State;
+using namespace Mantid::HistogramData;
+
+namespace {
+/// Histogram of random counts in numBins bins of width 1
+Histogram makeHistogram(int64_t numBins) {
+  std::mt19937 generator(1);
+  std::uniform_real_distribution<double> count(0., 100.);
+  const auto n = static_cast<size_t>(numBins);
+  Counts counts(n);
+  for (auto &value : counts.mutableRawData())
+    value = count(generator);
+  CountStandardDeviations errors(n);
+  for (size_t i = 0; i < n; ++i)
+    errors.mutableRawData()[i] = std::sqrt(counts[i]);
+  return Histogram(BinEdges(n + 1, LinearGenerator(0., 1.)), std::move(counts),
+                   std::move(errors));
+}
+
+/// Edges of bins 2.5 times as wide, offset from the input edges
+BinEdges makeOutputEdges(int64_t numBins) {
+  const auto n = static_cast<size_t>(numBins);
+  return BinEdges(n * 2 / 5, LinearGenerator(0.3, 2.5));
+}
+
+void histogramRebin(State &state) {
+  const auto input = makeHistogram(state.range());
+  const auto edges = makeOutputEdges(state.range());
+  while (state.keepRunning()) {
+    auto output = rebin(input, edges);
+    Mantid::Benchmarks::doNotOptimize(output.y().rawData().data());
+  }
+  state.setItemsProcessed(state.iterations() * state.range());
+}
+
+void vectorHelperRebin(State &state) {
+  const auto input = makeHistogram(state.range());
+  const auto edges = makeOutputEdges(state.range());
+  const auto &xNew = edges.rawData();
+  std::vector<double> yNew(xNew.size() - 1);
+  std::vector<double> eNew(xNew.size() - 1);
+  while (state.keepRunning()) {
+    Mantid::Kernel::VectorHelper::rebin(
+        input.x().rawData(), input.y().rawData(), input.e().rawData(), xNew,
+        yNew, eNew, false);
+    Mantid::Benchmarks::doNotOptimize(yNew.data());
+  }
+  state.setItemsProcessed(state.iterations() * state.range());
+}
+
+void vectorHelperRebinHistogram(State &state) {
+  const auto input = makeHistogram(state.range());
+  const auto edges = makeOutputEdges(state.range());
+  const auto &xNew = edges.rawData();
+  std::vector<double> yNew(xNew.size() - 1);
+  std::vector<double> eNew(xNew.size() - 1);
+  while (state.keepRunning()) {
+    Mantid::Kernel::VectorHelper::rebinHistogram(
+        input.x().rawData(), input.y().rawData(), input.e().rawData(), xNew,
+        yNew, eNew, false);
+    Mantid::Benchmarks::doNotOptimize(yNew.data());
+  }
+  state.setItemsProcessed(state.iterations() * state.range());
+}
+} // namespace
+
+MANTID_BENCHMARK(Rebin, histogramRebin, 100, 10000, 1000000);
+MANTID_BENCHMARK(Rebin, vectorHelperRebin, 100, 10000, 1000000);
+MANTID_BENCHMARK(Rebin, vectorHelperRebinHistogram, 100, 10000, 1000000);
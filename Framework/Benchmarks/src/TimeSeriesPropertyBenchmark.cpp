@@ -0,0 +1,91 @@
+#include "MantidBenchmarks/Benchmark.h"
+#include "MantidKernel/TimeSeriesProperty.h"
+#include "MantidKernel/TimeSplitter.h"
+
+#include <cmath>
+
+using Mantid::Benchmarks::State;
+using Mantid::Kernel::SplittingInterval;
+using Mantid::Kernel::TimeSeriesProperty;
+using Mantid::Types::Core::DateAndTime;
+
+namespace {
+const DateAndTime RUN_START("2010-01-01T00:00:00");
+
+/// A log of numValues values a second apart, oscillating between -1 and 1
+TimeSeriesProperty<double> makeLog(int64_t numValues) {
+  const auto n = static_cast<size_t>(numValues);
+  std::vector<DateAndTime> times(n);
+  std::vector<double> values(n);
+  for (size_t i = 0; i < n; ++i) {
+    times[i] = RUN_START + static_cast<double>(i);
+    values[i] = std::sin(0.01 * static_cast<double>(i));
+  }
+  TimeSeriesProperty<double> log("log");
+  log.addValues(times, values);
+  return log;
+}
+
+/// A filter switching every 10 seconds
+TimeSeriesProperty<bool> makeFilter(int64_t numValues) {
+  TimeSeriesProperty<bool> filter("filter");
+  for (int64_t i = 0; i < numValues; i += 10)
+    filter.addValue(RUN_START + static_cast<double>(i), (i / 10) % 2 == 0);
+  return filter;
+}
+
+void filterWith(State &state) {
+  const auto log = makeLog(state.range());
+  const auto filter = makeFilter(state.range());
+  while (state.keepRunning()) {
+    state.pauseTiming();
+    TimeSeriesProperty<double> filtered(log);
+    state.resumeTiming();
+    filtered.filterWith(&filter);
+    Mantid::Benchmarks::doNotOptimize(filtered.size());
+  }
+  state.setItemsProcessed(state.iterations() * state.range());
+}
+
+void filteredTimeAverageValue(State &state) {
+  auto log = makeLog(state.range());
+  const auto filter = makeFilter(state.range());
+  log.filterWith(&filter);
+  while (state.keepRunning())
+    Mantid::Benchmarks::doNotOptimize(log.timeAverageValue());
+  state.setItemsProcessed(state.iterations() * state.range());
+}
+
+void makeFilterByValue(State &state) {
+  const auto log = makeLog(state.range());
+  std::vector<SplittingInterval> splitter;
+  while (state.keepRunning()) {
+    splitter.clear();
+    log.makeFilterByValue(splitter, 0., 0.5);
+    Mantid::Benchmarks::doNotOptimize(splitter.data());
+  }
+  state.setItemsProcessed(state.iterations() * state.range());
+}
+
+void filterByTime(State &state) {
+  const auto log = makeLog(state.range());
+  // Keep the middle half of the run
+  const double runSeconds = static_cast<double>(state.range());
+  const DateAndTime start = RUN_START + 0.25 * runSeconds;
+  const DateAndTime stop = RUN_START + 0.75 * runSeconds;
+  while (state.keepRunning()) {
+    state.pauseTiming();
+    TimeSeriesProperty<double> filtered(log);
+    state.resumeTiming();
+    filtered.filterByTime(start, stop);
+    Mantid::Benchmarks::doNotOptimize(filtered.size());
+  }
+  state.setItemsProcessed(state.iterations() * state.range());
+}
+} // namespace
+
+MANTID_BENCHMARK(TimeSeriesProperty, filterWith, 1000, 100000, 1000000);
+MANTID_BENCHMARK(TimeSeriesProperty, filteredTimeAverageValue, 1000, 100000,
+                 1000000);
+MANTID_BENCHMARK(TimeSeriesProperty, makeFilterByValue, 1000, 100000, 1000000);
+MANTID_BENCHMARK(TimeSeriesProperty, filterByTime, 1000, 100000, 1000000);
@@ -0,0 +1,79 @@
+#include "MantidBenchmarks/Benchmark.h"
+
+#include <boost/regex.hpp>
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+using namespace Mantid::Benchmarks;
+
+namespace {
+void printUsage(const char *program) {
+  std::cout
+      << "Usage: " << program << " [options]\n\n"
+      << "Runs the micro-benchmarks of the framework.\n\n"
+      << "Options:\n"
+      << "  --filter REGEX    run the benchmarks whose group.name/range "
+         "matches\n"
+      << "  --min-time SECS   time each benchmark for at least SECS seconds "
+         "(default 0.5)\n"
+      << "  --xml FILE        also write the results as xUnit XML, for\n"
+      << "                    Testing/PerformanceTests/xunit_to_sql.py\n"
+      << "  --list            list the benchmarks without running them\n";
+}
+} // namespace
+
+int main(int argc, char *argv[]) {
+  std::string filter(".*");
+  std::string xmlFile;
+  double minSeconds = 0.5;
+  bool listOnly = false;
+  for (int i = 1; i < argc; ++i) {
+    const std::string arg(argv[i]);
+    const bool hasValue = i + 1 < argc;
+    if (arg == "--filter" && hasValue) {
+      filter = argv[++i];
+    } else if (arg == "--min-time" && hasValue) {
+      minSeconds = std::atof(argv[++i]);
+    } else if (arg == "--xml" && hasValue) {
+      xmlFile = argv[++i];
+    } else if (arg == "--list") {
+      listOnly = true;
+    } else {
+      printUsage(argv[0]);
+      return arg == "--help" || arg == "-h" ? 0 : 1;
+    }
+  }
+
+  const boost::regex pattern(filter);
+  std::vector<Result> results;
+  for (const auto &benchmark : registeredBenchmarks()) {
+    for (const auto range : benchmark.ranges) {
+      const std::string fullName = benchmark.group + "." + benchmark.name +
+                                   "/" + std::to_string(range);
+      if (!boost::regex_search(fullName, pattern))
+        continue;
+      if (listOnly) {
+        std::cout << fullName << "\n";
+        continue;
+      }
+      results.push_back(run(benchmark, range, minSeconds));
+      std::cerr << "Ran " << fullName << "\n";
+    }
+  }
+  if (listOnly)
+    return 0;
+
+  writeTable(std::cout, results);
+  if (!xmlFile.empty()) {
+    std::ofstream xml(xmlFile.c_str());
+    writeXUnit(xml, results);
+    if (!xml) {
+      std::cerr << "Cannot write " << xmlFile << "\n";
+      return 1;
+    }
+  }
+  return 0;
+}
@@ -263,7 +263,8 @@ void PredictPeaks::exec() {
   prog.setNotifyStep(0.01);
 
   m_detectorCacheSearch =
-      Kernel::make_unique<DetectorSearcher>(m_inst, m_pw->detectorInfo());
+      Kernel::make_unique<DetectorSearcher>(m_inst, m_pw->componentInfo(),
+                                            m_pw->detectorInfo());
 
   for (auto &goniometerMatrix : gonioVec) {
     // Final transformation matrix (HKL to Q in lab frame)
@@ -3,6 +3,7 @@
 
 #include "MantidDataHandling/DllConfig.h"
 #include "MantidDataHandling/EventWorkspaceCollection.h"
+#include "MantidDataHandling/PipelineBlockLimit.h"
 #include "MantidAPI/Axis.h"
 
 class BankPulseTimes;
@@ -43,7 +44,12 @@ public:
        bool event_id_is_spec, std::vector<std::string> bankNames,
        const std::vector<int> &periodLog, const std::string &classType,
        std::vector<std::size_t> bankNumEvents, const bool oldNeXusFileNames,
-       const bool precount, const int chunk, const int totalChunks);
+       const bool precount, const bool pipelined,
+       const std::size_t pipelineBlockSize, const int chunk,
+       const int totalChunks);
+
+  /// Default number of events read at a time from a bank when pipelining
+  static const std::size_t DEFAULT_PIPELINE_BLOCK_SIZE = 4 * 1024 * 1024;
 
   /// Flag for dealing with a simulated file
   bool m_haveWeights;
@@ -57,6 +63,19 @@ public:
   /// Do we pre-count the # of events in each pixel ID?
   bool precount;
 
+  /// Are banks read in blocks, each processed while the next one is read?
+  bool pipelined;
+
+  /// Number of events read at a time from a bank when pipelining
+  std::size_t pipelineBlockSize;
+
+  /// Limit on the blocks that are read but not yet processed when pipelining
+  PipelineBlockLimit pipelineBlockLimit;
+
+  /// Number of slices of pixel IDs processed in parallel for each bank when
+  /// pipelining
+  std::size_t pipelineSlicesPerBank;
+
   /// Offset in the pixelID_to_wi_vector to use.
   detid_t pixelID_to_wi_offset;
 
@@ -96,6 +115,7 @@ private:
   DefaultEventLoader(LoadEventNexus *alg, EventWorkspaceCollection &ws,
                      bool haveWeights, bool event_id_is_spec,
                      const size_t numBanks, const bool precount,
+                     const bool pipelined, const std::size_t pipelineBlockSize,
                      const int chunk, const int totalChunks);
   std::pair<size_t, size_t>
   setupChunking(std::vector<std::string> &bankNames,
@@ -103,6 +123,7 @@ private:
   /// Map detector IDs to event lists.
   template <class T>
   void makeMapToEventLists(std::vector<std::vector<T>> &vectors);
+  void compressEvents();
 };
 
 /** Generate a look-up table where the index = the pixel ID of an event
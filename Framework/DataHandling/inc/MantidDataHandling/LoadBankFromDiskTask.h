@@ -57,9 +57,15 @@ private:
   void loadEventIndex(::NeXus::File &file, std::vector<uint64_t> &event_index);
   void prepareEventId(::NeXus::File &file, size_t &start_event,
                       size_t &stop_event, std::vector<uint64_t> &event_index);
+  void openEventId(::NeXus::File &file);
   void loadEventId(::NeXus::File &file);
   void loadTof(::NeXus::File &file);
   void loadEventWeights(::NeXus::File &file);
+  void loadEvents(::NeXus::File &file, const size_t start, const size_t size);
+  void scheduleProcessing(
+      const boost::shared_ptr<std::vector<uint64_t>> &event_index,
+      const boost::shared_ptr<void> &blockSlot);
+  void makeSlices();
   int64_t recalculateDataSize(const int64_t &size);
 
   /// Algorithm being run
@@ -96,6 +102,10 @@ private:
   float *m_event_weight;
   /// Frame period numbers
   const std::vector<int> m_framePeriodNumbers;
+  /// First pixel ID of each slice of the bank when pipelining
+  std::vector<uint32_t> m_sliceStarts;
+  /// Mutexes of the tasks processing each slice of the bank when pipelining
+  std::vector<boost::shared_ptr<std::mutex>> m_sliceMutexes;
 }; // END-DEF-CLASS LoadBankFromDiskTask
 
 } // namespace DataHandling
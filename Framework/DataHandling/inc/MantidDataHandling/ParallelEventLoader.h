@@ -13,9 +13,10 @@ class EventWorkspace;
 namespace DataHandling {
 
 /** Loader for event data from Nexus files with parallelism based on multiple
-  processes (MPI) for performance. This class provides integration of the low
-  level loader component Parallel::IO::EventLoader with higher level concepts
-  such as DataObjects::EventWorkspace and the instrument.
+  processes (MPI) for performance, or on multiple threads if the workspace is
+  not distributed. This class provides integration of the low level loader
+  component Parallel::IO::EventLoader with higher level concepts such as
+  DataObjects::EventWorkspace and the instrument.
 
   @author Simon Heybrock
   @date 2017
@@ -0,0 +1,72 @@
+#ifndef MANTID_DATAHANDLING_PIPELINEBLOCKLIMIT_H_
+#define MANTID_DATAHANDLING_PIPELINEBLOCKLIMIT_H_
+
+#include "MantidDataHandling/DllConfig.h"
+
+#include <boost/shared_ptr.hpp>
+
+#include <atomic>
+#include <cstddef>
+
+namespace Mantid {
+namespace DataHandling {
+
+/** Limits the number of blocks of events that a pipelined LoadEventNexus has
+  read but not yet processed, so that the memory they hold stays bounded when
+  the events are processed more slowly than they are read.
+
+  A block takes a slot with tryAcquire(). The slot is given back when the last
+  copy of the returned pointer is destroyed, which is when the last task
+  processing the block is done with it.
+
+  Copyright &copy; 2017 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+class MANTID_DATAHANDLING_DLL PipelineBlockLimit {
+public:
+  explicit PipelineBlockLimit(const std::size_t maxBlocks);
+  PipelineBlockLimit(const PipelineBlockLimit &) = delete;
+  PipelineBlockLimit &operator=(const PipelineBlockLimit &) = delete;
+
+  boost::shared_ptr<void> tryAcquire();
+
+  /// @return the number of blocks that may be in flight at once
+  std::size_t maxBlocks() const { return m_maxBlocks; }
+  /// @return the number of blocks in flight
+  std::size_t blocks() const { return m_blocks; }
+  /// @return the most blocks that were in flight at once
+  std::size_t peakBlocks() const { return m_peakBlocks; }
+
+private:
+  void release();
+
+  /// Number of blocks that may be in flight at once
+  const std::size_t m_maxBlocks;
+  /// Number of blocks in flight
+  std::atomic<std::size_t> m_blocks;
+  /// Most blocks that were in flight at once
+  std::atomic<std::size_t> m_peakBlocks;
+};
+
+} // namespace DataHandling
+} // namespace Mantid
+
+#endif /* MANTID_DATAHANDLING_PIPELINEBLOCKLIMIT_H_ */
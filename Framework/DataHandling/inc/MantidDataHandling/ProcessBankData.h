@@ -45,6 +45,9 @@ public:
 
   void run() override;
 
+  /// Hold a slot of the pipelined block being processed until this task ends
+  void setBlockSlot(const boost::shared_ptr<void> &slot) { m_blockSlot = slot; }
+
 private:
   size_t getWorkspaceIndexFromPixelID(const detid_t pixID);
 
@@ -81,6 +84,8 @@ private:
   detid_t m_max_id;
   /// timer for performance
   Mantid::Kernel::Timer m_timer;
+  /// slot of the block in DefaultEventLoader::pipelineBlockLimit, if any
+  boost::shared_ptr<void> m_blockSlot;
 }; // ENDDEF-CLASS ProcessBankData
 }
 }
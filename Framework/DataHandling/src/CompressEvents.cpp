@@ -7,6 +7,7 @@
 #include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/DateAndTimeHelpers.h"
 #include "MantidKernel/DateTimeValidator.h"
+#include "MantidKernel/TaskRuntime.h"
 
 #include "tbb/parallel_for.h"
 
@@ -88,49 +89,52 @@ void CompressEvents::exec() {
   if (!compressFat)
     inputWS->sortAll(TOF_SORT, &prog);
 
-  // Are we making a copy of the input workspace?
-  if (!inplace) {
-    outputWS = create<EventWorkspace>(*inputWS, HistogramData::BinEdges(2));
-    // We DONT copy the data though
-    // Loop over the histograms (detector spectra)
-    tbb::parallel_for(
-        tbb::blocked_range<size_t>(0, noSpectra),
-        [compressFat, toleranceTof, startTime, toleranceWallClock, &inputWS,
-         &outputWS, &prog](const tbb::blocked_range<size_t> &range) {
-          for (size_t index = range.begin(); index < range.end(); ++index) {
-            // The input event list
-            EventList &input_el = inputWS->getSpectrum(index);
-            // And on the output side
-            EventList &output_el = outputWS->getSpectrum(index);
-            // Copy other settings into output
-            output_el.setX(input_el.ptrX());
-            // The EventList method does the work.
-            if (compressFat)
-              input_el.compressFatEvents(toleranceTof, startTime,
-                                         toleranceWallClock, &output_el);
-            else
-              input_el.compressEvents(toleranceTof, &output_el);
-            prog.report("Compressing");
-          }
-        });
-  } else { // inplace
-    tbb::parallel_for(
-        tbb::blocked_range<size_t>(0, noSpectra),
-        [compressFat, toleranceTof, startTime, toleranceWallClock, &outputWS,
-         &prog](const tbb::blocked_range<size_t> &range) {
-          for (size_t index = range.begin(); index < range.end(); ++index) {
-            // The input (also output) event list
-            auto &output_el = outputWS->getSpectrum(index);
-            // The EventList method does the work.
-            if (compressFat)
-              output_el.compressFatEvents(toleranceTof, startTime,
-                                          toleranceWallClock, &output_el);
-            else
-              output_el.compressEvents(toleranceTof, &output_el);
-            prog.report("Compressing");
-          }
-        });
-  }
+  // Run the loops within the framework-wide thread limit
+  Kernel::TaskRuntime::execute([&]() {
+    // Are we making a copy of the input workspace?
+    if (!inplace) {
+      outputWS = create<EventWorkspace>(*inputWS, HistogramData::BinEdges(2));
+      // We DONT copy the data though
+      // Loop over the histograms (detector spectra)
+      tbb::parallel_for(
+          tbb::blocked_range<size_t>(0, noSpectra),
+          [compressFat, toleranceTof, startTime, toleranceWallClock, &inputWS,
+           &outputWS, &prog](const tbb::blocked_range<size_t> &range) {
+            for (size_t index = range.begin(); index < range.end(); ++index) {
+              // The input event list
+              EventList &input_el = inputWS->getSpectrum(index);
+              // And on the output side
+              EventList &output_el = outputWS->getSpectrum(index);
+              // Copy other settings into output
+              output_el.setX(input_el.ptrX());
+              // The EventList method does the work.
+              if (compressFat)
+                input_el.compressFatEvents(toleranceTof, startTime,
+                                           toleranceWallClock, &output_el);
+              else
+                input_el.compressEvents(toleranceTof, &output_el);
+              prog.report("Compressing");
+            }
+          });
+    } else { // inplace
+      tbb::parallel_for(
+          tbb::blocked_range<size_t>(0, noSpectra),
+          [compressFat, toleranceTof, startTime, toleranceWallClock, &outputWS,
+           &prog](const tbb::blocked_range<size_t> &range) {
+            for (size_t index = range.begin(); index < range.end(); ++index) {
+              // The input (also output) event list
+              auto &output_el = outputWS->getSpectrum(index);
+              // The EventList method does the work.
+              if (compressFat)
+                output_el.compressFatEvents(toleranceTof, startTime,
+                                            toleranceWallClock, &output_el);
+              else
+                output_el.compressEvents(toleranceTof, &output_el);
+              prog.report("Compressing");
+            }
+          });
+    }
+  });
 
   // Cast to the matrixOutputWS and save it
   this->setProperty("OutputWorkspace", outputWS);
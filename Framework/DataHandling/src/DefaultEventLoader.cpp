@@ -4,6 +4,7 @@
 #include "MantidAPI/Progress.h"
 #include "MantidKernel/ThreadPool.h"
 #include "MantidKernel/ThreadSchedulerMutexes.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/make_unique.h"
 
 using namespace Mantid::Kernel;
@@ -11,6 +12,11 @@ using namespace Mantid::Kernel;
 namespace Mantid {
 namespace DataHandling {
 
+namespace {
+/// Blocks that may be read but not yet processed for each processing thread
+const std::size_t PIPELINE_BLOCKS_PER_CORE = 2;
+}
+
 void DefaultEventLoader::load(LoadEventNexus *alg, EventWorkspaceCollection &ws,
                               bool haveWeights, bool event_id_is_spec,
                               std::vector<std::string> bankNames,
@@ -18,9 +24,12 @@ void DefaultEventLoader::load(LoadEventNexus *alg, EventWorkspaceCollection &ws,
                               const std::string &classType,
                               std::vector<std::size_t> bankNumEvents,
                               const bool oldNeXusFileNames, const bool precount,
+                              const bool pipelined,
+                              const std::size_t pipelineBlockSize,
                               const int chunk, const int totalChunks) {
   DefaultEventLoader loader(alg, ws, haveWeights, event_id_is_spec,
-                            bankNames.size(), precount, chunk, totalChunks);
+                            bankNames.size(), precount, pipelined,
+                            pipelineBlockSize, chunk, totalChunks);
 
   auto bankRange = loader.setupChunking(bankNames, bankNumEvents);
 
@@ -33,6 +42,16 @@ void DefaultEventLoader::load(LoadEventNexus *alg, EventWorkspaceCollection &ws,
   size_t numProg = bankNames.size() * (1 + 3); // 1 = disktask, 3 = proc task
   if (loader.splitProcessing)
     numProg += bankNames.size() * 3; // 3 = second proc task
+  if (loader.pipelined) {
+    // 3 = proc task for every slice of every block, at most
+    for (size_t i = bankRange.first; i < bankRange.second; i++) {
+      const size_t numBlocks =
+          (bankNumEvents[i] + loader.pipelineBlockSize - 1) /
+          loader.pipelineBlockSize;
+      if (numBlocks > 0)
+        numProg += 3 * (numBlocks * loader.pipelineSlicesPerBank - 1);
+    }
+  }
   auto prog = Kernel::make_unique<API::Progress>(loader.alg, 0.3, 1.0, numProg);
 
   for (size_t i = bankRange.first; i < bankRange.second; i++) {
@@ -44,17 +63,35 @@ void DefaultEventLoader::load(LoadEventNexus *alg, EventWorkspaceCollection &ws,
   // Start and end all threads
   pool.joinAll();
   diskIOMutex.reset();
+
+  if (loader.pipelined)
+    alg->getLogger().debug()
+        << "Pipelined loading held at most "
+        << loader.pipelineBlockLimit.peakBlocks() << " of "
+        << loader.pipelineBlockLimit.maxBlocks()
+        << " blocks of events in memory\n";
+
+  // The event lists of a bank are filled by all of its blocks, so the events
+  // can only be compressed once all of them are in
+  if (loader.pipelined && alg->compressTolerance >= 0)
+    loader.compressEvents();
 }
 
 DefaultEventLoader::DefaultEventLoader(LoadEventNexus *alg,
                                        EventWorkspaceCollection &ws,
                                        bool haveWeights, bool event_id_is_spec,
                                        const size_t numBanks,
-                                       const bool precount, const int chunk,
-                                       const int totalChunks)
+                                       const bool precount,
+                                       const bool pipelined,
+                                       const std::size_t pipelineBlockSize,
+                                       const int chunk, const int totalChunks)
     : m_haveWeights(haveWeights), event_id_is_spec(event_id_is_spec),
-      precount(precount), chunk(chunk), totalChunks(totalChunks), alg(alg),
-      m_ws(ws) {
+      precount(precount), pipelined(pipelined),
+      pipelineBlockSize(pipelineBlockSize),
+      pipelineBlockLimit(PIPELINE_BLOCKS_PER_CORE *
+                         ThreadPool::getNumPhysicalCores()),
+      pipelineSlicesPerBank(ThreadPool::getNumPhysicalCores()), chunk(chunk),
+      totalChunks(totalChunks), alg(alg), m_ws(ws) {
   // This map will be used to find the workspace index
   if (event_id_is_spec)
     pixelID_to_wi_vector =
@@ -75,8 +112,23 @@ DefaultEventLoader::DefaultEventLoader(LoadEventNexus *alg,
   }
 
   // split banks up if the number of cores is more than twice the number of
-  // banks
-  splitProcessing = bool(numBanks * 2 < ThreadPool::getNumPhysicalCores());
+  // banks. When pipelining, the blocks of a bank already run in parallel with
+  // the reading of the next one.
+  splitProcessing =
+      !pipelined && bool(numBanks * 2 < ThreadPool::getNumPhysicalCores());
+}
+
+/// Compress the events of all non-empty event lists, in parallel
+void DefaultEventLoader::compressEvents() {
+  const auto numHistograms = static_cast<int64_t>(m_ws.getNumberHistograms());
+  for (size_t period = 0; period < m_ws.nPeriods(); ++period) {
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int64_t i = 0; i < numHistograms; ++i) {
+      auto &el = m_ws.getSpectrum(static_cast<size_t>(i), period);
+      if (el.getNumberEvents() > 0)
+        el.compressEvents(alg->compressTolerance, &el);
+    }
+  }
 }
 
 std::pair<size_t, size_t>
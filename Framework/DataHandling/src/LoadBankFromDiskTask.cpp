@@ -4,6 +4,9 @@
 #include "MantidDataHandling/LoadEventNexus.h"
 #include "MantidDataHandling/ProcessBankData.h"
 
+#include <algorithm>
+#include <memory>
+
 namespace Mantid {
 namespace DataHandling {
 
@@ -118,10 +121,7 @@ void LoadBankFromDiskTask::prepareEventId(::NeXus::File &file,
                                           size_t &stop_event,
                                           std::vector<uint64_t> &event_index) {
   // Get the list of pixel ID's
-  if (m_oldNexusFileNames)
-    file.openData("event_pixel_id");
-  else
-    file.openData("event_id");
+  this->openEventId(file);
 
   // By default, use all available indices
   start_event = 0;
@@ -177,9 +177,24 @@ void LoadBankFromDiskTask::prepareEventId(::NeXus::File &file,
                                     << stop_event << "\n";
 }
 
+/** Open the event_id field
+*
+* @param file :: File handle for the NeXus file
+*/
+void LoadBankFromDiskTask::openEventId(::NeXus::File &file) {
+  if (m_oldNexusFileNames)
+    file.openData("event_pixel_id");
+  else
+    file.openData("event_id");
+}
+
 /** Load the event_id field, which has been open
 */
 void LoadBankFromDiskTask::loadEventId(::NeXus::File &file) {
+  // The range of pixel ids is found for each load
+  m_min_id = std::numeric_limits<uint32_t>::max();
+  m_max_id = 0;
+
   // This is the data size
   ::NeXus::Info id_info = file.getInfo();
   int64_t dim0 = recalculateDataSize(id_info.dims[0]);
@@ -220,12 +235,6 @@ void LoadBankFromDiskTask::loadEventId(::NeXus::File &file) {
         m_max_id = temp;
     }
 
-    if (m_min_id > static_cast<uint32_t>(m_loader.eventid_max)) {
-      // All the detector IDs in the bank are higher than the highest 'known'
-      // (from the IDF)
-      // ID. Setting this will abort the loading of the bank.
-      m_loadError = true;
-    }
     // fixup the minimum pixel id in the case that it's lower than the lowest
     // 'known' id. We test this by checking that when we add the offset we
     // would not get a negative index into the vector. Note that m_min_id is
@@ -333,8 +342,7 @@ void LoadBankFromDiskTask::loadEventWeights(::NeXus::File &file) {
 
 void LoadBankFromDiskTask::run() {
   // The vectors we will be filling
-  auto event_index_ptr = new std::vector<uint64_t>();
-  std::vector<uint64_t> &event_index = *event_index_ptr;
+  auto event_index = boost::make_shared<std::vector<uint64_t>>();
 
   // These give the limits in each file as to which events we actually load
   // (when filtering by time).
@@ -360,7 +368,7 @@ void LoadBankFromDiskTask::run() {
     file.openGroup(entry_name, entry_type);
 
     // Load the event_index field.
-    this->loadEventIndex(file, event_index);
+    this->loadEventIndex(file, *event_index);
 
     if (!m_loadError) {
       // Load and validate the pulse times
@@ -368,7 +376,7 @@ void LoadBankFromDiskTask::run() {
 
       // The event_index should be the same length as the pulse times from DAS
       // logs.
-      if (event_index.size() != thisBankPulseTimes->numPulses)
+      if (event_index->size() != thisBankPulseTimes->numPulses)
         m_loader.alg->getLogger().warning()
             << "Bank " << entry_name
             << " has a mismatch between the number of event_index entries "
@@ -377,31 +385,28 @@ void LoadBankFromDiskTask::run() {
       // Open and validate event_id field.
       size_t start_event = 0;
       size_t stop_event = 0;
-      this->prepareEventId(file, start_event, stop_event, event_index);
-
-      // These are the arguments to getSlab()
-      m_loadStart[0] = static_cast<int>(start_event);
-      m_loadSize[0] = static_cast<int>(stop_event - start_event);
-
-      if ((m_loadSize[0] > 0) && (m_loadStart[0] >= 0)) {
-        // Load pixel IDs
-        this->loadEventId(file);
-        if (m_loader.alg->getCancel())
-          m_loadError = true; // To allow cancelling the algorithm
-
-        // And TOF.
-        if (!m_loadError) {
-          this->loadTof(file);
-          if (m_have_weight) {
-            this->loadEventWeights(file);
-          }
+      this->prepareEventId(file, start_event, stop_event, *event_index);
+
+      if (m_loader.pipelined) {
+        // Process each block while the next one is read. When too many
+        // blocks wait to be processed, process this one here instead of
+        // reading more.
+        const size_t maxBlockSize = m_loader.pipelineBlockSize;
+        for (size_t blockStart = start_event;
+             blockStart < stop_event && !m_loadError;
+             blockStart += maxBlockSize) {
+          const size_t blockSize =
+              std::min(stop_event - blockStart, maxBlockSize);
+          if (blockStart != start_event)
+            this->openEventId(file);
+          this->loadEvents(file, blockStart, blockSize);
+          if (!m_loadError)
+            this->scheduleProcessing(
+                event_index, m_loader.pipelineBlockLimit.tryAcquire());
         }
-      } // Size is at least 1
-      else {
-        // Found a size that was 0 or less; stop processing
-        m_loadError = true;
+      } else {
+        this->loadEvents(file, start_event, stop_event - start_event);
       }
-
     } // no error
 
   } // try block
@@ -427,8 +432,68 @@ void LoadBankFromDiskTask::run() {
     if (m_have_weight) {
       delete[] m_event_weight;
     }
-    delete event_index_ptr;
+    return;
+  }
 
+  if (!m_loader.pipelined)
+    this->scheduleProcessing(event_index, boost::shared_ptr<void>());
+}
+
+/** Load the pixel IDs, times-of-flight and weights of a range of events. The
+* event_id field must be open.
+*
+* @param file :: File handle for the NeXus file
+* @param start :: index of the first event to load
+* @param size :: number of events to load
+*/
+void LoadBankFromDiskTask::loadEvents(::NeXus::File &file, const size_t start,
+                                      const size_t size) {
+  // These are the arguments to getSlab()
+  m_loadStart[0] = static_cast<int>(start);
+  m_loadSize[0] = static_cast<int>(size);
+
+  if ((m_loadSize[0] > 0) && (m_loadStart[0] >= 0)) {
+    // Load pixel IDs
+    this->loadEventId(file);
+    if (m_loader.alg->getCancel())
+      m_loadError = true; // To allow cancelling the algorithm
+
+    // And TOF.
+    if (!m_loadError) {
+      this->loadTof(file);
+      if (m_have_weight) {
+        this->loadEventWeights(file);
+      }
+    }
+  } // Size is at least 1
+  else {
+    // Found a size that was 0 or less; stop processing
+    m_loadError = true;
+  }
+}
+
+/** Launch the tasks that put the loaded events into the event lists. The
+* loaded arrays are handed over to the tasks.
+*
+* @param event_index :: the event_index field of the bank
+* @param blockSlot :: slot of a pipelined block in
+* DefaultEventLoader::pipelineBlockLimit, held until the block is processed.
+* If it is empty, a pipelined block is processed in this thread.
+*/
+void LoadBankFromDiskTask::scheduleProcessing(
+    const boost::shared_ptr<std::vector<uint64_t>> &event_index,
+    const boost::shared_ptr<void> &blockSlot) {
+  // convert things to shared_arrays
+  boost::shared_array<uint32_t> event_id_shrd(m_event_id);
+  boost::shared_array<float> event_time_of_flight_shrd(m_event_time_of_flight);
+  boost::shared_array<float> event_weight_shrd(m_event_weight);
+  m_event_id = nullptr;
+  m_event_time_of_flight = nullptr;
+  m_event_weight = nullptr;
+
+  if (m_min_id > static_cast<uint32_t>(m_loader.eventid_max)) {
+    // All the detector IDs loaded are higher than the highest 'known' (from
+    // the IDF) ID.
     return;
   }
 
@@ -462,6 +527,42 @@ void LoadBankFromDiskTask::run() {
     return;
   }
 
+  // No error? Launch a new task to process that data.
+  size_t numEvents = m_loadSize[0];
+  size_t startAt = m_loadStart[0];
+
+  if (m_loader.pipelined) {
+    // The blocks of this bank fill the same event lists. Each slice of the
+    // pixel IDs is processed by one block at a time, different slices in
+    // parallel.
+    if (m_sliceStarts.empty())
+      this->makeSlices();
+    std::vector<std::unique_ptr<ProcessBankData>> tasks;
+    for (size_t i = 0; i < m_sliceStarts.size(); ++i) {
+      const uint32_t first = std::max(m_min_id, m_sliceStarts[i]);
+      const uint32_t last = i + 1 < m_sliceStarts.size()
+                                ? std::min(m_max_id, m_sliceStarts[i + 1] - 1)
+                                : m_max_id;
+      if (first > last)
+        continue;
+      tasks.emplace_back(new ProcessBankData(
+          m_loader, entry_name, prog, event_id_shrd, event_time_of_flight_shrd,
+          numEvents, startAt, event_index, thisBankPulseTimes, m_have_weight,
+          event_weight_shrd, first, last));
+      tasks.back()->setMutex(m_sliceMutexes[i]);
+      tasks.back()->setBlockSlot(blockSlot);
+    }
+    for (auto &task : tasks) {
+      if (blockSlot) {
+        scheduler.push(task.release());
+      } else {
+        std::lock_guard<std::mutex> lock(*task->getMutex());
+        task->run();
+      }
+    }
+    return;
+  }
+
   // schedule the job to generate the event lists
   auto mid_id = m_max_id;
   if (m_loader.splitProcessing && m_max_id > (m_min_id + (bank_size / 4)))
@@ -469,30 +570,38 @@ void LoadBankFromDiskTask::run() {
     // of the whole bank
     mid_id = (m_max_id + m_min_id) / 2;
 
-  // No error? Launch a new task to process that data.
-  size_t numEvents = m_loadSize[0];
-  size_t startAt = m_loadStart[0];
-
-  // convert things to shared_arrays
-  boost::shared_array<uint32_t> event_id_shrd(m_event_id);
-  boost::shared_array<float> event_time_of_flight_shrd(m_event_time_of_flight);
-  boost::shared_array<float> event_weight_shrd(m_event_weight);
-  boost::shared_ptr<std::vector<uint64_t>> event_index_shrd(event_index_ptr);
-
   ProcessBankData *newTask1 = new ProcessBankData(
       m_loader, entry_name, prog, event_id_shrd, event_time_of_flight_shrd,
-      numEvents, startAt, event_index_shrd, thisBankPulseTimes, m_have_weight,
+      numEvents, startAt, event_index, thisBankPulseTimes, m_have_weight,
       event_weight_shrd, m_min_id, mid_id);
   scheduler.push(newTask1);
   if (m_loader.splitProcessing && (mid_id < m_max_id)) {
     ProcessBankData *newTask2 = new ProcessBankData(
         m_loader, entry_name, prog, event_id_shrd, event_time_of_flight_shrd,
-        numEvents, startAt, event_index_shrd, thisBankPulseTimes, m_have_weight,
+        numEvents, startAt, event_index, thisBankPulseTimes, m_have_weight,
         event_weight_shrd, (mid_id + 1), m_max_id);
     scheduler.push(newTask2);
   }
 }
 
+/** Split the pixel IDs of the bank into slices for pipelined processing,
+* based on the pixel IDs of its first block. The first and last slices are
+* open-ended, so that they hold the pixel IDs of later blocks outside of
+* that range.
+*/
+void LoadBankFromDiskTask::makeSlices() {
+  const uint64_t numIds = uint64_t(m_max_id) - m_min_id + 1;
+  const uint64_t numSlices =
+      std::min(numIds, uint64_t(m_loader.pipelineSlicesPerBank));
+  m_sliceStarts.assign(1, 0);
+  for (uint64_t i = 1; i < numSlices; ++i)
+    m_sliceStarts.push_back(
+        static_cast<uint32_t>(m_min_id + i * numIds / numSlices));
+  m_sliceMutexes.clear();
+  for (uint64_t i = 0; i < numSlices; ++i)
+    m_sliceMutexes.push_back(boost::make_shared<std::mutex>());
+}
+
 /**
 * Interpret the value describing the number of events. If the number is
 * positive return it unchanged.
@@ -20,6 +20,7 @@
 #include "MantidKernel/UnitFactory.h"
 #include "MantidKernel/VisibleWhenProperty.h"
 #include "MantidIndexing/IndexInfo.h"
+#include "MantidParallel/Communicator.h"
 
 #include <boost/function.hpp>
 #include <boost/random/mersenne_twister.hpp>
@@ -194,6 +195,27 @@ void LoadEventNexus::init() {
                   "This specified the tolerance to use (in microseconds) when "
                   "compressing.");
 
+  declareProperty(
+      make_unique<PropertyWithValue<bool>>("Pipelined", false,
+                                           Direction::Input),
+      "Read each bank in blocks of events and process every block while the "
+      "next one is read from disk (optional, default False). "
+      "This speeds up loading files with few, large banks. The events are "
+      "only compressed once all of them are loaded, so with "
+      "CompressTolerance the peak memory use is that of the uncompressed "
+      "events.");
+
+  auto mustBePositiveBlock = boost::make_shared<BoundedValidator<int>>();
+  mustBePositiveBlock->setLower(1);
+  declareProperty(
+      "PipelineBlockSize",
+      static_cast<int>(DefaultEventLoader::DEFAULT_PIPELINE_BLOCK_SIZE),
+      mustBePositiveBlock,
+      "The number of events read at a time from each bank when Pipelined "
+      "is set.");
+  setPropertySettings("PipelineBlockSize", make_unique<VisibleWhenProperty>(
+                                               "Pipelined", IS_NOT_DEFAULT));
+
   auto mustBePositive = boost::make_shared<BoundedValidator<int>>();
   mustBePositive->setLower(1);
   declareProperty("ChunkNumber", EMPTY_INT(), mustBePositive,
@@ -211,6 +233,8 @@ void LoadEventNexus::init() {
   std::string grp3 = "Reduce Memory Use";
   setPropertyGroup("Precount", grp3);
   setPropertyGroup("CompressTolerance", grp3);
+  setPropertyGroup("Pipelined", grp3);
+  setPropertyGroup("PipelineBlockSize", grp3);
   setPropertyGroup("ChunkNumber", grp3);
   setPropertyGroup("TotalChunks", grp3);
 
@@ -310,10 +334,14 @@ void LoadEventNexus::init() {
       "Load the Sample/DAS logs from the file (default True).");
 
 #ifdef MPI_EXPERIMENTAL
-  declareProperty(make_unique<PropertyWithValue<bool>>("UseParallelLoader",
-                                                       true, Direction::Input),
-                  "Use experimental parallel loader for loading event data.");
+  const bool useParallelLoader = true;
+#else
+  const bool useParallelLoader = false;
 #endif
+  declareProperty(make_unique<PropertyWithValue<bool>>(
+                      "UseParallelLoader", useParallelLoader, Direction::Input),
+                  "Use experimental parallel loader for loading event data. "
+                  "Without MPI, events are parsed by multiple threads.");
 }
 
 //----------------------------------------------------------------------------------------------
@@ -870,20 +898,34 @@ void LoadEventNexus::loadEvents(API::Progress *const prog,
     try {
       ParallelEventLoader::load(*ws, m_filename, m_top_entry_name, bankNames);
       loaded = true;
-      shortest_tof = 0.0;
-      longest_tof = 1e10;
+      if (ws->indexInfo().communicator().size() == 1 &&
+          ws->getNumberEvents() > 0) {
+        // All events are local, so the actual TOF range is known
+        ws->getEventXMinMax(shortest_tof, longest_tof);
+      } else {
+        shortest_tof = 0.0;
+        longest_tof = 1e10;
+      }
     } catch (const std::runtime_error &) {
     }
     safeOpenFile(m_filename);
   }
   if (!loaded) {
     bool precount = getProperty("Precount");
+    bool pipelined = getProperty("Pipelined");
+    int pipelineBlockSize = getProperty("PipelineBlockSize");
     int chunk = getProperty("ChunkNumber");
     int totalChunks = getProperty("TotalChunks");
+    if (pipelined && compressTolerance >= 0)
+      g_log.warning("Pipelined loading compresses the events only once all "
+                    "of them are loaded, so CompressTolerance does not reduce "
+                    "the peak memory use.");
     DefaultEventLoader::load(this, *m_ws, haveWeights, event_id_is_spec,
                              bankNames, periodLog->valuesAsVector(), classType,
-                             bankNumEvents, oldNeXusFileNames, precount, chunk,
-                             totalChunks);
+                             bankNumEvents, oldNeXusFileNames, precount,
+                             pipelined,
+                             static_cast<std::size_t>(pipelineBlockSize),
+                             chunk, totalChunks);
   }
 
   // Info reporting
@@ -1674,16 +1716,11 @@ void LoadEventNexus::safeOpenFile(const std::string fname) {
 bool LoadEventNexus::canUseParallelLoader(const bool haveWeights,
                                           const bool oldNeXusFileNames,
                                           const std::string &classType) const {
-#ifndef MPI_EXPERIMENTAL
-  // Actually the parallel loader would work also in non-MPI builds but it is
-  // likely to be slower than the default loader and may also exhibit unusual
-  // behavior for non-standard Nexus files.
-  return false;
-#else
+  // Off by default in non-MPI builds since it may exhibit unusual behavior
+  // for non-standard Nexus files.
   bool useParallelLoader = getProperty("UseParallelLoader");
   if (!useParallelLoader)
     return false;
-#endif
   if (m_ws->nPeriods() != 1)
     return false;
   if (haveWeights)
@@ -2,6 +2,8 @@
 #include "MantidDataObjects/EventWorkspace.h"
 #include "MantidGeometry/Instrument/DetectorInfo.h"
 #include "MantidIndexing/IndexInfo.h"
+#include "MantidKernel/MultiThreaded.h"
+#include "MantidParallel/Communicator.h"
 #include "MantidParallel/IO/EventLoader.h"
 #include "MantidTypes/SpectrumDefinition.h"
 #include "MantidTypes/Event/TofEvent.h"
@@ -54,9 +56,17 @@ void ParallelEventLoader::load(DataObjects::EventWorkspace &ws,
   for (size_t i = 0; i < size; ++i)
     DataObjects::getEventsFrom(ws.getSpectrum(i), eventLists[i]);
 
-  Parallel::IO::EventLoader::load(
-      ws.indexInfo().communicator(), filename, groupName, bankNames,
-      bankOffsets(ws, filename, groupName, bankNames), std::move(eventLists));
+  const auto &comm = ws.indexInfo().communicator();
+  if (comm.size() > 1) {
+    Parallel::IO::EventLoader::load(
+        comm, filename, groupName, bankNames,
+        bankOffsets(ws, filename, groupName, bankNames), std::move(eventLists));
+  } else {
+    // Without MPI the events are parsed by the threads of this process
+    Parallel::IO::EventLoader::load(
+        PARALLEL_GET_MAX_THREADS, filename, groupName, bankNames,
+        bankOffsets(ws, filename, groupName, bankNames), std::move(eventLists));
+  }
 }
 
 } // namespace DataHandling
@@ -0,0 +1,46 @@
+#include "MantidDataHandling/PipelineBlockLimit.h"
+
+#include <stdexcept>
+
+namespace Mantid {
+namespace DataHandling {
+
+/** Constructor
+ * @param maxBlocks :: the number of blocks that may be in flight at once
+ * @throw std::invalid_argument if maxBlocks is zero
+ */
+PipelineBlockLimit::PipelineBlockLimit(const std::size_t maxBlocks)
+    : m_maxBlocks(maxBlocks), m_blocks(0), m_peakBlocks(0) {
+  if (maxBlocks == 0)
+    throw std::invalid_argument(
+        "PipelineBlockLimit: at least one block must be allowed in flight");
+}
+
+/** Take a slot for a block, if there is one left. The limit must outlive the
+ * returned pointer and all of its copies.
+ * @return a pointer that holds the slot until its last copy is destroyed, or
+ * an empty pointer if the maximum number of blocks are in flight
+ */
+boost::shared_ptr<void> PipelineBlockLimit::tryAcquire() {
+  std::size_t blocks = m_blocks.load();
+  do {
+    if (blocks >= m_maxBlocks)
+      return boost::shared_ptr<void>();
+  } while (!m_blocks.compare_exchange_weak(blocks, blocks + 1));
+
+  std::size_t peak = m_peakBlocks.load();
+  while (peak < blocks + 1 &&
+         !m_peakBlocks.compare_exchange_weak(peak, blocks + 1)) {
+  }
+  return boost::shared_ptr<void>(static_cast<void *>(this),
+                                 [](void *limit) {
+                                   static_cast<PipelineBlockLimit *>(limit)
+                                       ->release();
+                                 });
+}
+
+/// Give back the slot of a block that has been processed
+void PipelineBlockLimit::release() { --m_blocks; }
+
+} // namespace DataHandling
+} // namespace Mantid
@@ -62,7 +62,11 @@ void ProcessBankData::run() { // override {
         // Find the the workspace index corresponding to that pixel ID
         // Allocate it
         if (wi < numEventLists) {
-          outputWS.reserveEventListAt(wi, counts[pixID - m_min_id]);
+          // Earlier blocks of a pipelined bank may have filled the list
+          const size_t existing =
+              m_loader.pipelined ? outputWS.getSpectrum(wi).getNumberEvents()
+                                 : 0;
+          outputWS.reserveEventListAt(wi, existing + counts[pixID - m_min_id]);
         }
         if (alg->getCancel())
           break; // User cancellation
@@ -100,8 +104,9 @@ void ProcessBankData::run() { // override {
 
   prog->report(entry_name + ": filling events");
 
-  // Will we need to compress?
-  bool compress = (alg->compressTolerance >= 0);
+  // Will we need to compress? Pipelined banks are compressed by the loader
+  // once all of their blocks have been processed.
+  bool compress = (alg->compressTolerance >= 0) && !m_loader.pipelined;
 
   // Which detector IDs were touched? - only matters if compress is on
   std::vector<bool> usedDetIds;
@@ -532,6 +532,76 @@ public:
     }
   }
 
+  void test_Pipelined_vs_Normal() {
+    Mantid::API::FrameworkManager::Instance();
+    LoadEventNexus ld;
+    ld.initialize();
+    ld.setPropertyValue("Filename", "CNCS_7860_event.nxs");
+    ld.setPropertyValue("OutputWorkspace", "cncs_normal");
+    ld.setProperty<bool>("LoadLogs", false); // Time-saver
+    ld.execute();
+    TS_ASSERT(ld.isExecuted());
+
+    LoadEventNexus ld2;
+    ld2.initialize();
+    ld2.setPropertyValue("Filename", "CNCS_7860_event.nxs");
+    ld2.setPropertyValue("OutputWorkspace", "cncs_pipelined");
+    ld2.setProperty<bool>("Pipelined", true);
+    // Small blocks, so that every bank is read in many of them
+    ld2.setProperty<int>("PipelineBlockSize", 300);
+    ld2.setProperty<bool>("LoadLogs", false); // Time-saver
+    ld2.execute();
+    TS_ASSERT(ld2.isExecuted());
+
+    EventWorkspace_sptr WS =
+        AnalysisDataService::Instance().retrieveWS<EventWorkspace>(
+            "cncs_normal");
+    EventWorkspace_sptr WS2 =
+        AnalysisDataService::Instance().retrieveWS<EventWorkspace>(
+            "cncs_pipelined");
+    TS_ASSERT(WS);
+    TS_ASSERT(WS2);
+    TS_ASSERT_EQUALS(WS2->getNumberHistograms(), WS->getNumberHistograms());
+    TS_ASSERT_EQUALS(WS2->getNumberEvents(), WS->getNumberEvents());
+    TS_ASSERT_DELTA((*WS2->refX(0))[0], (*WS->refX(0))[0], 1e-9);
+    TS_ASSERT_DELTA((*WS2->refX(0))[1], (*WS->refX(0))[1], 1e-9);
+    for (size_t wi = 0; wi < WS->getNumberHistograms(); wi++) {
+      auto &events = WS->getSpectrum(wi);
+      auto &events2 = WS2->getSpectrum(wi);
+      TS_ASSERT_EQUALS(events2.getNumberEvents(), events.getNumberEvents());
+      if (events2.getNumberEvents() != events.getNumberEvents())
+        break;
+      events.sortPulseTimeTOF();
+      events2.sortPulseTimeTOF();
+      for (size_t i = 0; i < events.getNumberEvents(); i++) {
+        TS_ASSERT_EQUALS(events2.getEvent(i).tof(), events.getEvent(i).tof());
+        TS_ASSERT_EQUALS(events2.getEvent(i).pulseTime(),
+                         events.getEvent(i).pulseTime());
+      }
+    }
+
+    // Compressing is done once all the blocks are in
+    LoadEventNexus ld3;
+    ld3.initialize();
+    ld3.setPropertyValue("Filename", "CNCS_7860_event.nxs");
+    ld3.setPropertyValue("OutputWorkspace", "cncs_pipelined_compressed");
+    ld3.setProperty<bool>("Pipelined", true);
+    ld3.setProperty<int>("PipelineBlockSize", 300);
+    ld3.setPropertyValue("CompressTolerance", "0.05");
+    ld3.setProperty<bool>("LoadLogs", false); // Time-saver
+    ld3.execute();
+    TS_ASSERT(ld3.isExecuted());
+    EventWorkspace_sptr WS3 =
+        AnalysisDataService::Instance().retrieveWS<EventWorkspace>(
+            "cncs_pipelined_compressed");
+    TS_ASSERT(WS3);
+    TS_ASSERT_EQUALS(WS3->getNumberEvents(), 111274);
+
+    AnalysisDataService::Instance().remove("cncs_normal");
+    AnalysisDataService::Instance().remove("cncs_pipelined");
+    AnalysisDataService::Instance().remove("cncs_pipelined_compressed");
+  }
+
   void test_Monitors() {
     // Uses the workspace loaded in the last test to save a load execution
     std::string mon_outws_name = "cncs_compressed_monitors";
@@ -835,6 +905,34 @@ public:
     }
   }
 
+  void test_multi_threaded_parallel_loader() {
+    Parallel::Communicator comm;
+    auto reference = ParallelTestHelpers::create<LoadEventNexus>(comm);
+    reference->setProperty("Filename", "CNCS_7860_event.nxs");
+    reference->setProperty("LoadLogs", false);
+    reference->setProperty("UseParallelLoader", false);
+    reference->execute();
+    TS_ASSERT(reference->isExecuted());
+    auto alg = ParallelTestHelpers::create<LoadEventNexus>(comm);
+    alg->setProperty("Filename", "CNCS_7860_event.nxs");
+    alg->setProperty("LoadLogs", false);
+    alg->setProperty("UseParallelLoader", true);
+    alg->execute();
+    TS_ASSERT(alg->isExecuted());
+
+    Workspace_const_sptr referenceOut =
+        reference->getProperty("OutputWorkspace");
+    Workspace_const_sptr out = alg->getProperty("OutputWorkspace");
+    auto referenceWS =
+        boost::dynamic_pointer_cast<const EventWorkspace>(referenceOut);
+    auto eventWS = boost::dynamic_pointer_cast<const EventWorkspace>(out);
+    TS_ASSERT_EQUALS(eventWS->getNumberHistograms(),
+                     referenceWS->getNumberHistograms());
+    TS_ASSERT_EQUALS(eventWS->getNumberEvents(), 112266);
+    for (size_t i = 0; i < referenceWS->getNumberHistograms(); ++i)
+      TS_ASSERT_EQUALS(eventWS->getSpectrum(i), referenceWS->getSpectrum(i));
+  }
+
   void test_MPI_load() {
     int threads = 3; // Limited number of threads to avoid long running test.
     ParallelTestHelpers::ParallelRunner runner(threads);
@@ -0,0 +1,76 @@
+#ifndef MANTID_DATAHANDLING_PIPELINEBLOCKLIMITTEST_H_
+#define MANTID_DATAHANDLING_PIPELINEBLOCKLIMITTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidDataHandling/PipelineBlockLimit.h"
+#include "MantidKernel/MultiThreaded.h"
+
+#include <stdexcept>
+#include <vector>
+
+using Mantid::DataHandling::PipelineBlockLimit;
+
+class PipelineBlockLimitTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static PipelineBlockLimitTest *createSuite() {
+    return new PipelineBlockLimitTest();
+  }
+  static void destroySuite(PipelineBlockLimitTest *suite) { delete suite; }
+
+  void test_no_blocks_throws() {
+    TS_ASSERT_THROWS(PipelineBlockLimit(0), std::invalid_argument);
+  }
+
+  void test_slots_are_limited() {
+    PipelineBlockLimit limit(3);
+    std::vector<boost::shared_ptr<void>> slots;
+    for (size_t i = 0; i < 3; ++i) {
+      slots.push_back(limit.tryAcquire());
+      TS_ASSERT(slots.back());
+    }
+    TS_ASSERT_EQUALS(limit.blocks(), 3);
+    TS_ASSERT(!limit.tryAcquire());
+    TS_ASSERT_EQUALS(limit.blocks(), 3);
+    TS_ASSERT_EQUALS(limit.peakBlocks(), 3);
+  }
+
+  void test_slot_is_given_back_by_its_last_copy() {
+    PipelineBlockLimit limit(1);
+    auto slot = limit.tryAcquire();
+    auto copy = slot;
+    slot.reset();
+    TS_ASSERT(!limit.tryAcquire());
+    copy.reset();
+    TS_ASSERT_EQUALS(limit.blocks(), 0);
+    TS_ASSERT(limit.tryAcquire());
+    TS_ASSERT_EQUALS(limit.peakBlocks(), 1);
+  }
+
+  void test_limit_holds_for_many_threads() {
+    PipelineBlockLimit limit(4);
+    const int nBlocks = 100000;
+    int nAcquired = 0;
+    bool overLimit = false;
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int i = 0; i < nBlocks; ++i) {
+      auto slot = limit.tryAcquire();
+      if (slot) {
+        PARALLEL_ATOMIC
+        ++nAcquired;
+      }
+      if (limit.blocks() > limit.maxBlocks()) {
+        PARALLEL_CRITICAL(PipelineBlockLimitTest)
+        overLimit = true;
+      }
+    }
+    TS_ASSERT(!overLimit);
+    TS_ASSERT_LESS_THAN(0, nAcquired);
+    TS_ASSERT_EQUALS(limit.blocks(), 0);
+    TS_ASSERT_LESS_THAN_EQUALS(limit.peakBlocks(), 4);
+  }
+};
+
+#endif /* MANTID_DATAHANDLING_PIPELINEBLOCKLIMITTEST_H_ */
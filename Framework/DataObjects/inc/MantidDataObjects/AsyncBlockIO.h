@@ -0,0 +1,189 @@
+#ifndef MANTID_DATAOBJECTS_ASYNCBLOCKIO_H_
+#define MANTID_DATAOBJECTS_ASYNCBLOCKIO_H_
+
+#include "MantidKernel/System.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Mantid {
+namespace DataObjects {
+
+/** AsyncBlockIO : Queues the reads and writes of the event data of a
+  file-backed MDEventWorkspace and performs them on a background thread.
+
+  - Saved blocks are copied and written behind the caller, so that e.g. the
+    DiskBuffer does not wait for the disk when it writes out boxes. The blocks
+    waiting to be written are sorted by file position and adjacent ones are
+    written with a single call. Loads of data still waiting to be written are
+    served from the copies.
+  - A load that continues where the previous one stopped, as when boxes are
+    loaded in the order of their IDs (the order they are saved in), starts
+    reading the following part of the file in the background. Blocks can also
+    be requested in advance with readAhead(); adjacent requests are read with
+    a single call.
+  - The blocks read ahead are kept in a small cache that later loads are
+    served from. They are dropped when the same part of the file is saved.
+
+  Positions and sizes are in rows (events) of nColumns values. The file itself
+  is accessed through the functions given to the constructor, which are only
+  called from one thread at a time by the background thread but may be called
+  concurrently from the threads loading blocks.
+
+  Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+class DLLExport AsyncBlockIO {
+public:
+  /// Rows of event data at a position in the file, as floats or doubles
+  struct Block {
+    uint64_t position{0};
+    uint64_t nPoints{0};
+    bool isDouble{false};
+    std::vector<float> floats;
+    std::vector<double> doubles;
+    /// @return the position after the last row
+    uint64_t end() const { return position + nPoints; }
+  };
+  /** Read block.nPoints rows at block.position into block.floats or
+   * block.doubles, as given by block.isDouble. A block read ahead may extend
+   * beyond the end of the file; the function then reduces block.nPoints. */
+  using ReadFunction = std::function<void(Block &)>;
+  /// Write a block to the file
+  using WriteFunction = std::function<void(const Block &)>;
+  /// Flush the data written so far to the disk
+  using FlushFunction = std::function<void()>;
+
+  AsyncBlockIO(size_t nColumns, ReadFunction read, WriteFunction write,
+               FlushFunction flush);
+  AsyncBlockIO(const AsyncBlockIO &) = delete;
+  AsyncBlockIO &operator=(const AsyncBlockIO &) = delete;
+  ~AsyncBlockIO();
+
+  void save(const std::vector<float> &data, uint64_t position);
+  void save(const std::vector<double> &data, uint64_t position);
+  void load(std::vector<float> &data, uint64_t position, size_t nPoints);
+  void load(std::vector<double> &data, uint64_t position, size_t nPoints);
+  void readAhead(uint64_t position, size_t nPoints, bool isDouble);
+
+  void flushInBackground();
+  void flush();
+  void wait();
+  void stop();
+
+  void setBufferSizes(size_t writeBufferBytes, size_t cacheBytes,
+                      uint64_t readAheadPoints);
+
+  /// Number of loads served from memory rather than from the file
+  size_t numCachedLoads() const { return m_numCachedLoads.load(); }
+  /// Number of calls to the read function made in the background
+  size_t numReads() const { return m_numReads.load(); }
+  /// Number of calls to the write function
+  size_t numWrites() const { return m_numWrites.load(); }
+
+private:
+  using BlockPtr = std::shared_ptr<Block>;
+
+  template <typename T>
+  void saveBlock(const std::vector<T> &data, uint64_t position);
+  template <typename T>
+  void loadBlock(std::vector<T> &data, uint64_t position, size_t nPoints);
+  template <typename T>
+  void copyRows(const Block &from, std::vector<T> &data, uint64_t position,
+                size_t nPoints) const;
+  template <typename T>
+  bool loadFromMemory(std::unique_lock<std::mutex> &lock, std::vector<T> &data,
+                      uint64_t position, size_t nPoints);
+
+  void run();
+  void writeQueued(std::unique_lock<std::mutex> &lock);
+  void readQueued(std::unique_lock<std::mutex> &lock);
+  void flushQueued(std::unique_lock<std::mutex> &lock);
+  void startThread();
+  void dropOverlapping(uint64_t position, uint64_t end);
+  uint64_t endOfQueuedData(uint64_t position, bool isDouble) const;
+  void queueRead(uint64_t position, uint64_t nPoints, bool isDouble);
+  void noteLoad(uint64_t position, uint64_t end, bool isDouble);
+  void rethrowError();
+
+  /// Number of values per row
+  const size_t m_nColumns;
+  const ReadFunction m_read;
+  const WriteFunction m_write;
+  const FlushFunction m_flush;
+
+  /// Largest amount of data waiting to be written before saving blocks
+  size_t m_maxWriteBytes;
+  /// Largest amount of data kept after being read ahead
+  size_t m_maxCacheBytes;
+  /// Number of rows read ahead when loading sequentially
+  uint64_t m_readAheadPoints;
+
+  /// Protects all of the following
+  std::mutex m_mutex;
+  /// Signals the background thread that there is work to do
+  std::condition_variable m_workQueued;
+  /// Signals waiting callers that work has been done
+  std::condition_variable m_workDone;
+  std::thread m_thread;
+  bool m_stop{false};
+  /// Blocks to write in the order they were saved, including those being
+  /// written
+  std::deque<BlockPtr> m_writes;
+  /// Amount of data in m_writes
+  size_t m_writeBytes{0};
+  bool m_flushRequested{false};
+  bool m_flushing{false};
+  /// Blocks to read, not started yet
+  std::vector<BlockPtr> m_readRequests;
+  /// The block being read, if any, and whether it has become outdated
+  BlockPtr m_reading;
+  bool m_readingOutdated{false};
+  /// Blocks read ahead, least recently used first
+  std::list<BlockPtr> m_cache;
+  /// Amount of data in m_cache
+  size_t m_cacheBytes{0};
+  /// End of the previous load, to detect sequential loading
+  uint64_t m_lastLoadEnd{0};
+  /// End of the file as found by reading ahead
+  uint64_t m_knownFileEnd{std::numeric_limits<uint64_t>::max()};
+  /// First error of the background thread, passed on to the next caller
+  std::exception_ptr m_error;
+
+  std::atomic<size_t> m_numCachedLoads{0};
+  std::atomic<size_t> m_numReads{0};
+  std::atomic<size_t> m_numWrites{0};
+};
+
+} // namespace DataObjects
+} // namespace Mantid
+
+#endif /* MANTID_DATAOBJECTS_ASYNCBLOCKIO_H_ */
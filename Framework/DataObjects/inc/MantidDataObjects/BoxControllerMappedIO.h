@@ -0,0 +1,147 @@
+#ifndef MANTID_DATAOBJECTS_BOXCONTROLLERMAPPEDIO_H_
+#define MANTID_DATAOBJECTS_BOXCONTROLLERMAPPEDIO_H_
+
+#include "MantidAPI/BoxController.h"
+#include "MantidAPI/IBoxControllerIO.h"
+
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+
+namespace boost {
+namespace interprocess {
+class file_mapping;
+class mapped_region;
+}
+}
+
+namespace Mantid {
+namespace DataObjects {
+
+/** BoxControllerMappedIO : saves and loads the events of an MDEventWorkspace
+  in a flat file, which is memory-mapped, rather than in the NeXus file.
+
+  The events are kept in a file next to the NeXus file of the workspace, named
+  by eventFileName(), while the NeXus file keeps the box structure and the
+  rest of the workspace. The event file consists of a header page followed by
+  the events, one row of getNDataColums() floats or doubles per event, in the
+  same column order as the NeXus event data. The data start at a page
+  boundary, so that loading a block is a copy from the page cache rather than
+  a NeXus/HDF5 read. The free space blocks of the DiskBuffer are kept after
+  the events when the file is closed. Values are stored in the byte order of
+  the machine that wrote the file.
+
+  Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+class DLLExport BoxControllerMappedIO : public API::IBoxControllerIO {
+public:
+  BoxControllerMappedIO(API::BoxController *const bc);
+  ~BoxControllerMappedIO() override;
+
+  /// @return true if the event file is opened and false otherwise
+  bool isOpened() const override { return bool(m_mapping); }
+  /// get the full name of the NeXus file of the workspace
+  const std::string &getFileName() const override { return m_fileName; }
+  /// get the full name of the file holding the events
+  const std::string &getEventFileName() const { return m_eventFileName; }
+  /// Return the number of events the event file grows by at least
+  size_t getDataChunk() const override { return DATA_CHUNK; }
+
+  bool openFile(const std::string &fileName, const std::string &mode) override;
+
+  void saveBlock(const std::vector<float> & /* DataBlock */,
+                 const uint64_t /*blockPosition*/) const override;
+  void loadBlock(std::vector<float> & /* Block */,
+                 const uint64_t /*blockPosition*/,
+                 const size_t /*BlockSize*/) const override;
+  void saveBlock(const std::vector<double> & /* DataBlock */,
+                 const uint64_t /*blockPosition*/) const override;
+  void loadBlock(std::vector<double> & /* Block */,
+                 const uint64_t /*blockPosition*/,
+                 const size_t /*BlockSize*/) const override;
+
+  void flushData() const override;
+  void flushCache() override;
+  void closeFile() override;
+
+  void setDataType(const size_t blockSize,
+                   const std::string &typeName) override;
+  void getDataType(size_t &CoordSize, std::string &typeName) const override;
+
+  /// @return the number of values saved per event
+  int64_t getNDataColums() const { return static_cast<int64_t>(m_nColumns); }
+
+  static std::string eventFileName(const std::string &fileName);
+  static bool hasEventFile(const std::string &fileName);
+
+private:
+  /// Smallest number of events the event file grows by
+  enum { DATA_CHUNK = 10000 };
+
+  template <typename Type>
+  void saveGenericBlock(const std::vector<Type> &DataBlock,
+                        const uint64_t blockPosition) const;
+  template <typename Type>
+  void loadGenericBlock(std::vector<Type> &Block, const uint64_t blockPosition,
+                        const size_t nPoints) const;
+
+  void createEventFile();
+  void openEventFile();
+  void mapEventFile(uint64_t fileSize) const;
+  void reserve(uint64_t nPoints) const;
+  void writeHeader() const;
+  size_t rowBytes() const { return m_nColumns * m_fileCoordSize; }
+
+  /// full name of the NeXus file of the workspace
+  std::string m_fileName;
+  /// full name of the file holding the events
+  std::string m_eventFileName;
+  /// true if the file is open for reading only
+  bool m_ReadOnly;
+  /// the box controller using this IO
+  API::BoxController *const m_bc;
+  /// number of values per event
+  size_t m_nColumns;
+  /// size of the coordinates of the events loaded and saved
+  size_t m_CoordSize;
+  /// size of the coordinates of the events in the file
+  size_t m_fileCoordSize;
+  /// index of the event type in m_EventsTypesSupported
+  size_t m_EventType;
+  /// names of the event types supported
+  std::vector<std::string> m_EventsTypesSupported;
+  /// offset of the first event in the file, in bytes
+  uint64_t m_dataOffset;
+
+  /// protects the mapping, which changes as the file grows. Loads share it,
+  /// everything that may remap the file or write to it takes it exclusively
+  mutable std::shared_timed_mutex m_fileMutex;
+  mutable std::unique_ptr<boost::interprocess::file_mapping> m_mapping;
+  mutable std::unique_ptr<boost::interprocess::mapped_region> m_region;
+  /// number of events that fit in the file as mapped
+  mutable uint64_t m_capacity;
+};
+
+} // namespace DataObjects
+} // namespace Mantid
+
+#endif /* MANTID_DATAOBJECTS_BOXCONTROLLERMAPPEDIO_H_ */
@@ -3,9 +3,11 @@
 
 #include "MantidAPI/IBoxControllerIO.h"
 #include "MantidAPI/BoxController.h"
+#include "MantidDataObjects/AsyncBlockIO.h"
 #include "MantidKernel/DiskBuffer.h"
 #include <nexus/NeXusFile.hpp>
 
+#include <memory>
 #include <mutex>
 
 namespace Mantid {
@@ -15,6 +17,10 @@ namespace DataObjects {
 /** The class responsible for saving events into nexus file using generic box
   controller interface
   * Expected to provide thread-safe file access.
+  *
+  * The blocks saved are written to the file in the background, and blocks
+  * are read ahead of sequential loads or on request, see AsyncBlockIO.
+  * flushCache() waits for all the data saved to be written.
 
     @date March 15, 2013
 
@@ -62,8 +68,11 @@ public:
   void loadBlock(std::vector<double> & /* Block */,
                  const uint64_t /*blockPosition*/,
                  const size_t /*BlockSize*/) const override;
+  void readAhead(const uint64_t /*blockPosition*/,
+                 const size_t /*BlockSize*/) const override;
 
   void flushData() const override;
+  void flushCache() override;
   void closeFile() override;
 
   ~BoxControllerNeXusIO() override;
@@ -159,8 +168,24 @@ private:
   void saveGenericBlock(const std::vector<Type> &DataBlock,
                         const uint64_t blockPosition) const;
   template <typename Type>
+  void writeGenericBlock(const std::vector<Type> &DataBlock,
+                         const uint64_t blockPosition) const;
+  template <typename Type>
+  void loadQueuedBlock(std::vector<Type> &Block, const uint64_t blockPosition,
+                       const size_t nPoints) const;
+  template <typename Type>
   void loadGenericBlock(std::vector<Type> &Block, const uint64_t blockPosition,
                         const size_t nPoints) const;
+  void readBlock(std::vector<float> &Block, const uint64_t blockPosition,
+                 const size_t nPoints) const;
+  void readBlock(std::vector<double> &Block, const uint64_t blockPosition,
+                 const size_t nPoints) const;
+  void readBlock(AsyncBlockIO::Block &block) const;
+  void writeBlock(const AsyncBlockIO::Block &block) const;
+
+  /// queues the reads and writes and performs them in the background while
+  /// the file is open
+  std::unique_ptr<AsyncBlockIO> m_asyncIO;
 };
 }
 }
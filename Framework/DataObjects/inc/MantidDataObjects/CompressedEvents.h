@@ -0,0 +1,136 @@
+#ifndef MANTID_DATAOBJECTS_COMPRESSEDEVENTS_H_
+#define MANTID_DATAOBJECTS_COMPRESSEDEVENTS_H_
+
+#include "MantidAPI/IEventList.h"
+#include "MantidDataObjects/Events.h"
+#include "MantidKernel/System.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace Mantid {
+namespace DataObjects {
+
+/** CompressedEvents : Lossless compressed storage for the events of an
+  EventList that is held in memory for a long time without being modified.
+
+  The events keep their order and are encoded as follows:
+   - pulse times: an index of pulses, i.e. runs of consecutive events that
+     share the same pulse time. Each pulse is stored as the variable-length
+     encoded difference to the previous pulse time followed by the number of
+     events in the run. Lists in pulse time order, as loaded from file, have
+     one entry per pulse.
+   - time-of-flight: the order-preserving integer key of each value is stored
+     relative to the smallest key, without the trailing zero bits common to
+     all values, packed in the minimum number of bits. Values that came from
+     single precision floats lose 29 bits this way.
+   - weights and squared errors: stored once if they are the same for every
+     event, otherwise as plain float columns.
+
+  Single time-of-flight values are decoded on demand, so histogramming and
+  filtering by pulse time work directly on the compressed form.
+
+  Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+class DLLExport CompressedEvents {
+public:
+  explicit CompressedEvents(Mantid::API::EventType type = Mantid::API::TOF);
+  explicit CompressedEvents(const std::vector<Types::Event::TofEvent> &events);
+  explicit CompressedEvents(const std::vector<WeightedEvent> &events);
+  explicit CompressedEvents(const std::vector<WeightedEventNoTime> &events);
+
+  void copyTo(std::vector<Types::Event::TofEvent> &events) const;
+  void copyTo(std::vector<WeightedEvent> &events) const;
+  void copyTo(std::vector<WeightedEventNoTime> &events) const;
+
+  void copyPulseTimeRange(const int64_t start, const int64_t stop,
+                          std::vector<Types::Event::TofEvent> &events) const;
+  void copyPulseTimeRange(const int64_t start, const int64_t stop,
+                          std::vector<WeightedEvent> &events) const;
+
+  /// The type of the compressed events
+  Mantid::API::EventType getEventType() const { return m_eventType; }
+  /// Number of events
+  std::size_t size() const { return m_numEvents; }
+  /// Returns true if there are no events
+  bool empty() const { return m_numEvents == 0; }
+  /// Number of entries in the pulse index
+  std::size_t numPulses() const { return m_numPulses; }
+  /// True if the pulse times never decrease from one event to the next
+  bool isSortedByPulseTime() const { return m_sortedByPulseTime; }
+
+  void clear();
+  std::size_t getMemorySize() const;
+
+  double tof(const std::size_t index) const;
+  double tofMin() const;
+  double tofMax() const;
+  void decodeTofs(const std::size_t first, const std::size_t count,
+                  double *tofs) const;
+
+  void histogramCounts(const MantidVec &X, MantidVec &Y) const;
+  void histogramWeights(const MantidVec &X, MantidVec &Y, MantidVec &E) const;
+
+private:
+  template <class T> void encodePulseTimes(const std::vector<T> &events);
+  template <class T> void encodeTofs(const std::vector<T> &events);
+  template <class T> void encodeWeights(const std::vector<T> &events);
+  template <class T, class Predicate>
+  void appendEvents(std::vector<T> &events, Predicate keepPulse) const;
+  /// Weight of an event
+  float weight(const std::size_t index) const {
+    return m_weights.size() == 1 ? m_weights.front() : m_weights[index];
+  }
+  /// Squared error of an event
+  float errorSquared(const std::size_t index) const {
+    return m_errorSquareds.size() == 1 ? m_errorSquareds.front()
+                                       : m_errorSquareds[index];
+  }
+
+  /// The type of the compressed events
+  Mantid::API::EventType m_eventType;
+  /// Number of events
+  std::size_t m_numEvents{0};
+  /// Number of entries in the pulse index
+  std::size_t m_numPulses{0};
+  /// True if the pulse times never decrease
+  bool m_sortedByPulseTime{true};
+  /// Pulse index: pairs of (pulse time delta, number of events) as varints
+  std::vector<uint8_t> m_pulses;
+  /// Smallest time-of-flight key
+  uint64_t m_tofBase{0};
+  /// Number of trailing bits dropped from every time-of-flight key
+  unsigned int m_tofShift{0};
+  /// Number of bits used for every packed time-of-flight
+  unsigned int m_tofWidth{0};
+  /// Packed time-of-flight values
+  std::vector<uint64_t> m_tofBits;
+  /// Weight of each event, or a single value shared by all events
+  std::vector<float> m_weights;
+  /// Squared error of each event, or a single value shared by all events
+  std::vector<float> m_errorSquareds;
+};
+
+} // namespace DataObjects
+} // namespace Mantid
+
+#endif /* MANTID_DATAOBJECTS_COMPRESSEDEVENTS_H_ */
@@ -0,0 +1,120 @@
+#ifndef MANTID_DATAOBJECTS_EVENTCOLUMNS_H_
+#define MANTID_DATAOBJECTS_EVENTCOLUMNS_H_
+
+#include "MantidAPI/IEventList.h"
+#include "MantidDataObjects/Events.h"
+#include "MantidKernel/System.h"
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace Mantid {
+namespace DataObjects {
+
+/** EventColumns : Structure-of-arrays storage for the events of an EventList.
+
+  Each field of the events is held in its own contiguous column: the
+  time-of-flight, the pulse time (in nanoseconds), the weight and the squared
+  error. Which columns are in use depends on the event type:
+   - TOF: time-of-flight and pulse time
+   - WEIGHTED: all four columns
+   - WEIGHTED_NOTIME: time-of-flight, weight and squared error
+
+  Passes that only look at the time-of-flight (histogramming, unit conversion,
+  masking, min/max searches) then stream 8 bytes per event instead of the
+  16-24 bytes of the corresponding event struct.
+
+  Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+class DLLExport EventColumns {
+public:
+  explicit EventColumns(Mantid::API::EventType type = Mantid::API::TOF);
+  explicit EventColumns(const std::vector<Types::Event::TofEvent> &events);
+  explicit EventColumns(const std::vector<WeightedEvent> &events);
+  explicit EventColumns(const std::vector<WeightedEventNoTime> &events);
+
+  void copyTo(std::vector<Types::Event::TofEvent> &events) const;
+  void copyTo(std::vector<WeightedEvent> &events) const;
+  void copyTo(std::vector<WeightedEventNoTime> &events) const;
+
+  bool operator==(const EventColumns &rhs) const;
+
+  /// The type of event held in the columns
+  Mantid::API::EventType getEventType() const { return m_eventType; }
+  /// Number of events held in the columns
+  std::size_t size() const { return m_tofs.size(); }
+  /// Returns true if there are no events
+  bool empty() const { return m_tofs.empty(); }
+  /// True if the pulse time column is in use
+  bool hasPulseTimes() const {
+    return m_eventType != Mantid::API::WEIGHTED_NOTIME;
+  }
+  /// True if the weight and error columns are in use
+  bool hasWeights() const { return m_eventType != Mantid::API::TOF; }
+
+  void clear();
+  void reserve(std::size_t num);
+  std::size_t getMemorySize() const;
+
+  /// Time-of-flight column
+  const std::vector<double> &tofs() const { return m_tofs; }
+  /// Pulse time column in nanoseconds. Empty for WEIGHTED_NOTIME.
+  const std::vector<int64_t> &pulseTimes() const { return m_pulseTimes; }
+  /// Weight column. Empty for TOF.
+  const std::vector<float> &weights() const { return m_weights; }
+  /// Squared error column. Empty for TOF.
+  const std::vector<float> &errorSquareds() const { return m_errorSquareds; }
+
+  void sortTof();
+  void reverse();
+
+  void convertTof(const double factor, const double offset);
+  void convertTof(const std::function<double(double)> &func);
+  void convertUnitsQuickly(const double factor, const double power);
+
+  std::size_t maskTof(const double tofMin, const double tofMax);
+
+  void histogramCounts(const MantidVec &X, MantidVec &Y) const;
+  void histogramWeights(const MantidVec &X, MantidVec &Y, MantidVec &E) const;
+
+  void compress(const double tolerance, EventColumns &out) const;
+
+private:
+  std::size_t findFirstEvent(const double seek_tof) const;
+
+  /// The type of event held in the columns
+  Mantid::API::EventType m_eventType;
+  /// Time-of-flight of each event
+  std::vector<double> m_tofs;
+  /// Pulse time of each event, in nanoseconds
+  std::vector<int64_t> m_pulseTimes;
+  /// Weight of each event
+  std::vector<float> m_weights;
+  /// Squared error of each event
+  std::vector<float> m_errorSquareds;
+};
+
+} // namespace DataObjects
+} // namespace Mantid
+
+#endif /* MANTID_DATAOBJECTS_EVENTCOLUMNS_H_ */
@@ -0,0 +1,142 @@
+#ifndef MANTID_DATAOBJECTS_EVENTHISTOGRAMMER_H_
+#define MANTID_DATAOBJECTS_EVENTHISTOGRAMMER_H_
+
+#include "MantidKernel/System.h"
+#include "MantidKernel/cow_ptr.h"
+
+#include <array>
+#include <cstddef>
+
+namespace Mantid {
+namespace DataObjects {
+
+/** EventHistogrammer : Finds the histogram bins of batches of events.
+
+  On construction the bin edges are inspected to detect linear binning (as
+  produced by HistogramData::LinearGenerator or linear Rebin parameters) and
+  logarithmic binning (LogarithmicGenerator or negative Rebin steps). The
+  last bin is allowed to differ in width, as Rebin may widen or shorten it.
+  For these two cases the bin index of an event is computed arithmetically,
+  in a branch-free loop over a block of events that the compiler can
+  vectorise, and then checked against the actual edges so the result is
+  exactly the one a search would give. Any other binning falls back to a
+  binary search per event.
+
+  An event falls into bin i if X[i] <= tof < X[i+1]; events outside of
+  [X.front(), X.back()) are ignored.
+
+  Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+class DLLExport EventHistogrammer {
+public:
+  /// The kind of binning detected from the bin edges
+  enum BinningType { LINEAR, LOGARITHMIC, IRREGULAR };
+  /// Number of events processed together
+  static const std::size_t BLOCK_SIZE = 512;
+
+  explicit EventHistogrammer(const MantidVec &X);
+
+  /// The kind of binning detected from the bin edges
+  BinningType getBinningType() const { return m_binningType; }
+  /// Number of bins
+  std::size_t numBins() const { return m_numBins; }
+
+  void findBins(const double *tofs, const std::size_t numEvents,
+                int *bins) const;
+
+  void addCounts(const double *tofs, const std::size_t numEvents,
+                 MantidVec &Y) const;
+  void addWeights(const double *tofs, const float *weights,
+                  const float *errorSquareds, const std::size_t numEvents,
+                  MantidVec &Y, MantidVec &E) const;
+
+  template <class InputIt>
+  void addCounts(InputIt first, InputIt last, MantidVec &Y) const;
+  template <class InputIt>
+  void addWeights(InputIt first, InputIt last, MantidVec &Y,
+                  MantidVec &E) const;
+
+private:
+  bool detectLinear();
+  bool detectLogarithmic();
+  void estimateLinearBins(const double *tofs, const std::size_t numEvents,
+                          int *bins) const;
+  void estimateLogarithmicBins(const double *tofs, const std::size_t numEvents,
+                               int *bins) const;
+
+  /// The bin edges
+  const MantidVec &m_X;
+  /// Number of bins, i.e. X.size() - 1
+  std::size_t m_numBins;
+  /// The kind of binning detected
+  BinningType m_binningType;
+  /// X[0] for linear binning, log(X[0]) for logarithmic binning
+  double m_start;
+  /// Inverse of the bin width (linear) or of its logarithm (logarithmic)
+  double m_inverseStep;
+};
+
+/** Add one count per event to Y for a range of event structs.
+ * @param first :: iterator to the first event
+ * @param last :: iterator past the last event
+ * @param Y :: The counts histogram, sized numBins()
+ */
+template <class InputIt>
+void EventHistogrammer::addCounts(InputIt first, InputIt last,
+                                  MantidVec &Y) const {
+  std::array<double, BLOCK_SIZE> tofs;
+  while (first != last) {
+    std::size_t n = 0;
+    for (; first != last && n < BLOCK_SIZE; ++first, ++n)
+      tofs[n] = first->tof();
+    addCounts(tofs.data(), n, Y);
+  }
+}
+
+/** Add the weight and squared error of each event to Y and E for a range of
+ * event structs. E is left holding squared errors.
+ * @param first :: iterator to the first event
+ * @param last :: iterator past the last event
+ * @param Y :: The summed weights, sized numBins()
+ * @param E :: The summed squared errors, sized numBins()
+ */
+template <class InputIt>
+void EventHistogrammer::addWeights(InputIt first, InputIt last, MantidVec &Y,
+                                   MantidVec &E) const {
+  std::array<double, BLOCK_SIZE> tofs;
+  std::array<float, BLOCK_SIZE> weights;
+  std::array<float, BLOCK_SIZE> errorSquareds;
+  while (first != last) {
+    std::size_t n = 0;
+    for (; first != last && n < BLOCK_SIZE; ++first, ++n) {
+      tofs[n] = first->tof();
+      weights[n] = static_cast<float>(first->weight());
+      errorSquareds[n] = static_cast<float>(first->errorSquared());
+    }
+    addWeights(tofs.data(), weights.data(), errorSquareds.data(), n, Y, E);
+  }
+}
+
+} // namespace DataObjects
+} // namespace Mantid
+
+#endif /* MANTID_DATAOBJECTS_EVENTHISTOGRAMMER_H_ */
@@ -6,7 +6,9 @@
 #include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/System.h"
 #include "MantidKernel/cow_ptr.h"
+#include <atomic>
 #include <iosfwd>
+#include <memory>
 #include <vector>
 
 namespace Mantid {
@@ -21,6 +23,8 @@ typedef std::vector<SplittingInterval> TimeSplitterType;
 class Unit;
 } // namespace Kernel
 namespace DataObjects {
+class CompressedEvents;
+class EventColumns;
 class EventWorkspaceMRU;
 
 /// How the event list is sorted.
@@ -33,6 +37,9 @@ enum EventSortType {
   TIMEATSAMPLE_SORT
 };
 
+/// How the events of the list are laid out in memory.
+enum EventStorageType { STRUCT_STORAGE, COLUMN_STORAGE, COMPRESSED_STORAGE };
+
 //==========================================================================================
 /** @class Mantid::DataObjects::EventList
 
@@ -45,6 +52,17 @@ enum EventSortType {
     or WeightedEvent (where each neutron can have a non-1 weight).
     This is done transparently.
 
+    The events are normally held as a vector of event structs. They can
+    instead be held in column storage (see EventColumns), which speeds up
+    operations that only read or change the time-of-flight, or compressed
+    (see CompressedEvents) to reduce the memory used by lists that are kept
+    for a long time. Compressed lists can be histogrammed and filtered or
+    split by pulse time without being expanded. Const operations that have
+    no implementation for the storage in use, including the const getEvents()
+    family of accessors, work on a decoded copy of the events that is kept
+    next to the packed storage, so concurrent readers are safe. Changing the
+    events switches the list back to struct storage first.
+
     @author Janik Zikovsky, SNS ORNL
     @date 4/02/2010
 
@@ -119,6 +137,8 @@ public:
    * @param event :: TofEvent to add at the end of the list.
    * */
   inline void addEventQuickly(const Types::Event::TofEvent &event) {
+    if (m_columns || m_compressed)
+      unpackEvents();
     this->events.push_back(event);
     this->order = UNSORTED;
   }
@@ -129,6 +149,8 @@ public:
    * @param event :: WeightedEvent to add at the end of the list.
    * */
   inline void addEventQuickly(const WeightedEvent &event) {
+    if (m_columns || m_compressed)
+      unpackEvents();
     this->weightedEvents.push_back(event);
     this->order = UNSORTED;
   }
@@ -139,6 +161,8 @@ public:
    * @param event :: WeightedEventNoTime to add at the end of the list.
    * */
   inline void addEventQuickly(const WeightedEventNoTime &event) {
+    if (m_columns || m_compressed)
+      unpackEvents();
     this->weightedEventsNoTime.push_back(event);
     this->order = UNSORTED;
   }
@@ -167,6 +191,10 @@ public:
 
   void reserve(size_t num) override;
 
+  void setStorageType(const EventStorageType type);
+
+  EventStorageType getStorageType() const;
+
   void sort(const EventSortType order) const;
 
   void setSortOrder(const EventSortType order) const;
@@ -398,6 +426,20 @@ private:
   /// MRU lists of the parent EventWorkspace
   mutable EventWorkspaceMRU *mru;
 
+  /// Column storage of the events. When set, the event vectors only hold a
+  /// decoded copy for const readers (see m_decoded).
+  std::unique_ptr<EventColumns> m_columns;
+
+  /// Compressed storage of the events. When set, the event vectors only hold
+  /// a decoded copy for const readers (see m_decoded).
+  std::unique_ptr<CompressedEvents> m_compressed;
+
+  /// True when the event vectors hold a decoded copy of the column or
+  /// compressed storage. Const methods decode but never release the packed
+  /// storage; sorts other than sortTof() of columns only reorder the copy,
+  /// and the sort order then describes the copy.
+  mutable std::atomic<bool> m_decoded{false};
+
   /// Mutex that is locked while sorting an event list
   mutable std::mutex m_sortMutex;
 
@@ -432,6 +474,8 @@ private:
 
   void switchToWeightedEvents();
   void switchToWeightedEventsNoTime();
+  void unpackEvents();
+  void decodeEvents() const;
   // should not be called externally
   void sortPulseTimeTOFDelta(const Types::Core::DateAndTime &start,
                              const double seconds) const;
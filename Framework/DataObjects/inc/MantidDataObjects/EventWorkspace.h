@@ -123,6 +123,9 @@ public:
   // Change the event type
   void switchEventType(const Mantid::API::EventType type);
 
+  // Change how the events of every list are held in memory
+  void setEventStorageType(const EventStorageType type);
+
   // Returns true always - an EventWorkspace always represents histogramm-able
   // data
   bool isHistogramData() const override;
@@ -141,6 +141,8 @@ public:
   size_t addEvents(const std::vector<MDE> &events) override;
   // unhide MDBoxBase methods
   size_t addEventsUnsafe(const std::vector<MDE> &events) override;
+  // sort the events in memory along a Morton curve through the box
+  void sortEventsAlongCurve();
 
   /*--------------->  EVENTS from event data
    * <-------------------------------------------------------------*/
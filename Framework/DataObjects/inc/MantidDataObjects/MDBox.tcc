@@ -3,6 +3,7 @@
 #include "MantidDataObjects/MDEvent.h"
 #include "MantidDataObjects/MDGridBox.h"
 #include "MantidDataObjects/MDLeanEvent.h"
+#include "MantidDataObjects/MortonCurve.h"
 #include "MantidKernel/DiskBuffer.h"
 #include <algorithm>
 #include <boost/math/special_functions/round.hpp>
@@ -816,6 +817,41 @@ TMDE(size_t MDBox)::addEvents(const std::vector<MDE> &events) {
   return 0;
 }
 
+//-----------------------------------------------------------------------------------------------
+/** Sort the events in memory by their position along a Morton curve through
+ * the box, so that events close to each other in space are mostly close to
+ * each other in memory and in the file. Does nothing if the events are in
+ * that order already.
+ */
+TMDE(void MDBox)::sortEventsAlongCurve() {
+  std::lock_guard<std::mutex> _lock(this->m_dataMutex);
+  if (this->data.size() < 2)
+    return;
+  coord_t min[nd], max[nd];
+  for (size_t d = 0; d < nd; ++d) {
+    min[d] = this->extents[d].getMin();
+    max[d] = this->extents[d].getMax();
+  }
+  const MortonCurve curve(nd, min, max);
+
+  std::vector<std::pair<uint64_t, size_t>> keys(this->data.size());
+  bool sorted = true;
+  for (size_t i = 0; i < this->data.size(); ++i) {
+    keys[i] = std::make_pair(curve.key(this->data[i].getCenter()), i);
+    if (i > 0 && keys[i].first < keys[i - 1].first)
+      sorted = false;
+  }
+  if (sorted)
+    return;
+
+  std::sort(keys.begin(), keys.end());
+  std::vector<MDE> sortedData;
+  sortedData.reserve(this->data.size());
+  for (const auto &key : keys)
+    sortedData.push_back(this->data[key.second]);
+  this->data.swap(sortedData);
+}
+
 /**Make this box file-backed
 * @param fileLocation -- the starting position of this box data are/should be
 * located in the direct access file
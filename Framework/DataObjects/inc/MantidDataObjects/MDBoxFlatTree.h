@@ -96,6 +96,10 @@ private:
   /**Load the part of the box structure, responsible for locating events only*/
   /**Save flat box structure into properly open nexus file*/
   void saveBoxStructure(::NeXus::File *hFile);
+  /// the IDs of the boxes holding events, in the order of their data in file
+  std::vector<size_t> getLeafBoxesFileOrder() const;
+  void addLeafBoxesAlongCurve(API::IMDNode *box,
+                              std::vector<size_t> &order) const;
   //----------------------------------------------------------------------------------------------
   int m_nDim;
   // The name of the file the class will be working with
@@ -119,6 +123,8 @@ private:
   std::vector<API::IMDNode *> m_Boxes;
   /// XML representation of the box controller
   std::string m_bcXMLDescr;
+  /// true if the box data are laid out in file along a space-filling curve
+  bool m_curveOrder;
   /// name of the event type
   std::string m_eventType;
   /// shared pointer to multiple experiment info stored within the workspace
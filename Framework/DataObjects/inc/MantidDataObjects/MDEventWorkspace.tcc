@@ -592,6 +592,24 @@ TMDE(size_t MDEventWorkspace)::addEvents(const std::vector<MDE> &events) {
   return data->addEvents(events);
 }
 
+//-----------------------------------------------------------------------------------------------
+/** Add a vector of MDEvents to the workspace and split the boxes which fill
+ * up, in one pass. Several threads may add events at once.
+ * If the workspace has not been split into a MDGridBox yet, the events are
+ * only added, and splitAllIfNeeded() has to be called afterwards.
+ * Workspaces with a file back-end are not supported, see
+ * MDGridBox::addEventsAndSplit().
+ *
+ * @param events :: const ref. to a vector of events to copy into the boxes.
+ */
+TMDE(void MDEventWorkspace)::addEventsAndSplit(const std::vector<MDE> &events) {
+  auto gridBox = dynamic_cast<MDGridBox<MDE, nd> *>(data);
+  if (gridBox)
+    gridBox->addEventsAndSplit(events);
+  else
+    data->addEvents(events);
+}
+
 //-----------------------------------------------------------------------------------------------
 /** Split the contained MDBox into a MDGridBox or MDSplitBox, if it is not
  * that already.
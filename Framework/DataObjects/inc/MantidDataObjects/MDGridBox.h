@@ -169,6 +169,8 @@ public:
 
   void splitAllIfNeeded(Kernel::ThreadScheduler *ts = nullptr) override;
 
+  void addEventsAndSplit(const std::vector<MDE> &events);
+
   void refreshCache(Kernel::ThreadScheduler *ts = nullptr) override;
 
   bool getIsMasked() const override;
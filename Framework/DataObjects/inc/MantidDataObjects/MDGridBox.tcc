@@ -718,8 +718,11 @@ TMDE(void MDGridBox)::splitAllIfNeeded(Kernel::ThreadScheduler *ts) {
               boost::bind(&MDGridBox<MDE, nd>::splitContents, &*this, i, ts)));
         }
       } else {
-        // This box does NOT have enough events to be worth splitting, if it do
-        // have at least something in memory then,
+        // This box does NOT have enough events to be worth splitting, so
+        // its events are final and can be put in curve order.
+        if (this->m_BoxController->useSpaceFillingCurve())
+          box->sortEventsAlongCurve();
+        // If it do have at least something in memory then,
         Kernel::ISaveable *const pSaver(box->getISaveable());
         if (pSaver && box->getDataInMemorySize() > 0) {
           // Mark the box as "to-write" in DiskBuffer. If the buffer is full,
@@ -750,6 +753,68 @@ TMDE(void MDGridBox)::splitAllIfNeeded(Kernel::ThreadScheduler *ts) {
   }
 }
 
+//-----------------------------------------------------------------------------------------------
+/** Add events to the boxes below this grid box, splitting the boxes which
+ * fill up as the events are added, so that no separate splitAllIfNeeded()
+ * pass is needed.
+ *
+ * Several threads may add events at once. The events are first sorted into
+ * one vector per child, so that each child box is locked once per call. A
+ * MDBox child is filled and split while its mutex is held; grid boxes are
+ * never replaced, so the events for a MDGridBox child are passed down to it
+ * without holding any lock.
+ *
+ * Warning! No bounds checking is done (for performance). It must
+ * be known that the events are within the bounds of the grid box.
+ *
+ * Note! nPoints, signal and error must be re-calculated using refreshCache()
+ * after all events have been added.
+ *
+ * Not for file-backed workspaces: the disk buffer saves and clears the boxes
+ * queued for writing from whichever thread fills it, without taking the
+ * mutexes of the children.
+ *
+ * @param events :: the events to add
+ * @throw std::runtime_error if the workspace is file-backed
+ */
+TMDE(void MDGridBox)::addEventsAndSplit(const std::vector<MDE> &events) {
+  if (this->m_BoxController->isFileBacked())
+    throw std::runtime_error("MDGridBox::addEventsAndSplit() can not be used "
+                             "with file-backed workspaces");
+  std::vector<std::vector<MDE>> childEvents(numBoxes);
+  for (const auto &event : events) {
+    size_t cindex = calculateChildIndex(event);
+    // Events on the upper boundary of the last child go into the last box
+    if (cindex == numBoxes)
+      cindex = numBoxes - 1;
+    if (cindex < numBoxes)
+      childEvents[cindex].push_back(event);
+  }
+
+  const size_t id = this->getID();
+  for (size_t i = 0; i < numBoxes; ++i) {
+    if (childEvents[i].empty())
+      continue;
+    MDGridBox<MDE, nd> *gridBox;
+    {
+      std::lock_guard<std::mutex> lock(
+          this->m_BoxController->getChildMutex(id, i));
+      gridBox = dynamic_cast<MDGridBox<MDE, nd> *>(m_Children[i]);
+      if (!gridBox) {
+        auto box = dynamic_cast<MDBox<MDE, nd> *>(m_Children[i]);
+        if (!box)
+          continue;
+        box->addEvents(childEvents[i]);
+        if (this->m_BoxController->willSplit(box->getNPoints(),
+                                             box->getDepth()))
+          splitContents(i, nullptr);
+        continue;
+      }
+    }
+    gridBox->addEventsAndSplit(childEvents[i]);
+  }
+}
+
 //-----------------------------------------------------------------------------------------------
 /** Perform centerpoint binning of events, with bins defined
  * in axes perpendicular to the axes of the workspace.
@@ -109,6 +109,10 @@ public:
   void divide(const MDHistoWorkspace &b_ws);
   void divide(const signal_t signal, const signal_t error);
 
+  void multiplyAdd(const MDHistoWorkspace &b_ws, const MDHistoWorkspace &c_ws);
+  void multiplyAdd(const signal_t signal, const signal_t error,
+                   const MDHistoWorkspace &c_ws);
+
   void log(double filler = 0.0);
   void log10(double filler = 0.0);
   void exp();
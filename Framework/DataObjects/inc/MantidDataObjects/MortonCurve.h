@@ -0,0 +1,101 @@
+#ifndef MANTID_DATAOBJECTS_MORTONCURVE_H_
+#define MANTID_DATAOBJECTS_MORTONCURVE_H_
+
+#include "MantidGeometry/MDGeometry/MDTypes.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace Mantid {
+namespace DataObjects {
+
+/** MortonCurve : gives the position of points in a box along a Morton
+  (Z-order) curve through the box. Points sorted by their keys are mostly
+  close to the points next to them in the order, so that code working on
+  points of a small region touches few cache lines or disk pages.
+
+  The box is divided into 2^bits cells along each dimension, with as many
+  bits per dimension as fit into a 64-bit key. The key of a point interleaves
+  the bits of its cell indices, most significant bits first. Points outside
+  the box are given the key of the nearest cell.
+
+  Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+class MortonCurve {
+public:
+  /// Largest number of dimensions, with one bit per dimension
+  static const size_t MAX_DIMS = 64;
+
+  /** Constructor
+   * @param nd :: number of dimensions
+   * @param min :: the lower corner of the box, nd values
+   * @param max :: the upper corner of the box, nd values
+   */
+  MortonCurve(size_t nd, const coord_t *min, const coord_t *max)
+      : m_nd(nd), m_bits(0), m_min(min, min + nd), m_scale(nd) {
+    if (nd == 0 || nd > MAX_DIMS)
+      throw std::invalid_argument("MortonCurve: invalid number of dimensions");
+    m_bits = static_cast<unsigned int>(std::min<size_t>(64 / nd, 32));
+    const double nCells = std::ldexp(1.0, static_cast<int>(m_bits));
+    m_maxCell = (uint64_t(1) << m_bits) - 1;
+    for (size_t d = 0; d < nd; ++d) {
+      const double width = static_cast<double>(max[d]) - min[d];
+      m_scale[d] = width > 0 ? nCells / width : 0;
+    }
+  }
+
+  /// @return the number of bits of the cell index along each dimension
+  unsigned int bitsPerDimension() const { return m_bits; }
+
+  /** @return the key of a point
+   * @param point :: the coordinates of the point, nd values */
+  uint64_t key(const coord_t *point) const {
+    uint64_t cells[MAX_DIMS];
+    for (size_t d = 0; d < m_nd; ++d) {
+      const double cell = (point[d] - m_min[d]) * m_scale[d];
+      cells[d] = cell <= 0 ? 0 : cell >= static_cast<double>(m_maxCell)
+                                     ? m_maxCell
+                                     : static_cast<uint64_t>(cell);
+    }
+    uint64_t key = 0;
+    for (unsigned int bit = m_bits; bit-- > 0;)
+      for (size_t d = 0; d < m_nd; ++d)
+        key = (key << 1) | ((cells[d] >> bit) & 1u);
+    return key;
+  }
+
+private:
+  size_t m_nd;
+  unsigned int m_bits;
+  uint64_t m_maxCell;
+  std::vector<double> m_min;
+  /// number of cells per unit length along each dimension
+  std::vector<double> m_scale;
+};
+
+} // namespace DataObjects
+} // namespace Mantid
+
+#endif /* MANTID_DATAOBJECTS_MORTONCURVE_H_ */
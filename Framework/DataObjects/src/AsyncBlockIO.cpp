@@ -0,0 +1,540 @@
+#include "MantidDataObjects/AsyncBlockIO.h"
+
+#include <algorithm>
+#include <tuple>
+#include <type_traits>
+
+namespace Mantid {
+namespace DataObjects {
+
+namespace {
+/// Default amount of data waiting to be written, in bytes
+const size_t DEFAULT_WRITE_BUFFER_BYTES = 128 * 1024 * 1024;
+/// Default amount of data kept after being read ahead, in bytes
+const size_t DEFAULT_CACHE_BYTES = 16 * 1024 * 1024;
+/// Default number of rows read ahead when loading sequentially
+const uint64_t DEFAULT_READ_AHEAD_POINTS = 1 << 17;
+/// Largest number of rows read or written with one call
+const uint64_t MAX_JOINED_POINTS = 1 << 20;
+
+/// @return the values of a block of the type of the second argument
+std::vector<float> &valuesOf(AsyncBlockIO::Block &block, float) {
+  return block.floats;
+}
+std::vector<double> &valuesOf(AsyncBlockIO::Block &block, double) {
+  return block.doubles;
+}
+const std::vector<float> &valuesOf(const AsyncBlockIO::Block &block, float) {
+  return block.floats;
+}
+const std::vector<double> &valuesOf(const AsyncBlockIO::Block &block,
+                                    double) {
+  return block.doubles;
+}
+
+/// @return the memory used by the values of a block
+size_t sizeInBytes(const AsyncBlockIO::Block &block) {
+  return block.floats.size() * sizeof(float) +
+         block.doubles.size() * sizeof(double);
+}
+
+/// @return true if the block holds any of the rows [position, end)
+bool overlaps(const AsyncBlockIO::Block &block, uint64_t position,
+              uint64_t end) {
+  return block.position < end && position < block.end();
+}
+
+/// @return true if the block holds all of the rows [position, end)
+bool contains(const AsyncBlockIO::Block &block, uint64_t position,
+              uint64_t end, bool isDouble) {
+  return block.isDouble == isDouble && block.position <= position &&
+         end <= block.end();
+}
+} // namespace
+
+/** Constructor. No thread is started until there is work for it.
+ * @param nColumns :: number of values per row (event)
+ * @param read :: function reading a block from the file
+ * @param write :: function writing a block to the file
+ * @param flush :: function flushing the data written to the disk
+ */
+AsyncBlockIO::AsyncBlockIO(size_t nColumns, ReadFunction read,
+                           WriteFunction write, FlushFunction flush)
+    : m_nColumns(nColumns), m_read(std::move(read)), m_write(std::move(write)),
+      m_flush(std::move(flush)), m_maxWriteBytes(DEFAULT_WRITE_BUFFER_BYTES),
+      m_maxCacheBytes(DEFAULT_CACHE_BYTES),
+      m_readAheadPoints(DEFAULT_READ_AHEAD_POINTS) {}
+
+/// Destructor. Writes the blocks still queued; call stop() to see any errors
+AsyncBlockIO::~AsyncBlockIO() {
+  try {
+    this->stop();
+  } catch (...) {
+    // Nowhere to report to
+  }
+}
+
+/** Queue a block to be written. The data are copied. This only waits if the
+ * blocks already queued exceed the size of the write buffer.
+ * @param data :: the rows to write
+ * @param position :: the position in the file, in rows
+ */
+void AsyncBlockIO::save(const std::vector<float> &data, uint64_t position) {
+  this->saveBlock(data, position);
+}
+
+/// @copydoc save(const std::vector<float> &, uint64_t)
+void AsyncBlockIO::save(const std::vector<double> &data, uint64_t position) {
+  this->saveBlock(data, position);
+}
+
+/** Load a block, from the blocks waiting to be written or read ahead if
+ * possible and from the file otherwise.
+ * @param data :: set to the rows loaded
+ * @param position :: the position in the file, in rows
+ * @param nPoints :: the number of rows to load
+ */
+void AsyncBlockIO::load(std::vector<float> &data, uint64_t position,
+                        size_t nPoints) {
+  this->loadBlock(data, position, nPoints);
+}
+
+/// @copydoc load(std::vector<float> &, uint64_t, size_t)
+void AsyncBlockIO::load(std::vector<double> &data, uint64_t position,
+                        size_t nPoints) {
+  this->loadBlock(data, position, nPoints);
+}
+
+/** Ask for a block to be read in the background, as it will be loaded soon.
+ * @param position :: the position in the file, in rows
+ * @param nPoints :: the number of rows
+ * @param isDouble :: true if the block will be loaded as doubles
+ */
+void AsyncBlockIO::readAhead(uint64_t position, size_t nPoints,
+                             bool isDouble) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  const uint64_t start = this->endOfQueuedData(position, isDouble);
+  if (start < position + nPoints)
+    this->queueRead(start, position + nPoints - start, isDouble);
+}
+
+/// Flush the data to the disk once the blocks queued have been written
+void AsyncBlockIO::flushInBackground() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_flushRequested = true;
+  this->startThread();
+  m_workQueued.notify_one();
+}
+
+/** Write the blocks queued and flush the data to the disk. Passes on any
+ * error of the background thread.
+ */
+void AsyncBlockIO::flush() {
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_flushRequested = true;
+  this->startThread();
+  m_workQueued.notify_one();
+  m_workDone.wait(lock, [this]() {
+    return m_writes.empty() && !m_flushRequested && !m_flushing;
+  });
+  this->rethrowError();
+}
+
+/// Wait for all queued work, including reading ahead, to finish
+void AsyncBlockIO::wait() {
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_workDone.wait(lock, [this]() {
+    return m_writes.empty() && !m_flushRequested && !m_flushing &&
+           m_readRequests.empty() && !m_reading;
+  });
+  this->rethrowError();
+}
+
+/** Write the blocks queued, drop the blocks read ahead and stop the
+ * background thread. Passes on any error of the background thread.
+ */
+void AsyncBlockIO::stop() {
+  std::unique_lock<std::mutex> lock(m_mutex);
+  if (m_thread.joinable()) {
+    m_stop = true;
+    m_readRequests.clear();
+    m_workQueued.notify_one();
+    lock.unlock();
+    m_thread.join();
+    lock.lock();
+    m_stop = false;
+  }
+  m_cache.clear();
+  m_cacheBytes = 0;
+  this->rethrowError();
+}
+
+/** Set the sizes of the buffers.
+ * @param writeBufferBytes :: largest amount of data waiting to be written
+ * @param cacheBytes :: largest amount of data kept after being read ahead
+ * @param readAheadPoints :: number of rows read ahead when loading
+ * sequentially; 0 to only read ahead on request
+ */
+void AsyncBlockIO::setBufferSizes(size_t writeBufferBytes, size_t cacheBytes,
+                                  uint64_t readAheadPoints) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_maxWriteBytes = writeBufferBytes;
+  m_maxCacheBytes = cacheBytes;
+  m_readAheadPoints = readAheadPoints;
+}
+
+template <typename T>
+void AsyncBlockIO::saveBlock(const std::vector<T> &data, uint64_t position) {
+  auto block = std::make_shared<Block>();
+  block->position = position;
+  block->nPoints = data.size() / m_nColumns;
+  block->isDouble = std::is_same<T, double>::value;
+  valuesOf(*block, T()) = data;
+  const size_t bytes = sizeInBytes(*block);
+
+  std::unique_lock<std::mutex> lock(m_mutex);
+  this->rethrowError();
+  // Wait for room in the buffer, but always take a block if it is empty
+  m_workDone.wait(lock, [this, bytes]() {
+    return m_writeBytes == 0 || m_writeBytes + bytes <= m_maxWriteBytes ||
+           m_error;
+  });
+  this->rethrowError();
+  this->dropOverlapping(block->position, block->end());
+  if (m_knownFileEnd < block->end())
+    m_knownFileEnd = block->end();
+  m_writes.push_back(block);
+  m_writeBytes += bytes;
+  this->startThread();
+  m_workQueued.notify_one();
+}
+
+template <typename T>
+void AsyncBlockIO::loadBlock(std::vector<T> &data, uint64_t position,
+                             size_t nPoints) {
+  const bool isDouble = std::is_same<T, double>::value;
+  std::unique_lock<std::mutex> lock(m_mutex);
+  this->rethrowError();
+  if (!this->loadFromMemory(lock, data, position, nPoints)) {
+    lock.unlock();
+    Block block;
+    block.position = position;
+    block.nPoints = nPoints;
+    block.isDouble = isDouble;
+    m_read(block);
+    data.swap(valuesOf(block, T()));
+    lock.lock();
+  }
+  this->noteLoad(position, position + nPoints, isDouble);
+}
+
+/** Copy rows from a block held in memory.
+ * @param from :: a block holding all the rows
+ * @param data :: set to the rows
+ * @param position :: the position of the first row in the file
+ * @param nPoints :: the number of rows
+ */
+template <typename T>
+void AsyncBlockIO::copyRows(const Block &from, std::vector<T> &data,
+                            uint64_t position, size_t nPoints) const {
+  const auto &values = valuesOf(from, T());
+  const auto first =
+      values.begin() +
+      static_cast<std::ptrdiff_t>((position - from.position) * m_nColumns);
+  data.assign(first, first + static_cast<std::ptrdiff_t>(nPoints * m_nColumns));
+}
+
+/** Load rows from the blocks waiting to be written or read ahead. Waits for
+ * the blocks holding only some of the rows to be written.
+ * @param lock :: the lock held on m_mutex
+ * @param data :: set to the rows, if found
+ * @param position :: the position of the first row in the file
+ * @param nPoints :: the number of rows
+ * @return true if the rows were found
+ */
+template <typename T>
+bool AsyncBlockIO::loadFromMemory(std::unique_lock<std::mutex> &lock,
+                                  std::vector<T> &data, uint64_t position,
+                                  size_t nPoints) {
+  const bool isDouble = std::is_same<T, double>::value;
+  const uint64_t end = position + nPoints;
+  // The block saved last holds the current values
+  for (;;) {
+    auto newest = std::find_if(m_writes.rbegin(), m_writes.rend(),
+                               [position, end](const BlockPtr &block) {
+                                 return overlaps(*block, position, end);
+                               });
+    if (newest == m_writes.rend())
+      break;
+    if (contains(**newest, position, end, isDouble)) {
+      this->copyRows(**newest, data, position, nPoints);
+      ++m_numCachedLoads;
+      return true;
+    }
+    m_workDone.wait(lock);
+    this->rethrowError();
+  }
+
+  auto cached = std::find_if(m_cache.begin(), m_cache.end(),
+                             [position, end, isDouble](const BlockPtr &block) {
+                               return contains(*block, position, end, isDouble);
+                             });
+  if (cached == m_cache.end())
+    return false;
+  this->copyRows(**cached, data, position, nPoints);
+  // Keep the blocks used most recently longest
+  m_cache.splice(m_cache.end(), m_cache, cached);
+  ++m_numCachedLoads;
+  return true;
+}
+
+/// The loop of the background thread
+void AsyncBlockIO::run() {
+  std::unique_lock<std::mutex> lock(m_mutex);
+  for (;;) {
+    m_workQueued.wait(lock, [this]() {
+      return m_stop || !m_writes.empty() || m_flushRequested ||
+             !m_readRequests.empty();
+    });
+    if (!m_writes.empty())
+      this->writeQueued(lock);
+    else if (m_flushRequested)
+      this->flushQueued(lock);
+    else if (m_stop)
+      break;
+    else
+      this->readQueued(lock);
+    m_workDone.notify_all();
+  }
+}
+
+/** Write all the blocks queued, joining adjacent ones.
+ * @param lock :: the lock held on m_mutex; released while writing
+ */
+void AsyncBlockIO::writeQueued(std::unique_lock<std::mutex> &lock) {
+  const std::vector<BlockPtr> blocks(m_writes.begin(), m_writes.end());
+  lock.unlock();
+
+  // Write in file order, unless a part of the file is written twice
+  std::vector<BlockPtr> ordered(blocks);
+  std::stable_sort(ordered.begin(), ordered.end(),
+                   [](const BlockPtr &lhs, const BlockPtr &rhs) {
+                     return lhs->position < rhs->position;
+                   });
+  for (size_t i = 1; i < ordered.size(); ++i) {
+    if (ordered[i - 1]->end() > ordered[i]->position) {
+      ordered = blocks;
+      break;
+    }
+  }
+
+  std::exception_ptr error;
+  try {
+    for (size_t first = 0; first < ordered.size();) {
+      const Block &block = *ordered[first];
+      // Join the following blocks that continue this one
+      size_t last = first + 1;
+      uint64_t nPoints = block.nPoints;
+      while (last < ordered.size() &&
+             ordered[last]->position == ordered[last - 1]->end() &&
+             ordered[last]->isDouble == block.isDouble &&
+             nPoints + ordered[last]->nPoints <= MAX_JOINED_POINTS) {
+        nPoints += ordered[last]->nPoints;
+        ++last;
+      }
+      if (last == first + 1) {
+        m_write(block);
+      } else {
+        Block joined;
+        joined.position = block.position;
+        joined.nPoints = nPoints;
+        joined.isDouble = block.isDouble;
+        joined.floats.reserve(block.isDouble ? 0 : nPoints * m_nColumns);
+        joined.doubles.reserve(block.isDouble ? nPoints * m_nColumns : 0);
+        for (size_t i = first; i < last; ++i) {
+          joined.floats.insert(joined.floats.end(), ordered[i]->floats.begin(),
+                               ordered[i]->floats.end());
+          joined.doubles.insert(joined.doubles.end(),
+                                ordered[i]->doubles.begin(),
+                                ordered[i]->doubles.end());
+        }
+        m_write(joined);
+      }
+      ++m_numWrites;
+      first = last;
+    }
+  } catch (...) {
+    error = std::current_exception();
+  }
+
+  lock.lock();
+  if (error && !m_error)
+    m_error = error;
+  for (const auto &block : blocks)
+    m_writeBytes -= sizeInBytes(*block);
+  m_writes.erase(m_writes.begin(),
+                 m_writes.begin() + static_cast<std::ptrdiff_t>(blocks.size()));
+}
+
+/** Read the first of the blocks requested, joined with the requests that
+ * continue it, and keep it in the cache.
+ * @param lock :: the lock held on m_mutex; released while reading
+ */
+void AsyncBlockIO::readQueued(std::unique_lock<std::mutex> &lock) {
+  std::sort(m_readRequests.begin(), m_readRequests.end(),
+            [](const BlockPtr &lhs, const BlockPtr &rhs) {
+              return std::tie(lhs->isDouble, lhs->position) <
+                     std::tie(rhs->isDouble, rhs->position);
+            });
+  auto block = std::make_shared<Block>(*m_readRequests.front());
+  auto next = m_readRequests.begin() + 1;
+  for (; next != m_readRequests.end(); ++next) {
+    const Block &request = **next;
+    const uint64_t end = std::max(block->end(), request.end());
+    if (request.isDouble != block->isDouble ||
+        request.position > block->end() ||
+        end - block->position > MAX_JOINED_POINTS)
+      break;
+    block->nPoints = end - block->position;
+  }
+  m_readRequests.erase(m_readRequests.begin(), next);
+  if (this->endOfQueuedData(block->position, block->isDouble) >= block->end())
+    return;
+
+  m_reading = block;
+  m_readingOutdated = false;
+  const uint64_t requested = block->nPoints;
+  lock.unlock();
+  bool success = true;
+  try {
+    m_read(*block);
+  } catch (...) {
+    // The error shows when the block is loaded
+    success = false;
+  }
+  ++m_numReads;
+  lock.lock();
+  m_reading.reset();
+
+  if (!success)
+    return;
+  if (block->nPoints < requested)
+    m_knownFileEnd = block->end();
+  if (m_readingOutdated || block->nPoints == 0)
+    return;
+  m_cache.push_back(block);
+  m_cacheBytes += sizeInBytes(*block);
+  while (m_cacheBytes > m_maxCacheBytes && m_cache.size() > 1) {
+    m_cacheBytes -= sizeInBytes(*m_cache.front());
+    m_cache.pop_front();
+  }
+}
+
+/** Flush the data written to the disk.
+ * @param lock :: the lock held on m_mutex; released while flushing
+ */
+void AsyncBlockIO::flushQueued(std::unique_lock<std::mutex> &lock) {
+  m_flushRequested = false;
+  m_flushing = true;
+  lock.unlock();
+  std::exception_ptr error;
+  try {
+    m_flush();
+  } catch (...) {
+    error = std::current_exception();
+  }
+  lock.lock();
+  m_flushing = false;
+  if (error && !m_error)
+    m_error = error;
+}
+
+/// Start the background thread if it is not running. Call with m_mutex held.
+void AsyncBlockIO::startThread() {
+  if (!m_thread.joinable())
+    m_thread = std::thread(&AsyncBlockIO::run, this);
+}
+
+/** Drop the blocks read ahead that hold any of the rows [position, end),
+ * which are about to be written.
+ */
+void AsyncBlockIO::dropOverlapping(uint64_t position, uint64_t end) {
+  for (auto it = m_cache.begin(); it != m_cache.end();) {
+    if (overlaps(**it, position, end)) {
+      m_cacheBytes -= sizeInBytes(**it);
+      it = m_cache.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  if (m_reading && overlaps(*m_reading, position, end))
+    m_readingOutdated = true;
+}
+
+/** @return the end of the rows following position that are read ahead or
+ * about to be, or position if there are none
+ */
+uint64_t AsyncBlockIO::endOfQueuedData(uint64_t position,
+                                       bool isDouble) const {
+  uint64_t end = position;
+  bool extended = true;
+  const auto extend = [&end, &extended, isDouble](const BlockPtr &block) {
+    if (block && block->isDouble == isDouble && block->position <= end &&
+        end < block->end()) {
+      end = block->end();
+      extended = true;
+    }
+  };
+  while (extended) {
+    extended = false;
+    for (const auto &block : m_cache)
+      extend(block);
+    for (const auto &block : m_readRequests)
+      extend(block);
+    extend(m_reading);
+  }
+  return end;
+}
+
+/// Queue a block to be read in the background. Call with m_mutex held.
+void AsyncBlockIO::queueRead(uint64_t position, uint64_t nPoints,
+                             bool isDouble) {
+  if (nPoints == 0 || position >= m_knownFileEnd)
+    return;
+  auto block = std::make_shared<Block>();
+  block->position = position;
+  block->nPoints = nPoints;
+  block->isDouble = isDouble;
+  m_readRequests.push_back(block);
+  this->startThread();
+  m_workQueued.notify_one();
+}
+
+/** Read ahead if the loads are sequential. Call with m_mutex held.
+ * @param position :: the first row loaded
+ * @param end :: the end of the rows loaded
+ * @param isDouble :: true if the rows were loaded as doubles
+ */
+void AsyncBlockIO::noteLoad(uint64_t position, uint64_t end, bool isDouble) {
+  const bool sequential = position >= m_lastLoadEnd &&
+                          position - m_lastLoadEnd <= m_readAheadPoints / 4;
+  m_lastLoadEnd = end;
+  if (!sequential || m_readAheadPoints == 0)
+    return;
+  // Keep at least half a read-ahead block ahead of the loads
+  const uint64_t queuedEnd = this->endOfQueuedData(end, isDouble);
+  if (queuedEnd - end < m_readAheadPoints / 2)
+    this->queueRead(queuedEnd, m_readAheadPoints, isDouble);
+}
+
+/// Pass on the error of the background thread, if any. Call with m_mutex held.
+void AsyncBlockIO::rethrowError() {
+  if (m_error) {
+    std::exception_ptr error;
+    std::swap(error, m_error);
+    std::rethrow_exception(error);
+  }
+}
+
+} // namespace DataObjects
+} // namespace Mantid
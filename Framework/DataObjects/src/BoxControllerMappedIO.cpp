@@ -0,0 +1,432 @@
+#include "MantidDataObjects/BoxControllerMappedIO.h"
+#include "MantidAPI/FileFinder.h"
+#include "MantidDataObjects/MDEvent.h"
+#include "MantidDataObjects/MDLeanEvent.h"
+#include "MantidKernel/ConfigService.h"
+#include "MantidKernel/Exception.h"
+#include "MantidKernel/Logger.h"
+#include "MantidKernel/make_unique.h"
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/version.hpp>
+
+#include <Poco/File.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace Mantid {
+namespace DataObjects {
+
+namespace {
+/// static logger
+Kernel::Logger g_log("BoxControllerMappedIO");
+
+/// Identifies the event files written by this class
+const char EVENT_FILE_MAGIC[8] = {'M', 'D', 'E', 'V', 'E', 'N', 'T', 'S'};
+/// Version of the layout of the event files
+const uint32_t EVENT_FILE_VERSION = 1;
+/// Extension added to the name of the NeXus file to name the event file
+const std::string EVENT_FILE_EXTENSION(".events");
+
+/// The start of the event file
+struct EventFileHeader {
+  char magic[8];
+  uint32_t version;
+  /// size of the values in bytes, 4 or 8
+  uint32_t coordSize;
+  /// index of the event type, 0 for MDLeanEvent and 1 for MDEvent
+  uint32_t eventType;
+  /// number of values per event
+  uint32_t nColumns;
+  /// offset of the first event in bytes
+  uint64_t dataOffset;
+  /// number of events, including free space
+  uint64_t nPoints;
+  /// offset of the free space blocks in bytes and number of values there
+  uint64_t freeSpaceOffset;
+  uint64_t nFreeSpaceValues;
+};
+
+/** Copy values, converting them to another floating point type if needed
+ * @param from :: the first value to copy
+ * @param nValues :: the number of values
+ * @param to :: where to copy them */
+template <typename FROM, typename TO>
+void copyValues(const FROM *from, size_t nValues, TO *to) {
+  std::transform(from, from + nValues, to,
+                 [](FROM value) { return static_cast<TO>(value); });
+}
+} // namespace
+
+/** Constructor
+ * @param bc :: the box controller using this IO
+ */
+BoxControllerMappedIO::BoxControllerMappedIO(API::BoxController *const bc)
+    : m_ReadOnly(true), m_bc(bc), m_nColumns(4 + bc->getNDims()),
+      m_CoordSize(sizeof(coord_t)), m_fileCoordSize(sizeof(coord_t)),
+      m_EventType(1), m_dataOffset(0), m_capacity(0) {
+  m_EventsTypesSupported.push_back(MDLeanEvent<1>::getTypeName());
+  m_EventsTypesSupported.push_back(MDEvent<1>::getTypeName());
+}
+
+BoxControllerMappedIO::~BoxControllerMappedIO() {
+  try {
+    this->closeFile();
+  } catch (std::exception &error) {
+    g_log.error() << "Failed to write the events to " << m_eventFileName
+                  << ": " << error.what() << "\n";
+  }
+}
+
+/** @return the name of the event file belonging to a NeXus file
+ * @param fileName :: the full name of the NeXus file of the workspace */
+std::string BoxControllerMappedIO::eventFileName(const std::string &fileName) {
+  return fileName + EVENT_FILE_EXTENSION;
+}
+
+/** @return true if the events of the workspace saved in a NeXus file are in
+ * an event file rather than in the NeXus file
+ * @param fileName :: the full name of the NeXus file of the workspace */
+bool BoxControllerMappedIO::hasEventFile(const std::string &fileName) {
+  return Poco::File(eventFileName(fileName)).exists();
+}
+
+/** Set the event type and the size of the event coordinates used in the
+ * save/load operations.
+ * @param blockSize :: size of the coordinates in bytes, 4 or 8
+ * @param typeName :: the name of the event type, MDLeanEvent or MDEvent
+ */
+void BoxControllerMappedIO::setDataType(const size_t blockSize,
+                                        const std::string &typeName) {
+  if (blockSize != 4 && blockSize != 8)
+    throw std::invalid_argument("The class currently supports 4(float) and "
+                                "8(double) event coordinates only");
+  auto it = std::find(m_EventsTypesSupported.begin(),
+                      m_EventsTypesSupported.end(), typeName);
+  if (it == m_EventsTypesSupported.end())
+    throw std::invalid_argument("Unsupported event type: " + typeName +
+                                " provided ");
+
+  m_CoordSize = blockSize;
+  m_EventType = std::distance(m_EventsTypesSupported.begin(), it);
+  m_nColumns = (m_EventType == 0 ? 2 : 4) + m_bc->getNDims();
+}
+
+/** Get the event type and the size of the event coordinates used in the
+ * save/load operations.
+ * @param CoordSize :: size of the coordinates in bytes
+ * @param typeName :: the name of the event type
+ */
+void BoxControllerMappedIO::getDataType(size_t &CoordSize,
+                                        std::string &typeName) const {
+  CoordSize = m_CoordSize;
+  typeName = m_EventsTypesSupported[m_EventType];
+}
+
+/** Open the event file of a NeXus file, creating it if it does not exist and
+ * the file is opened for writing.
+ * @param fileName :: the name of the NeXus file of the workspace. Searched
+ * for within the Mantid search path.
+ * @param mode :: opening mode, for read/write if it contains w or W
+ * @return false if the file had been already opened
+ */
+bool BoxControllerMappedIO::openFile(const std::string &fileName,
+                                     const std::string &mode) {
+  if (this->isOpened())
+    return false;
+
+  std::lock_guard<std::shared_timed_mutex> lock(m_fileMutex);
+  m_ReadOnly = mode.find('w') == std::string::npos &&
+               mode.find('W') == std::string::npos;
+
+  m_fileName = API::FileFinder::Instance().getFullPath(fileName);
+  if (m_fileName.empty()) {
+    if (m_ReadOnly)
+      throw Kernel::Exception::FileError("Can not open file to read ",
+                                         fileName);
+    const std::string filePath =
+        Kernel::ConfigService::Instance().getString("defaultsave.directory");
+    m_fileName = filePath.empty() ? fileName : filePath + "/" + fileName;
+  }
+  m_eventFileName = eventFileName(m_fileName);
+
+  if (!Poco::File(m_eventFileName).exists()) {
+    if (m_ReadOnly)
+      throw Kernel::Exception::FileError("The event file does not exist ",
+                                         m_eventFileName);
+    this->createEventFile();
+    return true;
+  }
+  try {
+    this->openEventFile();
+  } catch (...) {
+    // leave the file closed
+    m_region.reset();
+    m_mapping.reset();
+    throw;
+  }
+  return true;
+}
+
+/// Create an event file without events and map it
+void BoxControllerMappedIO::createEventFile() {
+  m_fileCoordSize = m_CoordSize;
+  m_dataOffset = boost::interprocess::mapped_region::get_page_size();
+
+  Poco::File file(m_eventFileName);
+  file.createFile();
+  file.setSize(m_dataOffset);
+  this->mapEventFile(m_dataOffset);
+  this->setFileLength(0);
+  this->writeHeader();
+}
+
+/// Map an existing event file and check that it holds the events expected
+void BoxControllerMappedIO::openEventFile() {
+  const uint64_t fileSize = Poco::File(m_eventFileName).getSize();
+  if (fileSize < sizeof(EventFileHeader))
+    throw Kernel::Exception::FileError("Not an MD event file ",
+                                       m_eventFileName);
+  this->mapEventFile(fileSize);
+
+  EventFileHeader header;
+  std::memcpy(&header, m_region->get_address(), sizeof(header));
+  if (std::memcmp(header.magic, EVENT_FILE_MAGIC, sizeof(header.magic)) != 0 ||
+      header.version != EVENT_FILE_VERSION)
+    throw Kernel::Exception::FileError("Not an MD event file ",
+                                       m_eventFileName);
+  if (header.eventType != m_EventType || header.nColumns != m_nColumns)
+    throw Kernel::Exception::FileError(
+        "Trying to open event data with different event type or number of "
+        "dimensions ",
+        m_eventFileName);
+  if (header.coordSize != 4 && header.coordSize != 8)
+    throw Kernel::Exception::FileError("Unknown events data format ",
+                                       m_eventFileName);
+  m_fileCoordSize = header.coordSize;
+  m_dataOffset = header.dataOffset;
+
+  const uint64_t freeSpaceEnd =
+      header.freeSpaceOffset + header.nFreeSpaceValues * sizeof(uint64_t);
+  if (m_dataOffset + header.nPoints * this->rowBytes() > fileSize ||
+      freeSpaceEnd > fileSize)
+    throw Kernel::Exception::FileError("The event file is truncated ",
+                                       m_eventFileName);
+  m_capacity = (fileSize - m_dataOffset) / this->rowBytes();
+
+  std::vector<uint64_t> freeSpaceBlocks(header.nFreeSpaceValues);
+  if (!freeSpaceBlocks.empty()) {
+    std::memcpy(freeSpaceBlocks.data(),
+                static_cast<const char *>(m_region->get_address()) +
+                    header.freeSpaceOffset,
+                freeSpaceBlocks.size() * sizeof(uint64_t));
+    this->setFreeSpaceVector(freeSpaceBlocks);
+  }
+  this->setFileLength(header.nPoints);
+}
+
+/** Map the whole event file, replacing any previous mapping
+ * @param fileSize :: the size of the file in bytes */
+void BoxControllerMappedIO::mapEventFile(uint64_t fileSize) const {
+  using namespace boost::interprocess;
+  const boost::interprocess::mode_t mode =
+      m_ReadOnly ? read_only : read_write;
+  m_region.reset();
+  m_mapping.reset();
+  m_mapping = Kernel::make_unique<file_mapping>(m_eventFileName.c_str(), mode);
+  m_region = Kernel::make_unique<mapped_region>(*m_mapping, mode, 0,
+                                                static_cast<size_t>(fileSize));
+  m_capacity = fileSize > m_dataOffset
+                   ? (fileSize - m_dataOffset) / this->rowBytes()
+                   : 0;
+}
+
+/** Grow the event file to hold at least a number of events. The file grows
+ * by half its size at least, so that saving boxes one by one remaps it
+ * rarely. Must be called with m_fileMutex locked.
+ * @param nPoints :: the number of events to hold
+ */
+void BoxControllerMappedIO::reserve(uint64_t nPoints) const {
+  if (nPoints <= m_capacity)
+    return;
+  const uint64_t growth =
+      std::max(m_capacity / 2, static_cast<uint64_t>(DATA_CHUNK));
+  const uint64_t capacity = std::max(nPoints, m_capacity + growth);
+  const uint64_t fileSize = m_dataOffset + capacity * this->rowBytes();
+  // The file cannot change size while it is mapped on all platforms
+  m_region.reset();
+  m_mapping.reset();
+  Poco::File(m_eventFileName).setSize(fileSize);
+  this->mapEventFile(fileSize);
+}
+
+/** Write the header of the event file. Must be called with m_fileMutex
+ * locked. The free space blocks are only written when the file is closed. */
+void BoxControllerMappedIO::writeHeader() const {
+  EventFileHeader header;
+  std::memcpy(header.magic, EVENT_FILE_MAGIC, sizeof(header.magic));
+  header.version = EVENT_FILE_VERSION;
+  header.coordSize = static_cast<uint32_t>(m_fileCoordSize);
+  header.eventType = static_cast<uint32_t>(m_EventType);
+  header.nColumns = static_cast<uint32_t>(m_nColumns);
+  header.dataOffset = m_dataOffset;
+  header.nPoints = this->getFileLength();
+  header.freeSpaceOffset = 0;
+  header.nFreeSpaceValues = 0;
+  std::memcpy(m_region->get_address(), &header, sizeof(header));
+}
+
+/** Save a data block at a position in the event file, growing the file if
+ * needed.
+ * @param DataBlock :: the values of the events to save
+ * @param blockPosition :: the position of the first event in the file
+ */
+template <typename Type>
+void BoxControllerMappedIO::saveGenericBlock(
+    const std::vector<Type> &DataBlock, const uint64_t blockPosition) const {
+  if (m_ReadOnly)
+    throw Kernel::Exception::FileError(
+        "Attempt to write to the event file opened for reading ",
+        m_eventFileName);
+  const uint64_t nPoints = DataBlock.size() / m_nColumns;
+  {
+    std::lock_guard<std::shared_timed_mutex> lock(m_fileMutex);
+    this->reserve(blockPosition + nPoints);
+    char *to = static_cast<char *>(m_region->get_address()) + m_dataOffset +
+               blockPosition * this->rowBytes();
+    if (m_fileCoordSize == sizeof(float))
+      copyValues(DataBlock.data(), DataBlock.size(),
+                 reinterpret_cast<float *>(to));
+    else
+      copyValues(DataBlock.data(), DataBlock.size(),
+                 reinterpret_cast<double *>(to));
+  }
+  this->extendFileLength(blockPosition + nPoints);
+}
+
+/** Load a data block from the event file
+ * @param Block :: the vector to place the values of the events into
+ * @param blockPosition :: the position of the first event in the file
+ * @param nPoints :: the number of events to load
+ */
+template <typename Type>
+void BoxControllerMappedIO::loadGenericBlock(std::vector<Type> &Block,
+                                             const uint64_t blockPosition,
+                                             const size_t nPoints) const {
+  if (blockPosition + nPoints > this->getFileLength())
+    throw Kernel::Exception::FileError("Attempt to read behind the file end ",
+                                       m_eventFileName);
+  Block.resize(nPoints * m_nColumns);
+  if (nPoints == 0)
+    return;
+
+  // Loads only read the mapping, so they run in parallel
+  std::shared_lock<std::shared_timed_mutex> lock(m_fileMutex);
+  const char *from = static_cast<const char *>(m_region->get_address()) +
+                     m_dataOffset + blockPosition * this->rowBytes();
+  if (m_fileCoordSize == sizeof(float))
+    copyValues(reinterpret_cast<const float *>(from), Block.size(),
+               Block.data());
+  else
+    copyValues(reinterpret_cast<const double *>(from), Block.size(),
+               Block.data());
+}
+
+/** Save a float data block at a position in the event file
+ * @param DataBlock :: the values of the events to save
+ * @param blockPosition :: the position of the first event in the file */
+void BoxControllerMappedIO::saveBlock(const std::vector<float> &DataBlock,
+                                      const uint64_t blockPosition) const {
+  this->saveGenericBlock(DataBlock, blockPosition);
+}
+
+/** Save a double data block at a position in the event file
+ * @param DataBlock :: the values of the events to save
+ * @param blockPosition :: the position of the first event in the file */
+void BoxControllerMappedIO::saveBlock(const std::vector<double> &DataBlock,
+                                      const uint64_t blockPosition) const {
+  this->saveGenericBlock(DataBlock, blockPosition);
+}
+
+/** Load a float data block from the event file
+ * @param Block :: the vector to place the values of the events into
+ * @param blockPosition :: the position of the first event in the file
+ * @param nPoints :: the number of events to load */
+void BoxControllerMappedIO::loadBlock(std::vector<float> &Block,
+                                      const uint64_t blockPosition,
+                                      const size_t nPoints) const {
+  this->loadGenericBlock(Block, blockPosition, nPoints);
+}
+
+/** Load a double data block from the event file
+ * @param Block :: the vector to place the values of the events into
+ * @param blockPosition :: the position of the first event in the file
+ * @param nPoints :: the number of events to load */
+void BoxControllerMappedIO::loadBlock(std::vector<double> &Block,
+                                      const uint64_t blockPosition,
+                                      const size_t nPoints) const {
+  this->loadGenericBlock(Block, blockPosition, nPoints);
+}
+
+/// Start writing the events saved so far to the disk, without waiting
+void BoxControllerMappedIO::flushData() const {
+  std::lock_guard<std::shared_timed_mutex> lock(m_fileMutex);
+  if (m_region && !m_ReadOnly)
+    m_region->flush();
+}
+
+/** Write out the data in the disk buffer and wait for all the events saved to
+ * be written to the disk, with a header describing them */
+void BoxControllerMappedIO::flushCache() {
+  DiskBuffer::flushCache();
+  std::lock_guard<std::shared_timed_mutex> lock(m_fileMutex);
+  if (m_region && !m_ReadOnly) {
+    this->writeHeader();
+#if BOOST_VERSION >= 105600
+    m_region->flush(0, 0, false);
+#else
+    m_region->flush();
+#endif
+  }
+}
+
+/** Write out the data in the disk buffer and the free space blocks, and
+ * close the event file */
+void BoxControllerMappedIO::closeFile() {
+  if (!this->isOpened())
+    return;
+  this->flushCache();
+
+  std::lock_guard<std::shared_timed_mutex> lock(m_fileMutex);
+  uint64_t fileSize(0);
+  if (!m_ReadOnly) {
+    std::vector<uint64_t> freeSpaceBlocks;
+    this->getFreeSpaceVector(freeSpaceBlocks);
+    const uint64_t nPoints = this->getFileLength();
+    const uint64_t freeSpaceOffset = m_dataOffset + nPoints * this->rowBytes();
+    const uint64_t freeSpaceBytes = freeSpaceBlocks.size() * sizeof(uint64_t);
+    this->reserve(nPoints + (freeSpaceBytes + this->rowBytes() - 1) /
+                                this->rowBytes());
+    char *base = static_cast<char *>(m_region->get_address());
+    if (freeSpaceBytes > 0)
+      std::memcpy(base + freeSpaceOffset, freeSpaceBlocks.data(),
+                  freeSpaceBytes);
+    this->writeHeader();
+    auto header = reinterpret_cast<EventFileHeader *>(base);
+    header->freeSpaceOffset = freeSpaceOffset;
+    header->nFreeSpaceValues = freeSpaceBlocks.size();
+    m_region->flush();
+    fileSize = freeSpaceOffset + freeSpaceBytes;
+  }
+  m_region.reset();
+  m_mapping.reset();
+  m_capacity = 0;
+  // drop the room reserved for more events
+  if (!m_ReadOnly)
+    Poco::File(m_eventFileName).setSize(fileSize);
+}
+
+} // namespace DataObjects
+} // namespace Mantid
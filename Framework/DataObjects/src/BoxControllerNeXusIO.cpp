@@ -5,6 +5,8 @@
 #include "MantidDataObjects/MDBoxFlatTree.h"
 #include "MantidKernel/ConfigService.h"
 #include "MantidKernel/Exception.h"
+#include "MantidKernel/Logger.h"
+#include "MantidKernel/make_unique.h"
 #include "MantidAPI/FileFinder.h"
 #include "MantidDataObjects/MDEvent.h"
 
@@ -12,6 +14,10 @@
 
 namespace Mantid {
 namespace DataObjects {
+namespace {
+/// static logger
+Kernel::Logger g_log("BoxControllerNeXusIO");
+}
 // Default headers(attributes) describing the contents of the data, written by
 // this class
 const char *EventHeaders[] = {
@@ -163,6 +169,15 @@ bool BoxControllerNeXusIO::openFile(const std::string &fileName,
   else
     prepareNxSToWrite_CurVersion();
 
+  m_asyncIO = Kernel::make_unique<AsyncBlockIO>(
+      static_cast<size_t>(m_BlockSize[1]),
+      [this](AsyncBlockIO::Block &block) { this->readBlock(block); },
+      [this](const AsyncBlockIO::Block &block) { this->writeBlock(block); },
+      [this]() {
+        std::lock_guard<std::mutex> lock(m_fileMutex);
+        m_File->flush();
+      });
+
   return true;
 }
 /**Create group responsible for keeping events and add necessary attributes to
@@ -323,12 +338,27 @@ void BoxControllerNeXusIO::getDiskBufferFileData() {
 
 //-------------------------------------------------------------------------------------------------------------------------------------
 /** Save generc data block on specific position within properly opened NeXus
-  *data array
+  *data array. The block is queued and written in the background.
   *@param DataBlock     -- the vector with data to write
   *@param blockPosition -- The starting place to save data to   */
 template <typename Type>
 void BoxControllerNeXusIO::saveGenericBlock(
     const std::vector<Type> &DataBlock, const uint64_t blockPosition) const {
+  const uint64_t nPoints = DataBlock.size() / this->getNDataColums();
+  this->extendFileLength(blockPosition + nPoints);
+
+  if (m_asyncIO)
+    m_asyncIO->save(DataBlock, blockPosition);
+  else
+    this->writeGenericBlock(DataBlock, blockPosition);
+}
+
+/** Write generic data block to the file
+  *@param DataBlock     -- the vector with data to write
+  *@param blockPosition -- The starting place to save data to   */
+template <typename Type>
+void BoxControllerNeXusIO::writeGenericBlock(
+    const std::vector<Type> &DataBlock, const uint64_t blockPosition) const {
   std::vector<int64_t> start(2, 0);
   // Specify the dimensions
   std::vector<int64_t> dims(m_BlockSize);
@@ -341,12 +371,16 @@ void BoxControllerNeXusIO::saveGenericBlock(
   // makes putSlab method non-constant
   std::vector<Type> &mData = const_cast<std::vector<Type> &>(DataBlock);
 
-  {
-    m_File->putSlab<Type>(mData, start, dims);
+  m_File->putSlab<Type>(mData, start, dims);
+}
 
-    if (blockPosition + dims[0] > this->getFileLength())
-      this->setFileLength(blockPosition + dims[0]);
-  }
+/** Write a block queued by the AsyncBlockIO
+ *@param block -- the block to write */
+void BoxControllerNeXusIO::writeBlock(const AsyncBlockIO::Block &block) const {
+  if (block.isDouble)
+    this->writeGenericBlock(block.doubles, block.position);
+  else
+    this->writeGenericBlock(block.floats, block.position);
 }
 
 /** Save float data block on specific position within properly opened NeXus data
@@ -402,6 +436,26 @@ void convertFormats(const std::vector<FROM> &inData, std::vector<TO> &outData) {
     outData.push_back(static_cast<TO>(inData[i]));
   }
 }
+/** Load generic data block, from the data queued to be written or read ahead
+  *if possible and from the file otherwise.
+  *@param Block         -- the storage vector to place data into
+  *@param blockPosition -- The starting place to read data from
+  *@param nPoints       -- number of data points (events) to read
+*/
+template <typename Type>
+void BoxControllerNeXusIO::loadQueuedBlock(std::vector<Type> &Block,
+                                           const uint64_t blockPosition,
+                                           const size_t nPoints) const {
+  if (!m_asyncIO) {
+    this->readBlock(Block, blockPosition, nPoints);
+    return;
+  }
+  if (blockPosition + nPoints > this->getFileLength())
+    throw Kernel::Exception::FileError("Attemtp to read behind the file end",
+                                       m_fileName);
+  m_asyncIO->load(Block, blockPosition, nPoints);
+}
+
 /** Load float  data block from the opened NeXus file.
   *@param Block         -- the storage vector to place data into
   *@param blockPosition -- The starting place to read data from
@@ -413,6 +467,56 @@ void convertFormats(const std::vector<FROM> &inData, std::vector<TO> &outData) {
 void BoxControllerNeXusIO::loadBlock(std::vector<float> &Block,
                                      const uint64_t blockPosition,
                                      const size_t nPoints) const {
+  this->loadQueuedBlock(Block, blockPosition, nPoints);
+}
+/** Load double  data block from the opened NeXus file.
+  *@param Block         -- the storage vector to place data into
+  *@param blockPosition -- The starting place to read data from
+  *@param nPoints       -- number of data points (events) to read
+
+  *@returns Block -- resized block of data containing serialized events
+  representation.
+*/
+void BoxControllerNeXusIO::loadBlock(std::vector<double> &Block,
+                                     const uint64_t blockPosition,
+                                     const size_t nPoints) const {
+  this->loadQueuedBlock(Block, blockPosition, nPoints);
+}
+
+/** Ask for a data block to be read in the background, as it is going to be
+  *loaded soon. The block is read in the coordinate type set by setDataType.
+  *@param blockPosition -- The starting place to read data from
+  *@param nPoints       -- number of data points (events) to read
+*/
+void BoxControllerNeXusIO::readAhead(const uint64_t blockPosition,
+                                     const size_t nPoints) const {
+  if (m_asyncIO && nPoints > 0)
+    m_asyncIO->readAhead(blockPosition, nPoints, m_CoordSize == 8);
+}
+
+/** Read a block requested by the AsyncBlockIO, up to the end of the file
+ *@param block -- the block to read */
+void BoxControllerNeXusIO::readBlock(AsyncBlockIO::Block &block) const {
+  const uint64_t fileLength = this->getFileLength();
+  if (block.end() > fileLength)
+    block.nPoints = block.position < fileLength ? fileLength - block.position
+                                                : 0;
+  if (block.nPoints == 0)
+    return;
+  if (block.isDouble)
+    this->readBlock(block.doubles, block.position, block.nPoints);
+  else
+    this->readBlock(block.floats, block.position, block.nPoints);
+}
+
+/** Read float data block from the opened NeXus file, converting doubles
+  *@param Block         -- the storage vector to place data into
+  *@param blockPosition -- The starting place to read data from
+  *@param nPoints       -- number of data points (events) to read
+*/
+void BoxControllerNeXusIO::readBlock(std::vector<float> &Block,
+                                     const uint64_t blockPosition,
+                                     const size_t nPoints) const {
   std::vector<double> tmp;
   switch (m_ReadConversion) {
   case (noConversion):
@@ -427,15 +531,12 @@ void BoxControllerNeXusIO::loadBlock(std::vector<float> &Block,
         " Attempt to read float data from unsupported file format", m_fileName);
   }
 }
-/** Load double  data block from the opened NeXus file.
+/** Read double data block from the opened NeXus file, converting floats
   *@param Block         -- the storage vector to place data into
   *@param blockPosition -- The starting place to read data from
   *@param nPoints       -- number of data points (events) to read
-
-  *@returns Block -- resized block of data containing serialized events
-  representation.
 */
-void BoxControllerNeXusIO::loadBlock(std::vector<double> &Block,
+void BoxControllerNeXusIO::readBlock(std::vector<double> &Block,
                                      const uint64_t blockPosition,
                                      const size_t nPoints) const {
   std::vector<float> tmp;
@@ -456,18 +557,41 @@ void BoxControllerNeXusIO::loadBlock(std::vector<double> &Block,
 
 //-------------------------------------------------------------------------------------------------------------------------------------
 
-/// Clear NeXus internal cache
+/** Clear NeXus internal cache once the data saved so far have been written.
+ * This does not wait for the data to be written; flushCache() does. */
 void BoxControllerNeXusIO::flushData() const {
-  std::lock_guard<std::mutex> _lock(m_fileMutex);
-  m_File->flush();
+  if (m_asyncIO) {
+    m_asyncIO->flushInBackground();
+  } else {
+    std::lock_guard<std::mutex> _lock(m_fileMutex);
+    m_File->flush();
+  }
 }
+
+/** Write out the data in the disk buffer and wait for all the data saved to
+ * be written to the file */
+void BoxControllerNeXusIO::flushCache() {
+  DiskBuffer::flushCache();
+  if (m_asyncIO)
+    m_asyncIO->flush();
+}
+
 /** flush disk buffer data from memory and close underlying NeXus file*/
 void BoxControllerNeXusIO::closeFile() {
   if (m_File) {
     // write all file-backed data still stack in the data buffer into the file.
-    this->flushCache();
+    // Close the file even if writing fails, and report the error afterwards.
+    std::exception_ptr writeError;
+    try {
+      this->flushCache();
+      if (m_asyncIO)
+        m_asyncIO->stop();
+    } catch (...) {
+      writeError = std::current_exception();
+    }
+    m_asyncIO.reset();
     // lock file
-    std::lock_guard<std::mutex> _lock(m_fileMutex);
+    std::unique_lock<std::mutex> _lock(m_fileMutex);
 
     m_File->closeData(); // close events data
     if (!m_ReadOnly)     // write free space groups from the disk buffer
@@ -488,9 +612,19 @@ void BoxControllerNeXusIO::closeFile() {
 
     delete m_File;
     m_File = nullptr;
+    _lock.unlock();
+    if (writeError)
+      std::rethrow_exception(writeError);
   }
 }
 
-BoxControllerNeXusIO::~BoxControllerNeXusIO() { this->closeFile(); }
+BoxControllerNeXusIO::~BoxControllerNeXusIO() {
+  try {
+    this->closeFile();
+  } catch (std::exception &error) {
+    g_log.error() << "Failed to write the events to " << m_fileName << ": "
+                  << error.what() << "\n";
+  }
+}
 }
 }
@@ -0,0 +1,431 @@
+#include "MantidDataObjects/CompressedEvents.h"
+#include "MantidDataObjects/EventHistogrammer.h"
+#include "MantidKernel/RadixSort.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace Mantid {
+namespace DataObjects {
+using Types::Core::DateAndTime;
+using Types::Event::TofEvent;
+using Kernel::RadixSort::doubleFromKey;
+using Kernel::RadixSort::keyFromDouble;
+using namespace Mantid::API;
+
+namespace {
+/// Append an unsigned integer using 7 bits per byte
+void writeVarint(std::vector<uint8_t> &out, uint64_t value) {
+  while (value >= 0x80) {
+    out.push_back(static_cast<uint8_t>(value | 0x80));
+    value >>= 7;
+  }
+  out.push_back(static_cast<uint8_t>(value));
+}
+
+/// Read an unsigned integer written by writeVarint and advance the pointer
+uint64_t readVarint(const uint8_t *&in) {
+  uint64_t value = 0;
+  unsigned int shift = 0;
+  while (*in & 0x80) {
+    value |= static_cast<uint64_t>(*in++ & 0x7F) << shift;
+    shift += 7;
+  }
+  return value | (static_cast<uint64_t>(*in++) << shift);
+}
+
+/// Map small positive and negative differences onto small unsigned integers
+uint64_t zigzag(const uint64_t difference) {
+  return (difference << 1) ^ (0 - (difference >> 63));
+}
+
+/// Inverse of zigzag
+uint64_t unzigzag(const uint64_t value) {
+  return (value >> 1) ^ (0 - (value & 1));
+}
+
+/// Walks through the pulse index
+class PulseReader {
+public:
+  explicit PulseReader(const std::vector<uint8_t> &pulses)
+      : m_next(pulses.data()) {}
+  /// Move to the next pulse and return its number of events
+  size_t next() {
+    // Differences wrap around, so the arithmetic is done unsigned
+    m_pulseTime = static_cast<int64_t>(static_cast<uint64_t>(m_pulseTime) +
+                                       unzigzag(readVarint(m_next)));
+    return static_cast<size_t>(readVarint(m_next));
+  }
+  /// Pulse time of the current pulse, in nanoseconds
+  int64_t pulseTime() const { return m_pulseTime; }
+
+private:
+  const uint8_t *m_next;
+  int64_t m_pulseTime{0};
+};
+
+/// Read the value of a given width stored at a position of a packed array
+uint64_t unpackBits(const std::vector<uint64_t> &bits, const size_t index,
+                    const unsigned int width) {
+  if (width == 0)
+    return 0;
+  const uint64_t position = static_cast<uint64_t>(index) * width;
+  const size_t word = static_cast<size_t>(position / 64);
+  const unsigned int offset = static_cast<unsigned int>(position % 64);
+  uint64_t value = bits[word] >> offset;
+  if (offset + width > 64)
+    value |= bits[word + 1] << (64 - offset);
+  if (width < 64)
+    value &= (uint64_t(1) << width) - 1;
+  return value;
+}
+
+void appendEvent(std::vector<TofEvent> &events, const double tof,
+                 const int64_t pulseTime, const float, const float) {
+  events.emplace_back(tof, DateAndTime(pulseTime));
+}
+
+void appendEvent(std::vector<WeightedEvent> &events, const double tof,
+                 const int64_t pulseTime, const float weight,
+                 const float errorSquared) {
+  events.emplace_back(tof, DateAndTime(pulseTime), weight, errorSquared);
+}
+} // namespace
+
+/** Constructor for an empty set of events
+ * @param type :: the type of the events
+ */
+CompressedEvents::CompressedEvents(EventType type) : m_eventType(type) {}
+
+/** Constructor compressing a vector of TofEvent's
+ * @param events :: the events to compress
+ */
+CompressedEvents::CompressedEvents(const std::vector<TofEvent> &events)
+    : m_eventType(TOF), m_numEvents(events.size()) {
+  encodePulseTimes(events);
+  encodeTofs(events);
+}
+
+/** Constructor compressing a vector of WeightedEvent's
+ * @param events :: the events to compress
+ */
+CompressedEvents::CompressedEvents(const std::vector<WeightedEvent> &events)
+    : m_eventType(WEIGHTED), m_numEvents(events.size()) {
+  encodePulseTimes(events);
+  encodeTofs(events);
+  encodeWeights(events);
+}
+
+/** Constructor compressing a vector of WeightedEventNoTime's
+ * @param events :: the events to compress
+ */
+CompressedEvents::CompressedEvents(
+    const std::vector<WeightedEventNoTime> &events)
+    : m_eventType(WEIGHTED_NOTIME), m_numEvents(events.size()) {
+  encodeTofs(events);
+  encodeWeights(events);
+}
+
+/** Build the pulse index from the pulse times of the events
+ * @param events :: the events being compressed
+ */
+template <class T>
+void CompressedEvents::encodePulseTimes(const std::vector<T> &events) {
+  auto first = events.cbegin();
+  int64_t previous = 0;
+  while (first != events.cend()) {
+    const int64_t pulseTime = first->pulseTime().totalNanoseconds();
+    auto last = first + 1;
+    while (last != events.cend() &&
+           last->pulseTime().totalNanoseconds() == pulseTime)
+      ++last;
+    if (first != events.cbegin() && pulseTime < previous)
+      m_sortedByPulseTime = false;
+    writeVarint(m_pulses, zigzag(static_cast<uint64_t>(pulseTime) -
+                                 static_cast<uint64_t>(previous)));
+    writeVarint(m_pulses, static_cast<uint64_t>(last - first));
+    ++m_numPulses;
+    previous = pulseTime;
+    first = last;
+  }
+  m_pulses.shrink_to_fit();
+}
+
+/** Pack the time-of-flight of the events
+ * @param events :: the events being compressed
+ */
+template <class T>
+void CompressedEvents::encodeTofs(const std::vector<T> &events) {
+  if (events.empty())
+    return;
+  m_tofBase = std::numeric_limits<uint64_t>::max();
+  for (const auto &event : events)
+    m_tofBase = std::min(m_tofBase, keyFromDouble(event.tof()));
+
+  // Bits set in any of the offsets, and the largest offset
+  uint64_t usedBits = 0;
+  uint64_t maxOffset = 0;
+  for (const auto &event : events) {
+    const uint64_t offset = keyFromDouble(event.tof()) - m_tofBase;
+    usedBits |= offset;
+    maxOffset = std::max(maxOffset, offset);
+  }
+  if (usedBits == 0)
+    return;
+  while (((usedBits >> m_tofShift) & 1) == 0)
+    ++m_tofShift;
+  maxOffset >>= m_tofShift;
+  while (m_tofWidth < 64 && (maxOffset >> m_tofWidth) != 0)
+    ++m_tofWidth;
+
+  m_tofBits.assign((events.size() * m_tofWidth + 63) / 64, 0);
+  uint64_t position = 0;
+  for (const auto &event : events) {
+    const uint64_t value =
+        (keyFromDouble(event.tof()) - m_tofBase) >> m_tofShift;
+    const size_t word = static_cast<size_t>(position / 64);
+    const unsigned int offset = static_cast<unsigned int>(position % 64);
+    m_tofBits[word] |= value << offset;
+    if (offset + m_tofWidth > 64)
+      m_tofBits[word + 1] |= value >> (64 - offset);
+    position += m_tofWidth;
+  }
+}
+
+/** Store the weights and squared errors of the events
+ * @param events :: the events being compressed
+ */
+template <class T>
+void CompressedEvents::encodeWeights(const std::vector<T> &events) {
+  m_weights.reserve(events.size());
+  m_errorSquareds.reserve(events.size());
+  for (const auto &event : events) {
+    m_weights.push_back(static_cast<float>(event.weight()));
+    m_errorSquareds.push_back(static_cast<float>(event.errorSquared()));
+  }
+  // Keep a single value if all events share it
+  const auto isUniform = [](const std::vector<float> &values) {
+    return std::all_of(values.cbegin(), values.cend(),
+                       [&values](const float value) {
+                         return value == values.front();
+                       });
+  };
+  if (!m_weights.empty() && isUniform(m_weights) &&
+      isUniform(m_errorSquareds)) {
+    m_weights.resize(1);
+    m_errorSquareds.resize(1);
+    m_weights.shrink_to_fit();
+    m_errorSquareds.shrink_to_fit();
+  }
+}
+
+/** Append the events of the pulses selected by a predicate
+ * @param events :: vector the events are appended to
+ * @param keepPulse :: callable taking a pulse time in nanoseconds
+ */
+template <class T, class Predicate>
+void CompressedEvents::appendEvents(std::vector<T> &events,
+                                    Predicate keepPulse) const {
+  PulseReader reader(m_pulses);
+  size_t index = 0;
+  for (size_t pulse = 0; pulse < m_numPulses; ++pulse) {
+    const size_t count = reader.next();
+    if (keepPulse(reader.pulseTime())) {
+      for (size_t i = index; i < index + count; ++i)
+        appendEvent(events, tof(i), reader.pulseTime(),
+                    m_weights.empty() ? 1.f : weight(i),
+                    m_errorSquareds.empty() ? 1.f : errorSquared(i));
+    }
+    index += count;
+  }
+}
+
+/** Decompress into a vector of TofEvent's
+ * @param events :: vector that will be overwritten with the events
+ */
+void CompressedEvents::copyTo(std::vector<TofEvent> &events) const {
+  if (m_eventType != TOF)
+    throw std::runtime_error("CompressedEvents::copyTo() called with "
+                             "TofEvent's for weighted events.");
+  events.clear();
+  events.reserve(size());
+  appendEvents(events, [](int64_t) { return true; });
+}
+
+/** Decompress into a vector of WeightedEvent's
+ * @param events :: vector that will be overwritten with the events
+ */
+void CompressedEvents::copyTo(std::vector<WeightedEvent> &events) const {
+  if (m_eventType != WEIGHTED)
+    throw std::runtime_error("CompressedEvents::copyTo() called with "
+                             "WeightedEvent's for events that are not "
+                             "WeightedEvent's.");
+  events.clear();
+  events.reserve(size());
+  appendEvents(events, [](int64_t) { return true; });
+}
+
+/** Decompress into a vector of WeightedEventNoTime's
+ * @param events :: vector that will be overwritten with the events
+ */
+void CompressedEvents::copyTo(std::vector<WeightedEventNoTime> &events) const {
+  if (m_eventType != WEIGHTED_NOTIME)
+    throw std::runtime_error("CompressedEvents::copyTo() called with "
+                             "WeightedEventNoTime's for events that are not "
+                             "WeightedEventNoTime's.");
+  events.clear();
+  events.reserve(size());
+  for (size_t i = 0; i < size(); ++i)
+    events.emplace_back(tof(i), weight(i), errorSquared(i));
+}
+
+/** Decompress the TofEvent's with start <= pulse time < stop, in their stored
+ * order. Only the pulses in the range are decoded.
+ * @param start :: start of the range, in nanoseconds
+ * @param stop :: end of the range (excluded), in nanoseconds
+ * @param events :: vector the events are appended to
+ */
+void CompressedEvents::copyPulseTimeRange(const int64_t start,
+                                          const int64_t stop,
+                                          std::vector<TofEvent> &events) const {
+  if (m_eventType != TOF)
+    throw std::runtime_error("CompressedEvents::copyPulseTimeRange() called "
+                             "with TofEvent's for weighted events.");
+  appendEvents(events, [start, stop](const int64_t pulseTime) {
+    return pulseTime >= start && pulseTime < stop;
+  });
+}
+
+/** Decompress the WeightedEvent's with start <= pulse time < stop, in their
+ * stored order. Only the pulses in the range are decoded.
+ * @param start :: start of the range, in nanoseconds
+ * @param stop :: end of the range (excluded), in nanoseconds
+ * @param events :: vector the events are appended to
+ */
+void CompressedEvents::copyPulseTimeRange(
+    const int64_t start, const int64_t stop,
+    std::vector<WeightedEvent> &events) const {
+  if (m_eventType != WEIGHTED)
+    throw std::runtime_error("CompressedEvents::copyPulseTimeRange() called "
+                             "with WeightedEvent's for events that are not "
+                             "WeightedEvent's.");
+  appendEvents(events, [start, stop](const int64_t pulseTime) {
+    return pulseTime >= start && pulseTime < stop;
+  });
+}
+
+/// Remove all events and release the memory
+void CompressedEvents::clear() { *this = CompressedEvents(m_eventType); }
+
+/// @return the memory used by the compressed events, in bytes
+size_t CompressedEvents::getMemorySize() const {
+  return m_pulses.capacity() * sizeof(uint8_t) +
+         m_tofBits.capacity() * sizeof(uint64_t) +
+         (m_weights.capacity() + m_errorSquareds.capacity()) * sizeof(float);
+}
+
+/** Decode the time-of-flight of a single event
+ * @param index :: position of the event
+ * @return the time-of-flight
+ */
+double CompressedEvents::tof(const size_t index) const {
+  const uint64_t offset = unpackBits(m_tofBits, index, m_tofWidth);
+  return doubleFromKey(m_tofBase + (offset << m_tofShift));
+}
+
+/// @return the smallest time-of-flight, without decoding the events
+double CompressedEvents::tofMin() const {
+  if (empty())
+    return std::numeric_limits<double>::max();
+  return doubleFromKey(m_tofBase);
+}
+
+/// @return the largest time-of-flight
+double CompressedEvents::tofMax() const {
+  if (empty())
+    return std::numeric_limits<double>::lowest();
+  uint64_t maxOffset = 0;
+  for (size_t i = 0; i < size(); ++i)
+    maxOffset = std::max(maxOffset, unpackBits(m_tofBits, i, m_tofWidth));
+  return doubleFromKey(m_tofBase + (maxOffset << m_tofShift));
+}
+
+/** Decode the time-of-flight of a range of events
+ * @param first :: position of the first event
+ * @param count :: number of events
+ * @param tofs :: output array holding at least count values
+ */
+void CompressedEvents::decodeTofs(const size_t first, const size_t count,
+                                  double *tofs) const {
+  for (size_t i = 0; i < count; ++i)
+    tofs[i] = tof(first + i);
+}
+
+/** Fill a histogram with the number of events in each bin. The events are
+ * decoded in blocks and do not need to be sorted.
+ * @param X :: the bin edges
+ * @param Y :: the counts, resized to match X
+ */
+void CompressedEvents::histogramCounts(const MantidVec &X,
+                                       MantidVec &Y) const {
+  if (X.size() <= 1) {
+    // X was not set. Return an empty array.
+    Y.resize(0, 0);
+    return;
+  }
+  Y.assign(X.size() - 1, 0.0);
+
+  const EventHistogrammer histogrammer(X);
+  std::array<double, EventHistogrammer::BLOCK_SIZE> tofs;
+  for (size_t first = 0; first < size(); first += tofs.size()) {
+    const size_t count = std::min(tofs.size(), size() - first);
+    decodeTofs(first, count, tofs.data());
+    histogrammer.addCounts(tofs.data(), count, Y);
+  }
+}
+
+/** Fill a histogram with the summed weights and squared errors of the events
+ * in each bin. The events are decoded in blocks and do not need to be sorted.
+ * @param X :: the bin edges
+ * @param Y :: the summed weights, resized to match X
+ * @param E :: the summed squared errors, resized to match X
+ */
+void CompressedEvents::histogramWeights(const MantidVec &X, MantidVec &Y,
+                                        MantidVec &E) const {
+  if (m_eventType == TOF)
+    throw std::runtime_error("CompressedEvents::histogramWeights() called for "
+                             "events without weights.");
+  if (X.size() <= 1) {
+    // X was not set. Return an empty array.
+    Y.resize(0, 0);
+    return;
+  }
+  Y.assign(X.size() - 1, 0.0);
+  // Note: Errors will be squared until the last step.
+  E.assign(X.size() - 1, 0.0);
+
+  const EventHistogrammer histogrammer(X);
+  std::array<double, EventHistogrammer::BLOCK_SIZE> tofs;
+  std::array<float, EventHistogrammer::BLOCK_SIZE> weights;
+  std::array<float, EventHistogrammer::BLOCK_SIZE> errorSquareds;
+  for (size_t first = 0; first < size(); first += tofs.size()) {
+    const size_t count = std::min(tofs.size(), size() - first);
+    decodeTofs(first, count, tofs.data());
+    for (size_t i = 0; i < count; ++i) {
+      weights[i] = weight(first + i);
+      errorSquareds[i] = errorSquared(first + i);
+    }
+    histogrammer.addWeights(tofs.data(), weights.data(), errorSquareds.data(),
+                            count, Y, E);
+  }
+
+  // Now do the sqrt of all errors
+  std::transform(E.begin(), E.end(), E.begin(),
+                 static_cast<double (*)(double)>(sqrt));
+}
+
+} // namespace DataObjects
+} // namespace Mantid
@@ -0,0 +1,419 @@
+#include "MantidDataObjects/EventColumns.h"
+#include "MantidDataObjects/EventHistogrammer.h"
+#include "MantidKernel/TaskRuntime.h"
+
+#ifdef _MSC_VER
+// qualifier applied to function type has no meaning; ignored
+#pragma warning(disable : 4180)
+#endif
+#include "tbb/parallel_sort.h"
+#ifdef _MSC_VER
+#pragma warning(default : 4180)
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+namespace Mantid {
+namespace DataObjects {
+using Types::Core::DateAndTime;
+using Types::Event::TofEvent;
+using namespace Mantid::API;
+
+namespace {
+/** Reorder a column so that out[i] = column[order[i]].
+ * @param column :: column to reorder in place
+ * @param order :: permutation of the indices of the column
+ */
+template <typename T>
+void applyOrder(std::vector<T> &column, const std::vector<size_t> &order) {
+  if (column.empty())
+    return;
+  std::vector<T> sorted;
+  sorted.reserve(column.size());
+  for (const auto index : order)
+    sorted.push_back(column[index]);
+  column.swap(sorted);
+}
+
+/// Release the memory held by a column
+template <typename T> void releaseColumn(std::vector<T> &column) {
+  std::vector<T>().swap(column);
+}
+} // namespace
+
+/** Constructor for an empty set of columns
+ * @param type :: the type of the events that will be stored
+ */
+EventColumns::EventColumns(EventType type) : m_eventType(type) {}
+
+/** Constructor splitting a vector of TofEvent's into columns
+ * @param events :: the events to copy
+ */
+EventColumns::EventColumns(const std::vector<TofEvent> &events)
+    : m_eventType(TOF) {
+  m_tofs.reserve(events.size());
+  m_pulseTimes.reserve(events.size());
+  for (const auto &event : events) {
+    m_tofs.push_back(event.tof());
+    m_pulseTimes.push_back(event.pulseTime().totalNanoseconds());
+  }
+}
+
+/** Constructor splitting a vector of WeightedEvent's into columns
+ * @param events :: the events to copy
+ */
+EventColumns::EventColumns(const std::vector<WeightedEvent> &events)
+    : m_eventType(WEIGHTED) {
+  m_tofs.reserve(events.size());
+  m_pulseTimes.reserve(events.size());
+  m_weights.reserve(events.size());
+  m_errorSquareds.reserve(events.size());
+  for (const auto &event : events) {
+    m_tofs.push_back(event.tof());
+    m_pulseTimes.push_back(event.pulseTime().totalNanoseconds());
+    m_weights.push_back(event.m_weight);
+    m_errorSquareds.push_back(event.m_errorSquared);
+  }
+}
+
+/** Constructor splitting a vector of WeightedEventNoTime's into columns
+ * @param events :: the events to copy
+ */
+EventColumns::EventColumns(const std::vector<WeightedEventNoTime> &events)
+    : m_eventType(WEIGHTED_NOTIME) {
+  m_tofs.reserve(events.size());
+  m_weights.reserve(events.size());
+  m_errorSquareds.reserve(events.size());
+  for (const auto &event : events) {
+    m_tofs.push_back(event.tof());
+    m_weights.push_back(event.m_weight);
+    m_errorSquareds.push_back(event.m_errorSquared);
+  }
+}
+
+/** Rebuild a vector of TofEvent's from the columns
+ * @param events :: vector that will be overwritten with the events
+ */
+void EventColumns::copyTo(std::vector<TofEvent> &events) const {
+  if (m_eventType != TOF)
+    throw std::runtime_error("EventColumns::copyTo() called with TofEvent's "
+                             "for columns that hold weighted events.");
+  events.clear();
+  events.reserve(size());
+  for (size_t i = 0; i < size(); ++i)
+    events.emplace_back(m_tofs[i], DateAndTime(m_pulseTimes[i]));
+}
+
+/** Rebuild a vector of WeightedEvent's from the columns
+ * @param events :: vector that will be overwritten with the events
+ */
+void EventColumns::copyTo(std::vector<WeightedEvent> &events) const {
+  if (m_eventType != WEIGHTED)
+    throw std::runtime_error("EventColumns::copyTo() called with "
+                             "WeightedEvent's for columns that do not hold "
+                             "WeightedEvent's.");
+  events.clear();
+  events.reserve(size());
+  for (size_t i = 0; i < size(); ++i)
+    events.emplace_back(m_tofs[i], DateAndTime(m_pulseTimes[i]), m_weights[i],
+                        m_errorSquareds[i]);
+}
+
+/** Rebuild a vector of WeightedEventNoTime's from the columns
+ * @param events :: vector that will be overwritten with the events
+ */
+void EventColumns::copyTo(std::vector<WeightedEventNoTime> &events) const {
+  if (m_eventType != WEIGHTED_NOTIME)
+    throw std::runtime_error("EventColumns::copyTo() called with "
+                             "WeightedEventNoTime's for columns that do not "
+                             "hold WeightedEventNoTime's.");
+  events.clear();
+  events.reserve(size());
+  for (size_t i = 0; i < size(); ++i)
+    events.emplace_back(m_tofs[i], m_weights[i], m_errorSquareds[i]);
+}
+
+/** Equality operator
+ * @param rhs :: other columns to compare
+ * @return :: true if the same type and all columns are identical
+ */
+bool EventColumns::operator==(const EventColumns &rhs) const {
+  return m_eventType == rhs.m_eventType && m_tofs == rhs.m_tofs &&
+         m_pulseTimes == rhs.m_pulseTimes && m_weights == rhs.m_weights &&
+         m_errorSquareds == rhs.m_errorSquareds;
+}
+
+/// Remove all events and release the memory of the columns
+void EventColumns::clear() {
+  releaseColumn(m_tofs);
+  releaseColumn(m_pulseTimes);
+  releaseColumn(m_weights);
+  releaseColumn(m_errorSquareds);
+}
+
+/** Reserve space for a number of events in the columns in use
+ * @param num :: number of events
+ */
+void EventColumns::reserve(size_t num) {
+  m_tofs.reserve(num);
+  if (hasPulseTimes())
+    m_pulseTimes.reserve(num);
+  if (hasWeights()) {
+    m_weights.reserve(num);
+    m_errorSquareds.reserve(num);
+  }
+}
+
+/** Memory used by the columns. As for EventList, this reports the CAPACITY
+ * of the vectors.
+ * @return :: the memory used by the columns, in bytes.
+ */
+size_t EventColumns::getMemorySize() const {
+  return m_tofs.capacity() * sizeof(double) +
+         m_pulseTimes.capacity() * sizeof(int64_t) +
+         (m_weights.capacity() + m_errorSquareds.capacity()) * sizeof(float);
+}
+
+/** Sort the events by time-of-flight. The ordering is found on the TOF column
+ * only and then applied to each of the columns in use.
+ */
+void EventColumns::sortTof() {
+  if (std::is_sorted(m_tofs.cbegin(), m_tofs.cend()))
+    return;
+
+  std::vector<size_t> order(size());
+  std::iota(order.begin(), order.end(), size_t{0});
+  const auto &tofs = m_tofs;
+  Kernel::TaskRuntime::execute([&order, &tofs]() {
+    tbb::parallel_sort(
+        order.begin(), order.end(),
+        [&tofs](size_t a, size_t b) { return tofs[a] < tofs[b]; });
+  });
+
+  applyOrder(m_tofs, order);
+  applyOrder(m_pulseTimes, order);
+  applyOrder(m_weights, order);
+  applyOrder(m_errorSquareds, order);
+}
+
+/// Reverse the order of the events in all columns
+void EventColumns::reverse() {
+  std::reverse(m_tofs.begin(), m_tofs.end());
+  std::reverse(m_pulseTimes.begin(), m_pulseTimes.end());
+  std::reverse(m_weights.begin(), m_weights.end());
+  std::reverse(m_errorSquareds.begin(), m_errorSquareds.end());
+}
+
+/** Convert the time of flight by tof'=tof*factor+offset
+ * @param factor :: The value to scale the time-of-flight by
+ * @param offset :: The value to shift the time-of-flight by
+ */
+void EventColumns::convertTof(const double factor, const double offset) {
+  for (auto &tof : m_tofs)
+    tof = tof * factor + offset;
+}
+
+/** Convert the time of flight with an arbitrary function
+ * @param func :: Function to do the conversion
+ */
+void EventColumns::convertTof(const std::function<double(double)> &func) {
+  std::transform(m_tofs.begin(), m_tofs.end(), m_tofs.begin(), func);
+}
+
+/** Convert the time of flight according to output = a * (input^b)
+ * @param factor :: the conversion factor a to apply
+ * @param power :: the Power b to apply to the conversion
+ */
+void EventColumns::convertUnitsQuickly(const double factor,
+                                       const double power) {
+  for (auto &tof : m_tofs)
+    tof = factor * std::pow(tof, power);
+}
+
+/** Remove the events with tofMin <= tof <= tofMax. The columns must be sorted
+ * by time-of-flight.
+ * @param tofMin :: lower bound of TOF to filter out
+ * @param tofMax :: upper bound of TOF to filter out
+ * @returns The number of events deleted.
+ */
+size_t EventColumns::maskTof(const double tofMin, const double tofMax) {
+  if (empty() || tofMin > m_tofs.back() || tofMax < m_tofs.front())
+    return 0;
+
+  const auto first =
+      std::lower_bound(m_tofs.cbegin(), m_tofs.cend(), tofMin) -
+      m_tofs.cbegin();
+  const auto last =
+      std::upper_bound(m_tofs.cbegin() + first, m_tofs.cend(), tofMax) -
+      m_tofs.cbegin();
+  if (first >= last)
+    return 0;
+
+  m_tofs.erase(m_tofs.begin() + first, m_tofs.begin() + last);
+  if (hasPulseTimes())
+    m_pulseTimes.erase(m_pulseTimes.begin() + first,
+                       m_pulseTimes.begin() + last);
+  if (hasWeights()) {
+    m_weights.erase(m_weights.begin() + first, m_weights.begin() + last);
+    m_errorSquareds.erase(m_errorSquareds.begin() + first,
+                          m_errorSquareds.begin() + last);
+  }
+  return static_cast<size_t>(last - first);
+}
+
+/** Index of the first event with tof >= seek_tof, or size() if there is none.
+ * The columns must be sorted by time-of-flight.
+ * @param seek_tof :: tof to find (typically the first bin X[0])
+ */
+size_t EventColumns::findFirstEvent(const double seek_tof) const {
+  return std::lower_bound(m_tofs.cbegin(), m_tofs.cend(), seek_tof) -
+         m_tofs.cbegin();
+}
+
+/** Fill a counts histogram given the bin boundaries. Every event counts as 1
+ * regardless of the weight columns. The columns must be sorted by
+ * time-of-flight.
+ * @param X :: The x bins
+ * @param Y :: The generated counts histogram
+ */
+void EventColumns::histogramCounts(const MantidVec &X, MantidVec &Y) const {
+  const size_t x_size = X.size();
+  if (x_size <= 1) {
+    // X was not set. Return an empty array.
+    Y.resize(0, 0);
+    return;
+  }
+  Y.assign(x_size - 1, 0.0);
+
+  const EventHistogrammer histogrammer(X);
+  if (histogrammer.getBinningType() != EventHistogrammer::IRREGULAR) {
+    histogrammer.addCounts(m_tofs.data(), m_tofs.size(), Y);
+    return;
+  }
+
+  const size_t numEvents = size();
+  size_t i = findFirstEvent(X[0]);
+  size_t bin = 0;
+  // Both events and X are sorted: walk through them together.
+  while (i < numEvents && bin < x_size - 1) {
+    const double tof = m_tofs[i];
+    if (tof < X[bin + 1]) {
+      Y[bin]++;
+      ++i;
+    } else {
+      ++bin;
+    }
+  }
+}
+
+/** Fill the Y and E histograms from the weight and squared error columns. The
+ * columns must be sorted by time-of-flight.
+ * @param X :: The x bins
+ * @param Y :: The summed weights
+ * @param E :: The errors (square root of the summed squared errors)
+ */
+void EventColumns::histogramWeights(const MantidVec &X, MantidVec &Y,
+                                    MantidVec &E) const {
+  if (!hasWeights())
+    throw std::runtime_error("EventColumns::histogramWeights() called for "
+                             "columns without weights.");
+  const size_t x_size = X.size();
+  if (x_size <= 1) {
+    // X was not set. Return an empty array.
+    Y.resize(0, 0);
+    return;
+  }
+  Y.assign(x_size - 1, 0.0);
+  // Note: Errors will be squared until the last step.
+  E.assign(x_size - 1, 0.0);
+
+  const EventHistogrammer histogrammer(X);
+  if (histogrammer.getBinningType() != EventHistogrammer::IRREGULAR) {
+    histogrammer.addWeights(m_tofs.data(), m_weights.data(),
+                            m_errorSquareds.data(), m_tofs.size(), Y, E);
+  } else {
+    const size_t numEvents = size();
+    size_t i = findFirstEvent(X[0]);
+    size_t bin = 0;
+    while (i < numEvents && bin < x_size - 1) {
+      if (m_tofs[i] < X[bin + 1]) {
+        // Convert to double before adding, to preserve precision
+        Y[bin] += double(m_weights[i]);
+        E[bin] += double(m_errorSquareds[i]);
+        ++i;
+      } else {
+        ++bin;
+      }
+    }
+  }
+
+  // Now do the sqrt of all errors
+  std::transform(E.begin(), E.end(), E.begin(),
+                 static_cast<double (*)(double)>(sqrt));
+}
+
+/** Compress the events by grouping those with the same TOF (within a
+ * tolerance) into a single weighted event with the average TOF. The pulse
+ * time is dropped. The columns must be sorted by time-of-flight.
+ * @param tolerance :: how close two event's TOF have to be to be considered
+ * the same.
+ * @param out :: WEIGHTED_NOTIME columns receiving the compressed events. Can
+ * not be this object.
+ */
+void EventColumns::compress(const double tolerance, EventColumns &out) const {
+  if (&out == this)
+    throw std::invalid_argument("EventColumns::compress() can not compress "
+                                "in place.");
+  out.clear();
+  out.m_eventType = WEIGHTED_NOTIME;
+  // We will make a starting guess of 1/20th of the number of input events.
+  out.reserve(size() / 20);
+
+  const bool weighted = hasWeights();
+  // The last TOF to which we are comparing.
+  double lastTof = std::numeric_limits<double>::lowest();
+  // For getting an accurate average TOF
+  double totalTof = 0;
+  int num = 0;
+  // Carrying weight and error
+  double weight = 0;
+  double errorSquared = 0;
+
+  const auto addEvent = [&out, &totalTof, &num, &weight, &errorSquared]() {
+    out.m_tofs.push_back(totalTof / num);
+    out.m_weights.push_back(static_cast<float>(weight));
+    out.m_errorSquareds.push_back(static_cast<float>(errorSquared));
+  };
+
+  for (size_t i = 0; i < size(); ++i) {
+    const double tof = m_tofs[i];
+    const double eventWeight = weighted ? m_weights[i] : 1.0;
+    const double eventErrorSquared = weighted ? m_errorSquareds[i] : 1.0;
+    if ((tof - lastTof) <= tolerance) {
+      weight += eventWeight;
+      errorSquared += eventErrorSquared;
+      num++;
+      totalTof += tof;
+    } else {
+      // We exceeded the tolerance
+      if (num > 0)
+        addEvent();
+      // Start a new combined object
+      num = 1;
+      totalTof = tof;
+      weight = eventWeight;
+      errorSquared = eventErrorSquared;
+      lastTof = tof;
+    }
+  }
+  // Put the last event in there too.
+  if (num > 0)
+    addEvent();
+}
+
+} // namespace DataObjects
+} // namespace Mantid
@@ -0,0 +1,218 @@
+#include "MantidDataObjects/EventHistogrammer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace Mantid {
+namespace DataObjects {
+
+namespace {
+/// Relative deviation of an edge from the ideal grid still treated as regular
+const double BIN_TOLERANCE = 1e-6;
+} // namespace
+
+/** Constructor. Inspects the bin edges to choose how bins will be found.
+ * @param X :: The bin edges. Must be sorted and outlive this object.
+ */
+EventHistogrammer::EventHistogrammer(const MantidVec &X)
+    : m_X(X), m_numBins(X.size() > 1 ? X.size() - 1 : 0),
+      m_binningType(IRREGULAR), m_start(0.), m_inverseStep(0.) {
+  if (m_numBins == 0 ||
+      m_numBins >= static_cast<size_t>(std::numeric_limits<int>::max()))
+    return;
+  if (detectLinear())
+    m_binningType = LINEAR;
+  else if (detectLogarithmic())
+    m_binningType = LOGARITHMIC;
+}
+
+/** Check whether all edges but the last are evenly spaced.
+ * @return true if the binning is linear
+ */
+bool EventHistogrammer::detectLinear() {
+  // The last bin may be wider or narrower than the others.
+  const size_t numRegular = std::max(m_numBins - 1, size_t(1));
+  const double step = (m_X[numRegular] - m_X[0]) / double(numRegular);
+  if (!(step > 0.) || !std::isfinite(step))
+    return false;
+  for (size_t i = 1; i < numRegular; ++i) {
+    if (std::abs(m_X[i] - (m_X[0] + double(i) * step)) > BIN_TOLERANCE * step)
+      return false;
+  }
+  if (!(m_X[m_numBins] > m_X[m_numBins - 1]))
+    return false;
+  m_start = m_X[0];
+  m_inverseStep = 1. / step;
+  return true;
+}
+
+/** Check whether all edges but the last are evenly spaced in log(x).
+ * @return true if the binning is logarithmic
+ */
+bool EventHistogrammer::detectLogarithmic() {
+  if (!(m_X[0] > 0.))
+    return false;
+  const size_t numRegular = std::max(m_numBins - 1, size_t(1));
+  const double logStart = std::log(m_X[0]);
+  const double logStep =
+      (std::log(m_X[numRegular]) - logStart) / double(numRegular);
+  if (!(logStep > 0.) || !std::isfinite(logStep))
+    return false;
+  for (size_t i = 1; i < numRegular; ++i) {
+    if (std::abs(std::log(m_X[i]) - (logStart + double(i) * logStep)) >
+        BIN_TOLERANCE * logStep)
+      return false;
+  }
+  if (!(m_X[m_numBins] > m_X[m_numBins - 1]))
+    return false;
+  m_start = logStart;
+  m_inverseStep = 1. / logStep;
+  return true;
+}
+
+/** Estimate the bins of linearly binned events. The loop has no branches so
+ * it can be vectorised. The estimate is clamped to [-1, numBins].
+ * @param tofs :: time-of-flight of each event
+ * @param numEvents :: number of events
+ * @param bins :: estimated bin index of each event
+ */
+void EventHistogrammer::estimateLinearBins(const double *tofs,
+                                           const std::size_t numEvents,
+                                           int *bins) const {
+  const double start = m_start;
+  const double inverseStep = m_inverseStep;
+  const double upper = static_cast<double>(m_numBins) + 1.;
+  for (size_t i = 0; i < numEvents; ++i) {
+    // Shift by one so truncation towards zero is a floor
+    double bin = (tofs[i] - start) * inverseStep + 1.;
+    bin = bin > 0. ? bin : 0.;
+    bin = bin < upper ? bin : upper;
+    bins[i] = static_cast<int>(bin) - 1;
+  }
+}
+
+/** Estimate the bins of logarithmically binned events. The estimate is
+ * clamped to [-1, numBins].
+ * @param tofs :: time-of-flight of each event
+ * @param numEvents :: number of events
+ * @param bins :: estimated bin index of each event
+ */
+void EventHistogrammer::estimateLogarithmicBins(const double *tofs,
+                                                const std::size_t numEvents,
+                                                int *bins) const {
+  const double start = m_start;
+  const double inverseStep = m_inverseStep;
+  const double upper = static_cast<double>(m_numBins) + 1.;
+  for (size_t i = 0; i < numEvents; ++i) {
+    // log of a non-positive tof gives -inf or NaN, both clamped to -1
+    double bin = (std::log(tofs[i]) - start) * inverseStep + 1.;
+    bin = bin > 0. ? bin : 0.;
+    bin = bin < upper ? bin : upper;
+    bins[i] = static_cast<int>(bin) - 1;
+  }
+}
+
+/** Find the bin of each event.
+ * @param tofs :: time-of-flight of each event
+ * @param numEvents :: number of events
+ * @param bins :: receives the bin index of each event, or -1 if the event is
+ * outside of the bin edges
+ */
+void EventHistogrammer::findBins(const double *tofs,
+                                 const std::size_t numEvents,
+                                 int *bins) const {
+  if (m_numBins == 0) {
+    std::fill(bins, bins + numEvents, -1);
+    return;
+  }
+  const double xMin = m_X.front();
+  const double xMax = m_X.back();
+
+  if (m_binningType == IRREGULAR) {
+    for (size_t i = 0; i < numEvents; ++i) {
+      const double tof = tofs[i];
+      if (tof >= xMin && tof < xMax)
+        bins[i] = static_cast<int>(
+            std::upper_bound(m_X.cbegin(), m_X.cend(), tof) - m_X.cbegin() -
+            1);
+      else
+        bins[i] = -1;
+    }
+    return;
+  }
+
+  if (m_binningType == LINEAR)
+    estimateLinearBins(tofs, numEvents, bins);
+  else
+    estimateLogarithmicBins(tofs, numEvents, bins);
+
+  // Check each estimate against the actual edges. Rounding can put it one bin
+  // out, and the last bin may have a different width.
+  const int lastBin = static_cast<int>(m_numBins) - 1;
+  for (size_t i = 0; i < numEvents; ++i) {
+    const double tof = tofs[i];
+    if (!(tof >= xMin && tof < xMax)) {
+      bins[i] = -1;
+      continue;
+    }
+    int bin = std::min(std::max(bins[i], 0), lastBin);
+    while (tof < m_X[bin])
+      --bin;
+    while (tof >= m_X[bin + 1])
+      ++bin;
+    bins[i] = bin;
+  }
+}
+
+/** Add one count per event to Y.
+ * @param tofs :: time-of-flight of each event
+ * @param numEvents :: number of events
+ * @param Y :: The counts histogram, sized numBins()
+ */
+void EventHistogrammer::addCounts(const double *tofs,
+                                  const std::size_t numEvents,
+                                  MantidVec &Y) const {
+  std::array<int, BLOCK_SIZE> bins;
+  for (size_t start = 0; start < numEvents; start += BLOCK_SIZE) {
+    const size_t remaining = numEvents - start;
+    const size_t count = remaining < BLOCK_SIZE ? remaining : BLOCK_SIZE;
+    findBins(tofs + start, count, bins.data());
+    for (size_t i = 0; i < count; ++i) {
+      if (bins[i] >= 0)
+        Y[bins[i]] += 1.;
+    }
+  }
+}
+
+/** Add the weight and squared error of each event to Y and E. E is left
+ * holding squared errors.
+ * @param tofs :: time-of-flight of each event
+ * @param weights :: weight of each event
+ * @param errorSquareds :: squared error of each event
+ * @param numEvents :: number of events
+ * @param Y :: The summed weights, sized numBins()
+ * @param E :: The summed squared errors, sized numBins()
+ */
+void EventHistogrammer::addWeights(const double *tofs, const float *weights,
+                                   const float *errorSquareds,
+                                   const std::size_t numEvents, MantidVec &Y,
+                                   MantidVec &E) const {
+  std::array<int, BLOCK_SIZE> bins;
+  for (size_t start = 0; start < numEvents; start += BLOCK_SIZE) {
+    const size_t remaining = numEvents - start;
+    const size_t count = remaining < BLOCK_SIZE ? remaining : BLOCK_SIZE;
+    findBins(tofs + start, count, bins.data());
+    for (size_t i = 0; i < count; ++i) {
+      const int bin = bins[i];
+      if (bin >= 0) {
+        // Convert to double before adding, to preserve precision
+        Y[bin] += double(weights[start + i]);
+        E[bin] += double(errorSquareds[start + i]);
+      }
+    }
+  }
+}
+
+} // namespace DataObjects
+} // namespace Mantid
@@ -1,4 +1,7 @@
 #include "MantidDataObjects/EventList.h"
+#include "MantidDataObjects/CompressedEvents.h"
+#include "MantidDataObjects/EventColumns.h"
+#include "MantidDataObjects/EventHistogrammer.h"
 #include "MantidDataObjects/Histogram1D.h"
 #include "MantidAPI/MatrixWorkspace.h"
 #include "MantidDataObjects/EventWorkspaceMRU.h"
@@ -6,7 +9,10 @@
 #include "MantidKernel/DateAndTimeHelpers.h"
 #include "MantidKernel/Exception.h"
 #include "MantidKernel/Logger.h"
+#include "MantidKernel/RadixSort.h"
+#include "MantidKernel/TaskRuntime.h"
 #include "MantidKernel/Unit.h"
+#include "MantidKernel/make_unique.h"
 
 #ifdef _MSC_VER
 // qualifier applied to function type has no meaning; ignored
@@ -17,6 +23,7 @@
 #pragma warning(default : 4180)
 #endif
 
+#include <algorithm>
 #include <cfloat>
 #include <cmath>
 #include <functional>
@@ -85,7 +92,115 @@ public:
     return (tAtSample1 < tAtSample2);
   }
 };
+
+/// Lists shorter than this are sorted with std::sort
+const size_t RADIX_SORT_MIN_EVENTS = 4096;
+/// Lists at least this long are radix sorted by several threads
+const size_t PARALLEL_SORT_MIN_EVENTS = 262144;
+
+/// Radix sort key ordering events by time-of-flight
+template <typename EventType> uint64_t tofKey(const EventType &event) {
+  return Kernel::RadixSort::keyFromDouble(event.tof());
+}
+
+/// Radix sort key ordering events by pulse time
+template <typename EventType> uint64_t pulseTimeKey(const EventType &event) {
+  return Kernel::RadixSort::keyFromInt64(
+      event.pulseTime().totalNanoseconds());
+}
+
+/**
+ * Radix sort a vector of events. Very long lists, typically monitors, are
+ * sorted by several threads so that they do not hold up a workspace-wide
+ * sort.
+ * @param events :: the events to sort
+ * @param key :: radix sort key of an event
+ */
+template <typename EventType, typename KeyFunction>
+void radixSortEvents(std::vector<EventType> &events, KeyFunction key) {
+  if (events.size() < PARALLEL_SORT_MIN_EVENTS ||
+      Kernel::TaskRuntime::inParallelRegion()) {
+    Kernel::RadixSort::sort(events, key);
+    return;
+  }
+  Kernel::TaskRuntime::execute([&events, &key]() {
+    Kernel::RadixSort::parallelSort(
+        events, key, static_cast<size_t>(Kernel::TaskRuntime::maxThreads()));
+  });
+}
+
+/**
+ * Sort a vector of events with the method best suited to its length: a
+ * comparison sort for short lists and a radix sort on the 64-bit key for
+ * longer ones, whose cost grows linearly with the number of events.
+ * @param events :: the events to sort
+ * @param compare :: comparison of two events
+ * @param key :: radix sort key of an event, ordered like compare
+ */
+template <typename EventType, typename Compare, typename KeyFunction>
+void sortEvents(std::vector<EventType> &events, Compare compare,
+                KeyFunction key) {
+  if (events.size() < RADIX_SORT_MIN_EVENTS)
+    std::sort(events.begin(), events.end(), compare);
+  else
+    radixSortEvents(events, key);
+}
+
+/**
+ * Sort a vector of events ordered by a primary and then a secondary key,
+ * choosing the method as above. The radix sort sorts by the secondary key
+ * and then, stably, by the primary key.
+ * @param events :: the events to sort
+ * @param compare :: comparison of two events
+ * @param primaryKey :: radix sort key deciding the order
+ * @param secondaryKey :: radix sort key ordering events with equal primary
+ * keys
+ */
+template <typename EventType, typename Compare, typename PrimaryKey,
+          typename SecondaryKey>
+void sortEvents(std::vector<EventType> &events, Compare compare,
+                PrimaryKey primaryKey, SecondaryKey secondaryKey) {
+  if (events.size() < RADIX_SORT_MIN_EVENTS) {
+    std::sort(events.begin(), events.end(), compare);
+  } else {
+    radixSortEvents(events, secondaryKey);
+    radixSortEvents(events, primaryKey);
+  }
 }
+
+/** Binary search for the first event, in a range sorted by pulse time, whose
+ * pulse time is not before the given time.
+ * @param first :: start of the range
+ * @param last :: end of the range
+ * @param time :: the pulse time to look for
+ * @return iterator to the first event with pulse time >= time, or last
+ */
+template <typename Iterator>
+Iterator lowerBoundPulseTime(Iterator first, Iterator last,
+                             const DateAndTime &time) {
+  using Event = typename std::iterator_traits<Iterator>::value_type;
+  return std::lower_bound(first, last, time,
+                          [](const Event &event, const DateAndTime &value) {
+                            return event.pulseTime() < value;
+                          });
+}
+
+/** Append a range of events in one go to an EventList holding the same type
+ * of events. The list is then unsorted, as with EventList::addEventQuickly.
+ * @param output :: the list to append to. Only used if the range is not empty.
+ * @param first :: start of the range of events
+ * @param last :: end of the range of events
+ */
+template <typename Iterator>
+void appendEvents(EventList *output, Iterator first, Iterator last) {
+  if (first == last)
+    return;
+  std::vector<typename std::iterator_traits<Iterator>::value_type> *events;
+  getEventsFrom(*output, events);
+  events->insert(events->end(), first, last);
+  output->setSortOrder(UNSORTED);
+}
+} // namespace
 //==========================================================================
 /// --------------------- TofEvent Comparators
 /// ----------------------------------
@@ -232,6 +347,12 @@ void EventList::copyDataInto(EventList &sink) const {
   sink.events = events;
   sink.weightedEvents = weightedEvents;
   sink.weightedEventsNoTime = weightedEventsNoTime;
+  sink.m_columns =
+      m_columns ? Kernel::make_unique<EventColumns>(*m_columns) : nullptr;
+  sink.m_compressed = m_compressed
+                          ? Kernel::make_unique<CompressedEvents>(*m_compressed)
+                          : nullptr;
+  sink.m_decoded = m_decoded.load();
   sink.eventType = eventType;
   sink.order = order;
 }
@@ -342,6 +463,12 @@ EventList &EventList::operator=(const EventList &rhs) {
   events = rhs.events;
   weightedEvents = rhs.weightedEvents;
   weightedEventsNoTime = rhs.weightedEventsNoTime;
+  m_columns = rhs.m_columns ? Kernel::make_unique<EventColumns>(*rhs.m_columns)
+                            : nullptr;
+  m_compressed = rhs.m_compressed
+                     ? Kernel::make_unique<CompressedEvents>(*rhs.m_compressed)
+                     : nullptr;
+  m_decoded = rhs.m_decoded.load();
   eventType = rhs.eventType;
   order = rhs.order;
   return *this;
@@ -354,6 +481,7 @@ EventList &EventList::operator=(const EventList &rhs) {
  * */
 EventList &EventList::operator+=(const TofEvent &event) {
 
+  this->unpackEvents();
   switch (this->eventType) {
   case TOF:
     // Simply push the events
@@ -381,6 +509,7 @@ EventList &EventList::operator+=(const TofEvent &event) {
  * @return reference to this
  * */
 EventList &EventList::operator+=(const std::vector<TofEvent> &more_events) {
+  this->unpackEvents();
   switch (this->eventType) {
   case TOF:
     // Simply push the events
@@ -421,6 +550,7 @@ EventList &EventList::operator+=(const std::vector<TofEvent> &more_events) {
  * @return reference to this
  * */
 EventList &EventList::operator+=(const WeightedEvent &event) {
+  this->unpackEvents();
   this->switchTo(WEIGHTED);
   this->weightedEvents.push_back(event);
   this->order = UNSORTED;
@@ -437,6 +567,7 @@ EventList &EventList::operator+=(const WeightedEvent &event) {
  * */
 EventList &EventList::
 operator+=(const std::vector<WeightedEvent> &more_events) {
+  this->unpackEvents();
   switch (this->eventType) {
   case TOF:
     // Need to switch to weighted
@@ -474,6 +605,7 @@ operator+=(const std::vector<WeightedEvent> &more_events) {
  * */
 EventList &EventList::
 operator+=(const std::vector<WeightedEventNoTime> &more_events) {
+  this->unpackEvents();
   switch (this->eventType) {
   case TOF:
   case WEIGHTED:
@@ -502,6 +634,8 @@ operator+=(const std::vector<WeightedEventNoTime> &more_events) {
  * @return reference to this
  * */
 EventList &EventList::operator+=(const EventList &more_events) {
+  this->unpackEvents();
+  more_events.decodeEvents();
   // We'll let the += operator for the given vector of event lists handle it
   switch (more_events.getEventType()) {
   case TOF:
@@ -567,6 +701,7 @@ void EventList::minusHelper(std::vector<T1> &events,
  * @return reference to this
  * */
 EventList &EventList::operator-=(const EventList &more_events) {
+  this->unpackEvents();
   if (this == &more_events) {
     // Special case, ticket #3844 part 2.
     // When doing this = this - this,
@@ -574,6 +709,7 @@ EventList &EventList::operator-=(const EventList &more_events) {
     this->clearData();
     return *this;
   }
+  more_events.decodeEvents();
 
   // We'll let the -= operator for the given vector of event lists handle it
   switch (this->getEventType()) {
@@ -624,6 +760,8 @@ EventList &EventList::operator-=(const EventList &more_events) {
  * @return :: true if equal.
  */
 bool EventList::operator==(const EventList &rhs) const {
+  this->decodeEvents();
+  rhs.decodeEvents();
   if (this->getNumberEvents() != rhs.getNumberEvents())
     return false;
   if (this->eventType != rhs.eventType)
@@ -648,6 +786,8 @@ bool EventList::operator!=(const EventList &rhs) const {
 
 bool EventList::equals(const EventList &rhs, const double tolTof,
                        const double tolWeight, const int64_t tolPulse) const {
+  this->decodeEvents();
+  rhs.decodeEvents();
   // generic checks
   if (this->getNumberEvents() != rhs.getNumberEvents())
     return false;
@@ -696,6 +836,7 @@ EventType EventList::getEventType() const { return eventType; }
  * WEIGHTED_NOTIME)
  */
 void EventList::switchTo(EventType newType) {
+  this->unpackEvents();
   switch (newType) {
   case TOF:
     if (eventType != TOF)
@@ -788,6 +929,7 @@ void EventList::switchToWeightedEventsNoTime() {
  * @return a WeightedEvent
  */
 WeightedEvent EventList::getEvent(size_t event_number) {
+  this->unpackEvents();
   switch (eventType) {
   case TOF:
     return WeightedEvent(events[event_number]);
@@ -814,6 +956,7 @@ WeightedEvent EventList::getEvent(size_t event_number) {
  * @return a const reference to the list of non-weighted events
  * */
 const std::vector<TofEvent> &EventList::getEvents() const {
+  this->decodeEvents();
   if (eventType != TOF)
     throw std::runtime_error("EventList::getEvents() called for an EventList "
                              "that has weights. Use getWeightedEvents() or "
@@ -829,6 +972,7 @@ const std::vector<TofEvent> &EventList::getEvents() const {
  * @return a reference to the list of non-weighted events
  * */
 std::vector<TofEvent> &EventList::getEvents() {
+  this->unpackEvents();
   if (eventType != TOF)
     throw std::runtime_error("EventList::getEvents() called for an EventList "
                              "that has weights. Use getWeightedEvents() or "
@@ -844,6 +988,7 @@ std::vector<TofEvent> &EventList::getEvents() {
  * @return a reference to the list of weighted events
  * */
 std::vector<WeightedEvent> &EventList::getWeightedEvents() {
+  this->unpackEvents();
   if (eventType != WEIGHTED)
     throw std::runtime_error("EventList::getWeightedEvents() called for an "
                              "EventList not of type WeightedEvent. Use "
@@ -859,6 +1004,7 @@ std::vector<WeightedEvent> &EventList::getWeightedEvents() {
  * @return a const reference to the list of weighted events
  * */
 const std::vector<WeightedEvent> &EventList::getWeightedEvents() const {
+  this->decodeEvents();
   if (eventType != WEIGHTED)
     throw std::runtime_error("EventList::getWeightedEvents() called for an "
                              "EventList not of type WeightedEvent. Use "
@@ -872,6 +1018,7 @@ const std::vector<WeightedEvent> &EventList::getWeightedEvents() const {
  * @return a reference to the list of weighted events
  * */
 std::vector<WeightedEventNoTime> &EventList::getWeightedEventsNoTime() {
+  this->unpackEvents();
   if (eventType != WEIGHTED_NOTIME)
     throw std::runtime_error("EventList::getWeightedEvents() called for an "
                              "EventList not of type WeightedEventNoTime. Use "
@@ -886,6 +1033,7 @@ std::vector<WeightedEventNoTime> &EventList::getWeightedEventsNoTime() {
  * */
 const std::vector<WeightedEventNoTime> &
 EventList::getWeightedEventsNoTime() const {
+  this->decodeEvents();
   if (eventType != WEIGHTED_NOTIME)
     throw std::runtime_error("EventList::getWeightedEventsNoTime() called for "
                              "an EventList not of type WeightedEventNoTime. "
@@ -907,6 +1055,11 @@ void EventList::clear(const bool removeDetIDs) {
   this->weightedEventsNoTime.clear();
   std::vector<WeightedEventNoTime>().swap(
       this->weightedEventsNoTime); // STL Trick to release memory
+  // Column or compressed storage stays selected, just without any events
+  if (m_columns)
+    m_columns->clear();
+  if (m_compressed)
+    m_compressed->clear();
   if (removeDetIDs)
     this->clearDetectorIDs();
 }
@@ -916,16 +1069,20 @@ void EventList::clear(const bool removeDetIDs) {
  * Memory is freed.
  * */
 void EventList::clearUnused() {
-  if (eventType != TOF) {
+  // With column or compressed storage the event vectors at most hold a
+  // decoded copy, which is dropped too
+  const bool unpacked = !m_columns && !m_compressed;
+  m_decoded = false;
+  if (eventType != TOF || !unpacked) {
     this->events.clear();
     std::vector<TofEvent>().swap(this->events); // STL Trick to release memory
   }
-  if (eventType != WEIGHTED) {
+  if (eventType != WEIGHTED || !unpacked) {
     this->weightedEvents.clear();
     std::vector<WeightedEvent>().swap(
         this->weightedEvents); // STL Trick to release memory
   }
-  if (eventType != WEIGHTED_NOTIME) {
+  if (eventType != WEIGHTED_NOTIME || !unpacked) {
     this->weightedEventsNoTime.clear();
     std::vector<WeightedEventNoTime>().swap(
         this->weightedEventsNoTime); // STL Trick to release memory
@@ -950,7 +1107,106 @@ void EventList::setMRU(EventWorkspaceMRU *newMRU) { mru = newMRU; }
  *
  * @param num :: number of events that will be in this EventList
  */
-void EventList::reserve(size_t num) { this->events.reserve(num); }
+void EventList::reserve(size_t num) {
+  this->unpackEvents();
+  this->events.reserve(num);
+}
+
+/** Select how the events are laid out in memory. Converting to column or
+ * compressed storage copies the events into an EventColumns or
+ * CompressedEvents object and releases the event vectors; converting back
+ * does the reverse. The sort order is kept.
+ *
+ * @param type :: STRUCT_STORAGE, COLUMN_STORAGE or COMPRESSED_STORAGE
+ */
+void EventList::setStorageType(const EventStorageType type) {
+  if (type == getStorageType())
+    return;
+  this->unpackEvents();
+  if (type == STRUCT_STORAGE)
+    return;
+
+  switch (eventType) {
+  case TOF:
+    if (type == COLUMN_STORAGE)
+      m_columns = Kernel::make_unique<EventColumns>(events);
+    else
+      m_compressed = Kernel::make_unique<CompressedEvents>(events);
+    break;
+  case WEIGHTED:
+    if (type == COLUMN_STORAGE)
+      m_columns = Kernel::make_unique<EventColumns>(weightedEvents);
+    else
+      m_compressed = Kernel::make_unique<CompressedEvents>(weightedEvents);
+    break;
+  case WEIGHTED_NOTIME:
+    if (type == COLUMN_STORAGE)
+      m_columns = Kernel::make_unique<EventColumns>(weightedEventsNoTime);
+    else
+      m_compressed =
+          Kernel::make_unique<CompressedEvents>(weightedEventsNoTime);
+    break;
+  }
+  this->clearUnused();
+}
+
+/** Return how the events are currently laid out in memory */
+EventStorageType EventList::getStorageType() const {
+  if (m_compressed)
+    return COMPRESSED_STORAGE;
+  return m_columns ? COLUMN_STORAGE : STRUCT_STORAGE;
+}
+
+/** Move the events from column or compressed storage back into the event
+ * vectors, ahead of an operation that changes the events. Does nothing if the
+ * list is already in struct storage.
+ */
+void EventList::unpackEvents() {
+  if (!m_columns && !m_compressed)
+    return;
+  this->decodeEvents();
+  m_columns.reset();
+  m_compressed.reset();
+  m_decoded = false;
+}
+
+/** Decode the events from column or compressed storage into the event
+ * vectors, for a const method that only works on event structs. The column
+ * or compressed storage is kept, so other threads may keep reading it. Does
+ * nothing if the list is in struct storage or was already decoded.
+ */
+void EventList::decodeEvents() const {
+  if ((!m_columns && !m_compressed) || m_decoded)
+    return;
+
+  // Avoid decoding from multiple threads
+  std::lock_guard<std::mutex> _lock(m_sortMutex);
+  // If the list was decoded while waiting for the lock, return.
+  if (m_decoded)
+    return;
+
+  switch (eventType) {
+  case TOF:
+    if (m_columns)
+      m_columns->copyTo(events);
+    else
+      m_compressed->copyTo(events);
+    break;
+  case WEIGHTED:
+    if (m_columns)
+      m_columns->copyTo(weightedEvents);
+    else
+      m_compressed->copyTo(weightedEvents);
+    break;
+  case WEIGHTED_NOTIME:
+    if (m_columns)
+      m_columns->copyTo(weightedEventsNoTime);
+    else
+      m_compressed->copyTo(weightedEventsNoTime);
+    break;
+  }
+  m_decoded = true;
+}
 
 // ==============================================================================================
 // --- Sorting functions -----------------------------------------------------
@@ -1032,23 +1288,47 @@ void EventList::sortTof() const {
   if (this->order == TOF_SORT)
     return; // nothing to do
 
+  // Compressed events are never reordered in place; their decoded copy is
+  if (m_compressed)
+    this->decodeEvents();
+
   // Avoid sorting from multiple threads
   std::lock_guard<std::mutex> _lock(m_sortMutex);
   // If the list was sorted while waiting for the lock, return.
   if (this->order == TOF_SORT)
     return;
 
+  if (m_columns) {
+    m_columns->sortTof();
+    // Refresh a decoded copy in place, it has the same size
+    if (m_decoded) {
+      switch (eventType) {
+      case TOF:
+        m_columns->copyTo(events);
+        break;
+      case WEIGHTED:
+        m_columns->copyTo(weightedEvents);
+        break;
+      case WEIGHTED_NOTIME:
+        m_columns->copyTo(weightedEventsNoTime);
+        break;
+      }
+    }
+    this->order = TOF_SORT;
+    return;
+  }
+
   switch (eventType) {
   case TOF:
-    tbb::parallel_sort(events.begin(), events.end(), compareEventTof<TofEvent>);
+    sortEvents(events, compareEventTof<TofEvent>, tofKey<TofEvent>);
     break;
   case WEIGHTED:
-    tbb::parallel_sort(weightedEvents.begin(), weightedEvents.end(),
-                       compareEventTof<WeightedEvent>);
+    sortEvents(weightedEvents, compareEventTof<WeightedEvent>,
+               tofKey<WeightedEvent>);
     break;
   case WEIGHTED_NOTIME:
-    tbb::parallel_sort(weightedEventsNoTime.begin(), weightedEventsNoTime.end(),
-                       compareEventTof<WeightedEventNoTime>);
+    sortEvents(weightedEventsNoTime, compareEventTof<WeightedEventNoTime>,
+               tofKey<WeightedEventNoTime>);
     break;
   }
   // Save the order to avoid unnecessary re-sorting.
@@ -1067,6 +1347,7 @@ void EventList::sortTof() const {
 void EventList::sortTimeAtSample(const double &tofFactor,
                                  const double &tofShift,
                                  bool forceResort) const {
+  this->decodeEvents();
   // Check pre-cached sort flag.
   if (this->order == TIMEATSAMPLE_SORT && !forceResort)
     return;
@@ -1077,21 +1358,26 @@ void EventList::sortTimeAtSample(const double &tofFactor,
   if (this->order == TIMEATSAMPLE_SORT && !forceResort)
     return;
 
+  // The radix sort computes the time at sample once per event, rather than
+  // twice per comparison.
+  const auto timeAtSampleKey = [tofFactor, tofShift](const auto &event) {
+    return Kernel::RadixSort::keyFromInt64(
+        calculateCorrectedFullTime(event, tofFactor, tofShift));
+  };
+
   // Perform sort.
   switch (eventType) {
   case TOF: {
     CompareTimeAtSample<TofEvent> comparitor(tofFactor, tofShift);
-    tbb::parallel_sort(events.begin(), events.end(), comparitor);
+    sortEvents(events, comparitor, timeAtSampleKey);
   } break;
   case WEIGHTED: {
     CompareTimeAtSample<WeightedEvent> comparitor(tofFactor, tofShift);
-    tbb::parallel_sort(weightedEvents.begin(), weightedEvents.end(),
-                       comparitor);
+    sortEvents(weightedEvents, comparitor, timeAtSampleKey);
   } break;
   case WEIGHTED_NOTIME: {
     CompareTimeAtSample<WeightedEventNoTime> comparitor(tofFactor, tofShift);
-    tbb::parallel_sort(weightedEventsNoTime.begin(), weightedEventsNoTime.end(),
-                       comparitor);
+    sortEvents(weightedEventsNoTime, comparitor, timeAtSampleKey);
   } break;
   }
   // Save the order to avoid unnecessary re-sorting.
@@ -1101,6 +1387,7 @@ void EventList::sortTimeAtSample(const double &tofFactor,
 // --------------------------------------------------------------------------
 /** Sort events by Frame */
 void EventList::sortPulseTime() const {
+  this->decodeEvents();
   if (this->order == PULSETIME_SORT)
     return; // nothing to do
 
@@ -1113,11 +1400,11 @@ void EventList::sortPulseTime() const {
   // Perform sort.
   switch (eventType) {
   case TOF:
-    tbb::parallel_sort(events.begin(), events.end(), compareEventPulseTime);
+    sortEvents(events, compareEventPulseTime, pulseTimeKey<TofEvent>);
     break;
   case WEIGHTED:
-    tbb::parallel_sort(weightedEvents.begin(), weightedEvents.end(),
-                       compareEventPulseTime);
+    sortEvents(weightedEvents, compareEventPulseTime,
+               pulseTimeKey<WeightedEvent>);
     break;
   case WEIGHTED_NOTIME:
     // Do nothing; there is no time to sort
@@ -1132,6 +1419,7 @@ void EventList::sortPulseTime() const {
  * (the absolute time)
  */
 void EventList::sortPulseTimeTOF() const {
+  this->decodeEvents();
   if (this->order == PULSETIMETOF_SORT)
     return; // already ordered.
 
@@ -1143,11 +1431,12 @@ void EventList::sortPulseTimeTOF() const {
 
   switch (eventType) {
   case TOF:
-    tbb::parallel_sort(events.begin(), events.end(), compareEventPulseTimeTOF);
+    sortEvents(events, compareEventPulseTimeTOF, pulseTimeKey<TofEvent>,
+               tofKey<TofEvent>);
     break;
   case WEIGHTED:
-    tbb::parallel_sort(weightedEvents.begin(), weightedEvents.end(),
-                       compareEventPulseTimeTOF);
+    sortEvents(weightedEvents, compareEventPulseTimeTOF,
+               pulseTimeKey<WeightedEvent>, tofKey<WeightedEvent>);
     break;
   case WEIGHTED_NOTIME:
     // Do nothing; there is no time to sort
@@ -1167,6 +1456,7 @@ void EventList::sortPulseTimeTOF() const {
  */
 void EventList::sortPulseTimeTOFDelta(const Types::Core::DateAndTime &start,
                                       const double seconds) const {
+  this->decodeEvents();
   // Avoid sorting from multiple threads
   std::lock_guard<std::mutex> _lock(m_sortMutex);
 
@@ -1175,11 +1465,15 @@ void EventList::sortPulseTimeTOFDelta(const Types::Core::DateAndTime &start,
 
   switch (eventType) {
   case TOF:
-    tbb::parallel_sort(events.begin(), events.end(), comparator);
+    Kernel::TaskRuntime::execute([this, &comparator]() {
+      tbb::parallel_sort(events.begin(), events.end(), comparator);
+    });
     break;
   case WEIGHTED:
-    tbb::parallel_sort(weightedEvents.begin(), weightedEvents.end(),
-                       comparator);
+    Kernel::TaskRuntime::execute([this, &comparator]() {
+      tbb::parallel_sort(weightedEvents.begin(), weightedEvents.end(),
+                         comparator);
+    });
     break;
   case WEIGHTED_NOTIME:
     // Do nothing; there is no time to sort
@@ -1209,7 +1503,12 @@ void EventList::reverse() {
   std::reverse(x.begin(), x.end());
 
   // flip the events if they are tof sorted
-  if (this->isSortedByTof()) {
+  if (this->isSortedByTof() && m_compressed)
+    this->unpackEvents();
+  if (this->isSortedByTof() && m_columns) {
+    this->clearUnused();
+    m_columns->reverse();
+  } else if (this->isSortedByTof()) {
     switch (eventType) {
     case TOF:
       std::reverse(this->events.begin(), this->events.end());
@@ -1236,6 +1535,10 @@ void EventList::reverse() {
  * @return the number of events in the list.
  *  */
 size_t EventList::getNumberEvents() const {
+  if (m_columns)
+    return m_columns->size();
+  if (m_compressed)
+    return m_compressed->size();
   switch (eventType) {
   case TOF:
     return this->events.size();
@@ -1251,6 +1554,10 @@ size_t EventList::getNumberEvents() const {
  * Much like stl containers, returns true if there is nothing in the event list.
  */
 bool EventList::empty() const {
+  if (m_columns)
+    return m_columns->empty();
+  if (m_compressed)
+    return m_compressed->empty();
   switch (eventType) {
   case TOF:
     return this->events.empty();
@@ -1270,6 +1577,19 @@ bool EventList::empty() const {
  * @return :: the memory used by the EventList, in bytes.
  * */
 size_t EventList::getMemorySize() const {
+  // A decoded copy of column or compressed storage counts as well
+  const size_t decodedSize =
+      m_decoded ? this->events.capacity() * sizeof(TofEvent) +
+                      this->weightedEvents.capacity() * sizeof(WeightedEvent) +
+                      this->weightedEventsNoTime.capacity() *
+                          sizeof(WeightedEventNoTime)
+                : 0;
+  if (m_columns)
+    return m_columns->getMemorySize() + sizeof(EventColumns) +
+           sizeof(EventList) + decodedSize;
+  if (m_compressed)
+    return m_compressed->getMemorySize() + sizeof(CompressedEvents) +
+           sizeof(EventList) + decodedSize;
   switch (eventType) {
   case TOF:
     return this->events.capacity() * sizeof(TofEvent) + sizeof(EventList);
@@ -1752,6 +2072,20 @@ inline void EventList::compressFatEventsHelper(
  *be == this.
  */
 void EventList::compressEvents(double tolerance, EventList *destination) {
+  if (m_compressed)
+    this->unpackEvents();
+  if (m_columns) {
+    // Compress column to column, the destination ends up in column storage
+    this->sortTof();
+    auto out = Kernel::make_unique<EventColumns>(WEIGHTED_NOTIME);
+    m_columns->compress(tolerance, *out);
+    destination->m_columns = std::move(out);
+    destination->eventType = WEIGHTED_NOTIME;
+    destination->order = TOF_SORT;
+    destination->clearUnused();
+    return;
+  }
+  destination->unpackEvents();
   if (!this->empty()) {
     this->sortTof();
     switch (eventType) {
@@ -1808,6 +2142,8 @@ void EventList::compressEvents(double tolerance, EventList *destination) {
 void EventList::compressFatEvents(
     const double tolerance, const Mantid::Types::Core::DateAndTime &timeStart,
     const double seconds, EventList *destination) {
+  this->unpackEvents();
+  destination->unpackEvents();
 
   // only worry about non-empty EventLists
   if (!this->empty()) {
@@ -1883,17 +2219,13 @@ template <class T>
 typename std::vector<T>::const_iterator
 EventList::findFirstPulseEvent(const std::vector<T> &events,
                                const double seek_pulsetime) {
-  auto itev = events.begin();
-  auto itev_end = events.end(); // cache for speed
-
-  // if tof < X[0], that means that you need to skip some events
-  while ((itev != itev_end) &&
-         (static_cast<double>(itev->pulseTime().totalNanoseconds()) <
-          seek_pulsetime))
-    itev++;
-  // Better fix would be to use a binary search instead of the linear one used
-  // here.
-  return itev;
+  // The events are sorted by pulse time: binary search for the first one
+  return std::lower_bound(
+      events.begin(), events.end(), seek_pulsetime,
+      [](const T &event, const double value) {
+        return static_cast<double>(event.pulseTime().totalNanoseconds()) <
+               value;
+      });
 }
 
 // --------------------------------------------------------------------------
@@ -1987,6 +2319,15 @@ void EventList::histogramForWeightsHelper(const std::vector<T> &events,
     std::fill(E.begin(), E.end(), 0.0);
   }
 
+  // Linear and logarithmic bins can be found without walking the edges
+  const EventHistogrammer histogrammer(X);
+  if (histogrammer.getBinningType() != EventHistogrammer::IRREGULAR) {
+    histogrammer.addWeights(events.cbegin(), events.cend(), Y, E);
+    std::transform(E.begin(), E.end(), E.begin(),
+                   static_cast<double (*)(double)>(sqrt));
+    return;
+  }
+
   //---------------------- Histogram without weights
   //---------------------------------
 
@@ -2056,6 +2397,7 @@ void EventList::histogramForWeightsHelper(const std::vector<T> &events,
  */
 void EventList::generateHistogramPulseTime(const MantidVec &X, MantidVec &Y,
                                            MantidVec &E, bool skipError) const {
+  this->decodeEvents();
   // All types of weights need to be sorted by Pulse Time
   this->sortPulseTime();
 
@@ -2126,9 +2468,10 @@ void EventList::generateHistogramTimeAtSample(const MantidVec &X, MantidVec &Y,
  */
 void EventList::generateHistogram(const MantidVec &X, MantidVec &Y,
                                   MantidVec &E, bool skipError) const {
-  // All types of weights need to be sorted by TOF
-
-  this->sortTof();
+  // All types of weights need to be sorted by TOF, except compressed events
+  // which are histogrammed in their stored order
+  if (!m_compressed)
+    this->sortTof();
 
   switch (eventType) {
   case TOF:
@@ -2139,10 +2482,26 @@ void EventList::generateHistogram(const MantidVec &X, MantidVec &Y,
     break;
 
   case WEIGHTED:
+    if (m_columns) {
+      m_columns->histogramWeights(X, Y, E);
+      break;
+    }
+    if (m_compressed) {
+      m_compressed->histogramWeights(X, Y, E);
+      break;
+    }
     histogramForWeightsHelper(this->weightedEvents, X, Y, E);
     break;
 
   case WEIGHTED_NOTIME:
+    if (m_columns) {
+      m_columns->histogramWeights(X, Y, E);
+      break;
+    }
+    if (m_compressed) {
+      m_compressed->histogramWeights(X, Y, E);
+      break;
+    }
     histogramForWeightsHelper(this->weightedEventsNoTime, X, Y, E);
     break;
   }
@@ -2236,6 +2595,7 @@ void EventList::generateCountsHistogramPulseTime(const double &xMin,
                                                  MantidVec &Y,
                                                  const double TOF_min,
                                                  const double TOF_max) const {
+  this->decodeEvents();
 
   if (this->events.empty())
     return;
@@ -2349,11 +2709,30 @@ void EventList::generateCountsHistogram(const MantidVec &X,
     return;
   }
 
+  // Compressed events do not need to be sorted
+  if (m_compressed) {
+    m_compressed->histogramCounts(X, Y);
+    return;
+  }
+
   // Sort the events by tof
   this->sortTof();
+
+  if (m_columns) {
+    m_columns->histogramCounts(X, Y);
+    return;
+  }
+
   // Clear the Y data, assign all to 0.
   Y.resize(x_size - 1, 0);
 
+  // Linear and logarithmic bins can be found without walking the edges
+  const EventHistogrammer histogrammer(X);
+  if (histogrammer.getBinningType() != EventHistogrammer::IRREGULAR) {
+    histogrammer.addCounts(events.cbegin(), events.cend(), Y);
+    return;
+  }
+
   //---------------------- Histogram without weights
   //---------------------------------
 
@@ -2516,6 +2895,7 @@ double EventList::integrate(const double minX, const double maxX,
 void EventList::integrate(const double minX, const double maxX,
                           const bool entireRange, double &sum,
                           double &error) const {
+  this->decodeEvents();
   sum = 0;
   error = 0;
   if (!entireRange) {
@@ -2567,6 +2947,14 @@ void EventList::convertTof(std::function<double(double)> func,
   if (this->getNumberEvents() <= 0)
     return;
 
+  if (m_compressed)
+    this->unpackEvents();
+  if (m_columns) {
+    this->clearUnused();
+    m_columns->convertTof(func);
+    return;
+  }
+
   // Convert the list
   switch (eventType) {
   case TOF:
@@ -2613,6 +3001,14 @@ void EventList::convertTof(const double factor, const double offset) {
   if (this->getNumberEvents() <= 0)
     return;
 
+  if (m_compressed)
+    this->unpackEvents();
+  if (m_columns) {
+    this->clearUnused();
+    m_columns->convertTof(factor, offset);
+    return;
+  }
+
   // Convert the list
   switch (eventType) {
   case TOF:
@@ -2682,6 +3078,7 @@ void EventList::addPulsetimeHelper(std::vector<T> &events,
  * @param seconds :: The value to shift the pulsetime by, in seconds
  */
 void EventList::addPulsetime(const double seconds) {
+  this->unpackEvents();
   if (this->getNumberEvents() <= 0)
     return;
 
@@ -2762,21 +3159,23 @@ void EventList::maskTof(const double tofMin, const double tofMax) {
   this->sortTof();
 
   // Convert the list
-  size_t numOrig = 0;
+  size_t numOrig = this->getNumberEvents();
   size_t numDel = 0;
-  switch (eventType) {
-  case TOF:
-    numOrig = this->events.size();
-    numDel = this->maskTofHelper(this->events, tofMin, tofMax);
-    break;
-  case WEIGHTED:
-    numOrig = this->weightedEvents.size();
-    numDel = this->maskTofHelper(this->weightedEvents, tofMin, tofMax);
-    break;
-  case WEIGHTED_NOTIME:
-    numOrig = this->weightedEventsNoTime.size();
-    numDel = this->maskTofHelper(this->weightedEventsNoTime, tofMin, tofMax);
-    break;
+  if (m_columns) {
+    this->clearUnused();
+    numDel = m_columns->maskTof(tofMin, tofMax);
+  } else {
+    switch (eventType) {
+    case TOF:
+      numDel = this->maskTofHelper(this->events, tofMin, tofMax);
+      break;
+    case WEIGHTED:
+      numDel = this->maskTofHelper(this->weightedEvents, tofMin, tofMax);
+      break;
+    case WEIGHTED_NOTIME:
+      numDel = this->maskTofHelper(this->weightedEventsNoTime, tofMin, tofMax);
+      break;
+    }
   }
 
   if (numDel >= numOrig)
@@ -2801,6 +3200,18 @@ void EventList::getTofsHelper(const std::vector<T> &events,
  *  @param tofs :: A reference to the vector to be filled
  */
 void EventList::getTofs(std::vector<double> &tofs) const {
+  // A decoded copy may have been sorted differently by a const sort, so
+  // read it when there is one
+  if (m_columns && !m_decoded) {
+    tofs.assign(m_columns->tofs().cbegin(), m_columns->tofs().cend());
+    return;
+  }
+  if (m_compressed && !m_decoded) {
+    tofs.resize(m_compressed->size());
+    m_compressed->decodeTofs(0, tofs.size(), tofs.data());
+    return;
+  }
+
   // Set the capacity of the vector to avoid multiple resizes
   tofs.reserve(this->getNumberEvents());
 
@@ -2847,6 +3258,7 @@ void EventList::getWeightsHelper(const std::vector<T> &events,
  *  @param weights :: A reference to the vector to be filled
  */
 void EventList::getWeights(std::vector<double> &weights) const {
+  this->decodeEvents();
   // Set the capacity of the vector to avoid multiple resizes
   weights.reserve(this->getNumberEvents());
 
@@ -2894,6 +3306,7 @@ void EventList::getWeightErrorsHelper(const std::vector<T> &events,
  *  @param weightErrors :: A reference to the vector to be filled
  */
 void EventList::getWeightErrors(std::vector<double> &weightErrors) const {
+  this->decodeEvents();
   // Set the capacity of the vector to avoid multiple resizes
   weightErrors.reserve(this->getNumberEvents());
 
@@ -2943,6 +3356,7 @@ void EventList::getPulseTimesHelper(
  * @return by copy a vector of DateAndTime times
  */
 std::vector<Mantid::Types::Core::DateAndTime> EventList::getPulseTimes() const {
+  this->decodeEvents();
   std::vector<Mantid::Types::Core::DateAndTime> times;
   // Set the capacity of the vector to avoid multiple resizes
   times.reserve(this->getNumberEvents());
@@ -2974,6 +3388,15 @@ double EventList::getTofMin() const {
   if (this->empty())
     return tMin;
 
+  if (m_columns) {
+    const auto &tofs = m_columns->tofs();
+    if (this->order == TOF_SORT)
+      return tofs.front();
+    return *std::min_element(tofs.cbegin(), tofs.cend());
+  }
+  if (m_compressed)
+    return m_compressed->tofMin();
+
   // when events are ordered by tof just need the first value
   if (this->order == TOF_SORT) {
     switch (eventType) {
@@ -3020,6 +3443,15 @@ double EventList::getTofMax() const {
   if (this->empty())
     return tMax;
 
+  if (m_columns) {
+    const auto &tofs = m_columns->tofs();
+    if (this->order == TOF_SORT)
+      return tofs.back();
+    return *std::max_element(tofs.cbegin(), tofs.cend());
+  }
+  if (m_compressed)
+    return m_compressed->tofMax();
+
   // when events are ordered by tof just need the first value
   if (this->order == TOF_SORT) {
     switch (eventType) {
@@ -3058,6 +3490,7 @@ double EventList::getTofMax() const {
  * @return The minimum tof value for the list of the events.
  */
 DateAndTime EventList::getPulseTimeMin() const {
+  this->decodeEvents();
   // set up as the maximum available date time.
   DateAndTime tMin = DateAndTime::maximum();
 
@@ -3102,6 +3535,7 @@ DateAndTime EventList::getPulseTimeMin() const {
  * @return The maximum tof value for the list of events.
  */
 DateAndTime EventList::getPulseTimeMax() const {
+  this->decodeEvents();
   // set up as the minimum available date time.
   DateAndTime tMax = DateAndTime::minimum();
 
@@ -3145,6 +3579,7 @@ DateAndTime EventList::getPulseTimeMax() const {
 void EventList::getPulseTimeMinMax(
     Mantid::Types::Core::DateAndTime &tMin,
     Mantid::Types::Core::DateAndTime &tMax) const {
+  this->decodeEvents();
   // set up as the minimum available date time.
   tMax = DateAndTime::minimum();
   tMin = DateAndTime::maximum();
@@ -3195,6 +3630,7 @@ void EventList::getPulseTimeMinMax(
 
 DateAndTime EventList::getTimeAtSampleMax(const double &tofFactor,
                                           const double &tofOffset) const {
+  this->decodeEvents();
   // set up as the minimum available date time.
   DateAndTime tMax = DateAndTime::minimum();
 
@@ -3242,6 +3678,7 @@ DateAndTime EventList::getTimeAtSampleMax(const double &tofFactor,
 
 DateAndTime EventList::getTimeAtSampleMin(const double &tofFactor,
                                           const double &tofOffset) const {
+  this->decodeEvents();
   // set up as the minimum available date time.
   DateAndTime tMin = DateAndTime::maximum();
 
@@ -3314,6 +3751,7 @@ void EventList::setTofsHelper(std::vector<T> &events,
  * @param tofs :: The vector of doubles to set the tofs to.
  */
 void EventList::setTofs(const MantidVec &tofs) {
+  this->unpackEvents();
   this->order = UNSORTED;
 
   // Convert the list
@@ -3416,6 +3854,7 @@ EventList &EventList::operator*=(const double value) {
  * @param error: error on 'value'. Can be 0.
  */
 void EventList::multiply(const double value, const double error) {
+  this->unpackEvents();
   // Do nothing if multiplying by exactly one and there is no error
   if ((value == 1.0) && (error == 0.0))
     return;
@@ -3539,6 +3978,7 @@ void EventList::multiplyHistogramHelper(std::vector<T> &events,
  */
 void EventList::multiply(const MantidVec &X, const MantidVec &Y,
                          const MantidVec &E) {
+  this->unpackEvents();
   switch (eventType) {
   case TOF:
     // Switch to weights if needed.
@@ -3676,6 +4116,7 @@ void EventList::divideHistogramHelper(std::vector<T> &events,
  */
 void EventList::divide(const MantidVec &X, const MantidVec &Y,
                        const MantidVec &E) {
+  this->unpackEvents();
   switch (eventType) {
   case TOF:
     // Switch to weights if needed.
@@ -3753,17 +4194,11 @@ template <class T>
 void EventList::filterByPulseTimeHelper(std::vector<T> &events,
                                         DateAndTime start, DateAndTime stop,
                                         std::vector<T> &output) {
-  auto itev = events.begin();
-  auto itev_end = events.end();
-  // Find the first event with m_pulsetime >= start
-  while ((itev != itev_end) && (itev->m_pulsetime < start))
-    itev++;
-
-  while ((itev != itev_end) && (itev->m_pulsetime < stop)) {
-    // Add the copy to the output
-    output.push_back(*itev);
-    ++itev;
-  }
+  // The events are sorted by pulse time, so the window is found by binary
+  // search and copied in one go
+  auto itev = lowerBoundPulseTime(events.cbegin(), events.cend(), start);
+  auto itev_end = lowerBoundPulseTime(itev, events.cend(), stop);
+  output.insert(output.end(), itev, itev_end);
 }
 
 /** Filter a vector of events into another based on time at sample.
@@ -3813,8 +4248,12 @@ void EventList::filterByPulseTime(DateAndTime start, DateAndTime stop,
     throw std::invalid_argument("In-place filtering is not allowed");
   }
 
-  // Start by sorting the event list by pulse time.
-  this->sortPulseTime();
+  // Start by sorting the event list by pulse time. Compressed events are
+  // instead selected through their pulse index, unless a decoded copy that
+  // may have been sorted is at hand.
+  const bool fromCompressed = m_compressed && !m_decoded;
+  if (!fromCompressed)
+    this->sortPulseTime();
   // Clear the output
   output.clear();
   // Has to match the given type
@@ -3823,6 +4262,24 @@ void EventList::filterByPulseTime(DateAndTime start, DateAndTime stop,
   output.setHistogram(m_histogram);
   output.setSortOrder(this->order);
 
+  if (fromCompressed && eventType != WEIGHTED_NOTIME) {
+    const int64_t startNs = start.totalNanoseconds();
+    const int64_t stopNs = stop.totalNanoseconds();
+    if (eventType == TOF)
+      m_compressed->copyPulseTimeRange(startNs, stopNs, output.events);
+    else
+      m_compressed->copyPulseTimeRange(startNs, stopNs, output.weightedEvents);
+    // The output is in pulse time order, as for uncompressed lists
+    if (this->order != PULSETIME_SORT && this->order != PULSETIMETOF_SORT) {
+      output.setSortOrder(UNSORTED);
+      if (m_compressed->isSortedByPulseTime())
+        output.setSortOrder(PULSETIME_SORT);
+      else
+        output.sortPulseTime();
+    }
+    return;
+  }
+
   // Iterate through all events (sorted by pulse time)
   switch (eventType) {
   case TOF:
@@ -3958,6 +4415,7 @@ void EventList::filterInPlaceHelper(Kernel::TimeSplitterType &splitter,
  *     that will be kept. Any other events will be deleted.
  */
 void EventList::filterInPlace(Kernel::TimeSplitterType &splitter) {
+  this->unpackEvents();
   // Start by sorting the event list by pulse time.
   this->sortPulseTime();
 
@@ -4010,21 +4468,15 @@ void EventList::splitByTimeHelper(Kernel::TimeSplitterType &splitter,
     stop = itspl->stop();
     const size_t index = itspl->index();
 
-    // Skip the events before the start of the time
-    while ((itev != itev_end) && (itev->m_pulsetime < start))
-      itev++;
+    // Skip the events before the start of the time. The events are sorted by
+    // pulse time, so the interval is found by binary search.
+    itev = lowerBoundPulseTime(itev, itev_end, start);
+    auto itstop = lowerBoundPulseTime(itev, itev_end, stop);
 
-    // Go through all the events that are in the interval (if any)
-    while ((itev != itev_end) && (itev->m_pulsetime < stop)) {
-      // Copy the event into another
-      const T eventCopy(*itev);
-      if (index < numOutputs) {
-        EventList *myOutput = outputs[index];
-        // Add the copy to the output
-        myOutput->addEventQuickly(eventCopy);
-      }
-      ++itev;
-    }
+    // Copy all the events that are in the interval (if any)
+    if (index < numOutputs)
+      appendEvents(outputs[index], itev, itstop);
+    itev = itstop;
 
     // Go to the next interval
     ++itspl;
@@ -4049,6 +4501,14 @@ void EventList::splitByTimeHelper(Kernel::TimeSplitterType &splitter,
  */
 void EventList::splitByTime(Kernel::TimeSplitterType &splitter,
                             std::vector<EventList *> outputs) const {
+  if (m_compressed) {
+    // Split a decompressed copy so that this list stays compressed
+    EventList unpacked(*this);
+    unpacked.setStorageType(STRUCT_STORAGE);
+    unpacked.splitByTime(splitter, outputs);
+    return;
+  }
+  this->decodeEvents();
   if (eventType == WEIGHTED_NOTIME)
     throw std::runtime_error("EventList::splitByTime() called on an EventList "
                              "that no longer has time information.");
@@ -4119,47 +4579,41 @@ void EventList::splitByFullTimeHelper(Kernel::TimeSplitterType &splitter,
     int64_t stop = itspl->stop().totalNanoseconds();
     const int index = itspl->index();
 
-    // a) Skip the events before the start of the time
-    // TODO This step can be
-    EventList *myOutput = outputs[-1];
-    while (itev != itev_end) {
+    // a) Skip the events before the start of the time. The full time is not
+    // monotonic in the sort order, so this is a scan rather than a search.
+    auto itstart = itev;
+    while (itstart != itev_end) {
       int64_t fulltime;
       if (docorrection)
-        fulltime = calculateCorrectedFullTime(*itev, toffactor, tofshift);
+        fulltime = calculateCorrectedFullTime(*itstart, toffactor, tofshift);
       else
-        fulltime = itev->m_pulsetime.totalNanoseconds() +
-                   static_cast<int64_t>(itev->m_tof * 1000);
-      if (fulltime < start) {
-        // a1) Record to index = -1 space
-        const T eventCopy(*itev);
-        myOutput->addEventQuickly(eventCopy);
-        itev++;
-      } else {
+        fulltime = itstart->m_pulsetime.totalNanoseconds() +
+                   static_cast<int64_t>(itstart->m_tof * 1000);
+      if (fulltime >= start)
         break;
-      }
+      ++itstart;
     }
+    // a1) Record to index = -1 space
+    appendEvents(outputs[-1], itev, itstart);
 
     // b) Go through all the events that are in the interval (if any)
-    while (itev != itev_end) {
+    auto itstop = itstart;
+    while (itstop != itev_end) {
       int64_t fulltime;
       if (docorrection)
-        fulltime = itev->m_pulsetime.totalNanoseconds() +
-                   static_cast<int64_t>(toffactor * itev->m_tof * 1000 +
+        fulltime = itstop->m_pulsetime.totalNanoseconds() +
+                   static_cast<int64_t>(toffactor * itstop->m_tof * 1000 +
                                         tofshift * 1.0E9);
       else
-        fulltime = itev->m_pulsetime.totalNanoseconds() +
-                   static_cast<int64_t>(itev->m_tof * 1000);
-      if (fulltime < stop) {
-        // b1) Copy the event into another
-        const T eventCopy(*itev);
-        EventList *myOutput = outputs[index];
-        // Add the copy to the output
-        myOutput->addEventQuickly(eventCopy);
-        ++itev;
-      } else {
+        fulltime = itstop->m_pulsetime.totalNanoseconds() +
+                   static_cast<int64_t>(itstop->m_tof * 1000);
+      if (fulltime >= stop)
         break;
-      }
+      ++itstop;
     }
+    // b1) Copy the events into the output of the interval
+    appendEvents(outputs[index], itstart, itstop);
+    itev = itstop;
 
     // Go to the next interval
     ++itspl;
@@ -4189,6 +4643,7 @@ void EventList::splitByFullTime(Kernel::TimeSplitterType &splitter,
                                 std::map<int, EventList *> outputs,
                                 bool docorrection, double toffactor,
                                 double tofshift) const {
+  this->decodeEvents();
   if (eventType == WEIGHTED_NOTIME)
     throw std::runtime_error("EventList::splitByTime() called on an EventList "
                              "that no longer has time information.");
@@ -4420,6 +4875,7 @@ std::string EventList::splitByFullTimeMatrixSplitter(
     const std::vector<int> &vecgroups,
     std::map<int, EventList *> vec_outputEventList, bool docorrection,
     double toffactor, double tofshift) const {
+  this->decodeEvents();
   // Check validity
   if (eventType == WEIGHTED_NOTIME)
     throw std::runtime_error("EventList::splitByTime() called on an EventList "
@@ -4509,36 +4965,15 @@ void EventList::splitByPulseTimeHelper(Kernel::TimeSplitterType &splitter,
     stop = itspl->stop().totalNanoseconds();
     const int index = itspl->index();
 
-    // Skip the events before the start of the time and put to 'unfiltered'
-    // EventList
-    EventList *myOutput = outputs[-1];
-    while (itev != itev_end) {
-      if (itev->m_pulsetime < start) {
-        // Record to index = -1 space
-        const T eventCopy(*itev);
-        myOutput->addEventQuickly(eventCopy);
-        ++itev;
-      } else {
-        // Event within a splitter interval
-        break;
-      }
-    }
-
-    // Go through all the events that are in the interval (if any)
-    while (itev != itev_end) {
+    // The events are sorted by pulse time: find the interval by binary search
+    auto itstart = lowerBoundPulseTime(itev, itev_end, DateAndTime(start));
+    auto itstop = lowerBoundPulseTime(itstart, itev_end, DateAndTime(stop));
 
-      if (itev->m_pulsetime < stop) {
-        // Duplicate event
-        const T eventCopy(*itev);
-        EventList *myOutput = outputs[index];
-        // Add the copy to the output
-        myOutput->addEventQuickly(eventCopy);
-        ++itev;
-      } else {
-        // Out of interval
-        break;
-      }
-    }
+    // Put the events before the start of the time to 'unfiltered' EventList
+    appendEvents(outputs[-1], itev, itstart);
+    // Copy the events that are in the interval (if any)
+    appendEvents(outputs[index], itstart, itstop);
+    itev = itstop;
 
     // Go to the next interval
     ++itspl;
@@ -4557,6 +4992,7 @@ void EventList::splitByPulseTimeHelper(Kernel::TimeSplitterType &splitter,
  */
 void EventList::splitByPulseTime(Kernel::TimeSplitterType &splitter,
                                  std::map<int, EventList *> outputs) const {
+  this->decodeEvents();
   // Check for supported event type
   if (eventType == WEIGHTED_NOTIME)
     throw std::runtime_error("EventList::splitByTime() called on an EventList "
@@ -4602,6 +5038,7 @@ void EventList::splitByPulseTime(Kernel::TimeSplitterType &splitter,
 void EventList::splitByPulseTimeWithMatrix(
     const std::vector<int64_t> &vec_times, const std::vector<int> &vec_target,
     std::map<int, EventList *> outputs) const {
+  this->decodeEvents();
   // Check for supported event type
   if (eventType == WEIGHTED_NOTIME)
     throw std::runtime_error("EventList::splitByTime() called on an EventList "
@@ -4663,36 +5100,15 @@ void EventList::splitByPulseTimeWithMatrixHelper(
     int64_t stop = vec_split_times[i_target + 1];
     const int index = vec_split_target[i_target];
 
-    // Skip the events before the start of the time and put to 'unfiltered'
-    // EventList
-    EventList *myOutput = outputs[-1];
-    while (itev != itev_end) {
-      if (itev->m_pulsetime < start) {
-        // Record to index = -1 space
-        const T eventCopy(*itev);
-        myOutput->addEventQuickly(eventCopy);
-        ++itev;
-      } else {
-        // Event within a splitter interval
-        break;
-      }
-    }
+    // The events are sorted by pulse time: find the interval by binary search
+    auto itstart = lowerBoundPulseTime(itev, itev_end, DateAndTime(start));
+    auto itstop = lowerBoundPulseTime(itstart, itev_end, DateAndTime(stop));
 
-    // Go through all the events that are in the interval (if any)
-    while (itev != itev_end) {
-
-      if (itev->m_pulsetime < stop) {
-        // Duplicate event
-        const T eventCopy(*itev);
-        EventList *myOutput = outputs[index];
-        // Add the copy to the output
-        myOutput->addEventQuickly(eventCopy);
-        ++itev;
-      } else {
-        // Out of interval
-        break;
-      }
-    }
+    // Put the events before the start of the time to 'unfiltered' EventList
+    appendEvents(outputs[-1], itev, itstart);
+    // Copy the events that are in the interval (if any)
+    appendEvents(outputs[index], itstart, itstop);
+    itev = itstop;
 
     // No need to keep looping through the filter if we are out of events
     if (itev == itev_end)
@@ -4796,6 +5212,16 @@ void EventList::convertUnitsViaTof(Mantid::Kernel::Unit *fromUnit,
     throw std::runtime_error(
         "EventList::convertUnitsViaTof(): toUnit is not initialized!");
 
+  if (m_compressed)
+    this->unpackEvents();
+  if (m_columns) {
+    this->clearUnused();
+    m_columns->convertTof([fromUnit, toUnit](double x) {
+      return toUnit->singleFromTOF(fromUnit->singleToTOF(x));
+    });
+    return;
+  }
+
   switch (eventType) {
   case TOF:
     convertUnitsViaTofHelper(this->events, fromUnit, toUnit);
@@ -4833,6 +5259,13 @@ void EventList::convertUnitsQuicklyHelper(typename std::vector<T> &events,
  *  @param power :: the Power b to apply to the conversion
  */
 void EventList::convertUnitsQuickly(const double &factor, const double &power) {
+  if (m_compressed)
+    this->unpackEvents();
+  if (m_columns) {
+    this->clearUnused();
+    m_columns->convertUnitsQuickly(factor, power);
+    return;
+  }
   switch (eventType) {
   case TOF:
     convertUnitsQuicklyHelper(this->events, factor, power);
@@ -16,9 +16,11 @@
 #include "MantidKernel/FunctionTask.h"
 #include "MantidKernel/IPropertyManager.h"
 #include "MantidKernel/MultiThreaded.h"
+#include "MantidKernel/TaskRuntime.h"
 #include "MantidKernel/TimeSeriesProperty.h"
 
 #include "tbb/parallel_for.h"
+#include <algorithm>
 #include <limits>
 #include <numeric>
 
@@ -425,6 +427,20 @@ void EventWorkspace::switchEventType(const Mantid::API::EventType type) {
     eventList->switchTo(type);
 }
 
+/** Switch all event lists to the given storage layout. Column storage
+ * reduces the memory traffic of histogramming and unit conversion on large
+ * workspaces, compressed storage the memory held by workspaces that are kept
+ * for a long time; see EventList::setStorageType.
+ *
+ * @param type :: EventStorageType to switch to
+ */
+void EventWorkspace::setEventStorageType(const EventStorageType type) {
+  const int64_t numHistograms = static_cast<int64_t>(data.size());
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < numHistograms; ++i)
+    data[i]->setStorageType(type);
+}
+
 /// Returns true always - an EventWorkspace always represents histogramm-able
 /// data
 /// @returns If the data is a histogram - always true for an eventWorkspace
@@ -580,22 +596,24 @@ void EventWorkspace::setAllX(const HistogramData::BinEdges &x) {
   this->clearMRU();
 }
 
-/** Task for sorting an event list */
+/** Task for sorting batches of event lists */
 class EventSortingTask {
 public:
   /// ctor
   EventSortingTask(const EventWorkspace *WS, EventSortType sortType,
+                   const std::vector<std::vector<size_t>> &batches,
                    Mantid::API::Progress *prog)
-      : m_sortType(sortType), m_WS(WS), prog(prog) {}
+      : m_sortType(sortType), m_WS(WS), m_batches(batches), prog(prog) {}
 
   // Execute the sort as specified.
   void operator()(const tbb::blocked_range<size_t> &range) const {
-    for (size_t wi = range.begin(); wi < range.end(); ++wi) {
-      m_WS->getSpectrum(wi).sort(m_sortType);
+    for (size_t batch = range.begin(); batch < range.end(); ++batch) {
+      for (const auto wi : m_batches[batch])
+        m_WS->getSpectrum(wi).sort(m_sortType);
+      // Report progress
+      if (prog)
+        prog->reportIncrement(m_batches[batch].size(), "Sorting");
     }
-    // Report progress
-    if (prog)
-      prog->report("Sorting");
   }
 
 private:
@@ -603,10 +621,53 @@ private:
   EventSortType m_sortType;
   /// EventWorkspace on which to sort
   const EventWorkspace *m_WS;
+  /// Workspace indices sorted by each task
+  const std::vector<std::vector<size_t>> &m_batches;
   /// Optional Progress dialog.
   Mantid::API::Progress *prog;
 };
 
+namespace {
+/// Event lists shorter than this are sorted together with other lists
+const size_t SORT_BATCH_EVENTS = 65536;
+
+/** Group the event lists into sorting tasks, longest lists first. A list
+ * with at least SORT_BATCH_EVENTS events gets a task of its own. Shorter
+ * lists are packed together until a task holds about SORT_BATCH_EVENTS
+ * events, so that thousands of small pixels do not each pay for a task.
+ * @param data :: the event lists of the workspace
+ * @param sortType :: the requested order; lists already in it cost nothing
+ * @return the workspace indices sorted by each task
+ */
+std::vector<std::vector<size_t>>
+makeSortBatches(const std::vector<EventList *> &data,
+                const EventSortType sortType) {
+  std::vector<size_t> numEvents(data.size(), 0);
+  for (size_t i = 0; i < data.size(); ++i) {
+    if (data[i]->getSortType() != sortType)
+      numEvents[i] = data[i]->getNumberEvents();
+  }
+  std::vector<size_t> indices(data.size());
+  std::iota(indices.begin(), indices.end(), size_t{0});
+  std::stable_sort(indices.begin(), indices.end(),
+                   [&numEvents](const size_t lhs, const size_t rhs) {
+                     return numEvents[lhs] > numEvents[rhs];
+                   });
+
+  std::vector<std::vector<size_t>> batches;
+  size_t batchEvents = SORT_BATCH_EVENTS;
+  for (const auto index : indices) {
+    if (batchEvents >= SORT_BATCH_EVENTS) {
+      batches.emplace_back();
+      batchEvents = 0;
+    }
+    batches.back().push_back(index);
+    batchEvents += numEvents[index];
+  }
+  return batches;
+}
+} // namespace
+
 /*
  * Review each event list to get the sort type
  * If any 2 have different order type, then be unsorted
@@ -635,9 +696,14 @@ void EventWorkspace::sortAll(EventSortType sortType,
     return;
   }
 
-  // Create the thread pool, and optimize by doing the longest sorts first.
-  EventSortingTask task(this, sortType, prog);
-  tbb::parallel_for(tbb::blocked_range<size_t>(0, data.size()), task);
+  // Bucket the lists by size so the longest sorts start first and the short
+  // ones are batched together.
+  const auto batches = makeSortBatches(this->data, sortType);
+  EventSortingTask task(this, sortType, batches, prog);
+  Kernel::TaskRuntime::execute([&batches, &task]() {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, batches.size(), 1), task,
+                      tbb::simple_partitioner());
+  });
 }
 
 /** Integrate all the spectra in the matrix workspace within the range given.
@@ -1,5 +1,6 @@
 #include "MantidDataObjects/MDBoxFlatTree.h"
 #include "MantidDataObjects/MDEventFactory.h"
+#include "MantidDataObjects/MortonCurve.h"
 #include "MantidAPI/BoxController.h"
 #include "MantidAPI/FileBackedExperimentInfo.h"
 #include "MantidAPI/WorkspaceHistory.h"
@@ -17,7 +18,7 @@ namespace {
 Kernel::Logger g_log("MDBoxFlatTree");
 }
 
-MDBoxFlatTree::MDBoxFlatTree() : m_nDim(-1) {}
+MDBoxFlatTree::MDBoxFlatTree() : m_nDim(-1), m_curveOrder(false) {}
 
 /**The method initiates the MDBoxFlatTree class internal structure in the form
  *ready for saving this structure to HDD
@@ -30,6 +31,7 @@ MDBoxFlatTree::MDBoxFlatTree() : m_nDim(-1) {}
 void MDBoxFlatTree::initFlatStructure(API::IMDEventWorkspace_sptr pws,
                                       const std::string &fileName) {
   m_bcXMLDescr = pws->getBoxController()->toXMLString();
+  m_curveOrder = pws->getBoxController()->useSpaceFillingCurve();
   m_FileName = fileName;
 
   m_nDim = int(pws->getNumDims());
@@ -118,14 +120,59 @@ void MDBoxFlatTree::initFlatStructure(API::IMDEventWorkspace_sptr pws,
   // file position have to be calculated afresh
   if (!filePositionDefined) {
     uint64_t boxPosition(0);
-    for (size_t i = 0; i < maxBoxes; i++) {
-      if (m_BoxType[i] == 1) {
-        m_BoxEventIndex[2 * i] = boxPosition;
-        boxPosition += m_BoxEventIndex[2 * i + 1];
-      }
+    for (auto i : getLeafBoxesFileOrder()) {
+      m_BoxEventIndex[2 * i] = boxPosition;
+      boxPosition += m_BoxEventIndex[2 * i + 1];
     }
   }
 }
+
+/** @return the IDs of the boxes which hold events, in the order their data
+ * are laid out in file: the order of the IDs, or, if the box controller uses a
+ * space-filling curve, a depth-first walk through the tree which visits the
+ * children of each grid box along a Morton curve through it.
+ */
+std::vector<size_t> MDBoxFlatTree::getLeafBoxesFileOrder() const {
+  std::vector<size_t> order;
+  order.reserve(m_Boxes.size());
+  if (m_curveOrder && !m_Boxes.empty()) {
+    addLeafBoxesAlongCurve(m_Boxes[0], order);
+  } else {
+    for (size_t i = 0; i < m_BoxType.size(); i++) {
+      if (m_BoxType[i] == 1)
+        order.push_back(i);
+    }
+  }
+  return order;
+}
+
+/** Append the IDs of the boxes holding events below a box, in curve order
+ * @param box :: the box to start from
+ * @param order :: the list of IDs to append to
+ */
+void MDBoxFlatTree::addLeafBoxesAlongCurve(API::IMDNode *box,
+                                           std::vector<size_t> &order) const {
+  const size_t numChildren = box->getNumChildren();
+  if (numChildren == 0) {
+    order.push_back(box->getID());
+    return;
+  }
+  const size_t nd = static_cast<size_t>(m_nDim);
+  std::vector<coord_t> min(nd), max(nd), center(nd);
+  for (size_t d = 0; d < nd; d++) {
+    min[d] = box->getExtents(d).getMin();
+    max[d] = box->getExtents(d).getMax();
+  }
+  const MortonCurve curve(nd, min.data(), max.data());
+  std::vector<std::pair<uint64_t, size_t>> children(numChildren);
+  for (size_t i = 0; i < numChildren; i++) {
+    box->getChild(i)->getCenter(center.data());
+    children[i] = std::make_pair(curve.key(center.data()), i);
+  }
+  std::sort(children.begin(), children.end());
+  for (const auto &child : children)
+    addLeafBoxesAlongCurve(box->getChild(child.second), order);
+}
 /*** this function tries to set file positions of the boxes to
      make data physically located close to each other to be as close as possible
    on the HDD
@@ -141,13 +188,8 @@ void MDBoxFlatTree::setBoxesFilePositions(bool setFileBacked) {
   // Kernel::ISaveable::sortObjByFilePos(m_Boxes);
   // calculate the box positions in the resulting file and save it on place
   uint64_t eventsStart = 0;
-  for (auto mdBox : m_Boxes) {
-    size_t ID = mdBox->getID();
-
-    // avoid grid boxes;
-    if (m_BoxType[ID] == 2)
-      continue;
-
+  for (auto ID : getLeafBoxesFileOrder()) {
+    API::IMDNode *mdBox = m_Boxes[ID];
     size_t nEvents = mdBox->getTotalDataSize();
     m_BoxEventIndex[ID * 2] = eventsStart;
     m_BoxEventIndex[ID * 2 + 1] = nEvents;
@@ -1,5 +1,6 @@
 #include "MantidGeometry/MDGeometry/IMDDimension.h"
 #include "MantidGeometry/MDGeometry/MDGeometryXMLBuilder.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/System.h"
 #include "MantidKernel/Utils.h"
 #include "MantidKernel/VMD.h"
@@ -15,12 +16,38 @@
 #include <boost/scoped_array.hpp>
 #include <boost/make_shared.hpp>
 #include <boost/optional.hpp>
+#include <algorithm>
 #include <cmath>
 
 using namespace Mantid::Kernel;
 using namespace Mantid::Geometry;
 using namespace Mantid::API;
 
+namespace {
+/// Number of bins given to a thread at a time by forEachBin()
+const size_t BINS_PER_BLOCK = 8192;
+
+/** Apply an element-wise operation to every bin of a workspace. The bins are
+ * split into contiguous blocks which are processed in parallel. The loop over
+ * the bins of a block is kept simple so that the compiler can vectorize it
+ * once the operation is inlined.
+ *
+ * @param length :: the number of bins
+ * @param binOp :: callable applied to the index of every bin
+ */
+template <typename BinOp> void forEachBin(size_t length, const BinOp &binOp) {
+  const auto nBlocks =
+      static_cast<int64_t>((length + BINS_PER_BLOCK - 1) / BINS_PER_BLOCK);
+  PARALLEL_FOR_IF(nBlocks > 1)
+  for (int64_t block = 0; block < nBlocks; ++block) {
+    const size_t begin = static_cast<size_t>(block) * BINS_PER_BLOCK;
+    const size_t end = std::min(length, begin + BINS_PER_BLOCK);
+    for (size_t i = begin; i < end; ++i)
+      binOp(i);
+  }
+}
+} // namespace
+
 namespace Mantid {
 namespace DataObjects {
 //----------------------------------------------------------------------------------------------
@@ -771,11 +798,11 @@ MDHistoWorkspace &MDHistoWorkspace::operator+=(const MDHistoWorkspace &b) {
  * */
 void MDHistoWorkspace::add(const MDHistoWorkspace &b) {
   checkWorkspaceSize(b, "add");
-  for (size_t i = 0; i < m_length; ++i) {
+  forEachBin(m_length, [&](size_t i) {
     m_signals[i] += b.m_signals[i];
     m_errorsSquared[i] += b.m_errorsSquared[i];
     m_numEvents[i] += b.m_numEvents[i];
-  }
+  });
   m_nEventsContributed += b.m_nEventsContributed;
 }
 
@@ -787,10 +814,10 @@ void MDHistoWorkspace::add(const MDHistoWorkspace &b) {
  * */
 void MDHistoWorkspace::add(const signal_t signal, const signal_t error) {
   signal_t errorSquared = error * error;
-  for (size_t i = 0; i < m_length; ++i) {
+  forEachBin(m_length, [&](size_t i) {
     m_signals[i] += signal;
     m_errorsSquared[i] += errorSquared;
-  }
+  });
 }
 
 //----------------------------------------------------------------------------------------------
@@ -810,11 +837,11 @@ MDHistoWorkspace &MDHistoWorkspace::operator-=(const MDHistoWorkspace &b) {
  * */
 void MDHistoWorkspace::subtract(const MDHistoWorkspace &b) {
   checkWorkspaceSize(b, "subtract");
-  for (size_t i = 0; i < m_length; ++i) {
+  forEachBin(m_length, [&](size_t i) {
     m_signals[i] -= b.m_signals[i];
     m_errorsSquared[i] += b.m_errorsSquared[i];
     m_numEvents[i] += b.m_numEvents[i];
-  }
+  });
   m_nEventsContributed += b.m_nEventsContributed;
 }
 
@@ -826,10 +853,10 @@ void MDHistoWorkspace::subtract(const MDHistoWorkspace &b) {
  * */
 void MDHistoWorkspace::subtract(const signal_t signal, const signal_t error) {
   signal_t errorSquared = error * error;
-  for (size_t i = 0; i < m_length; ++i) {
+  forEachBin(m_length, [&](size_t i) {
     m_signals[i] -= signal;
     m_errorsSquared[i] += errorSquared;
-  }
+  });
 }
 
 //----------------------------------------------------------------------------------------------
@@ -858,7 +885,7 @@ MDHistoWorkspace &MDHistoWorkspace::operator*=(const MDHistoWorkspace &b_ws) {
  * */
 void MDHistoWorkspace::multiply(const MDHistoWorkspace &b_ws) {
   checkWorkspaceSize(b_ws, "multiply");
-  for (size_t i = 0; i < m_length; ++i) {
+  forEachBin(m_length, [&](size_t i) {
     signal_t a = m_signals[i];
     signal_t da2 = m_errorsSquared[i];
 
@@ -870,7 +897,7 @@ void MDHistoWorkspace::multiply(const MDHistoWorkspace &b_ws) {
 
     m_signals[i] = f;
     m_errorsSquared[i] = df2;
-  }
+  });
 }
 
 //----------------------------------------------------------------------------------------------
@@ -889,7 +916,7 @@ void MDHistoWorkspace::multiply(const signal_t signal, const signal_t error) {
   signal_t b = signal;
   signal_t db2 = error * error;
 
-  for (size_t i = 0; i < m_length; ++i) {
+  forEachBin(m_length, [&](size_t i) {
     signal_t a = m_signals[i];
     signal_t da2 = m_errorsSquared[i];
 
@@ -898,7 +925,7 @@ void MDHistoWorkspace::multiply(const signal_t signal, const signal_t error) {
 
     m_signals[i] = f;
     m_errorsSquared[i] = df2;
-  }
+  });
 }
 
 //----------------------------------------------------------------------------------------------
@@ -927,7 +954,7 @@ MDHistoWorkspace &MDHistoWorkspace::operator/=(const MDHistoWorkspace &b_ws) {
  **/
 void MDHistoWorkspace::divide(const MDHistoWorkspace &b_ws) {
   checkWorkspaceSize(b_ws, "divide");
-  for (size_t i = 0; i < m_length; ++i) {
+  forEachBin(m_length, [&](size_t i) {
     signal_t a = m_signals[i];
     signal_t da2 = m_errorsSquared[i];
 
@@ -939,7 +966,7 @@ void MDHistoWorkspace::divide(const MDHistoWorkspace &b_ws) {
 
     m_signals[i] = f;
     m_errorsSquared[i] = df2;
-  }
+  });
 }
 
 //----------------------------------------------------------------------------------------------
@@ -958,7 +985,7 @@ void MDHistoWorkspace::divide(const signal_t signal, const signal_t error) {
   signal_t b = signal;
   signal_t db2 = error * error;
   signal_t db2_relative = db2 / (b * b);
-  for (size_t i = 0; i < m_length; ++i) {
+  forEachBin(m_length, [&](size_t i) {
     signal_t a = m_signals[i];
     signal_t da2 = m_errorsSquared[i];
 
@@ -967,7 +994,61 @@ void MDHistoWorkspace::divide(const signal_t signal, const signal_t error) {
 
     m_signals[i] = f;
     m_errorsSquared[i] = df2;
-  }
+  });
+}
+
+//----------------------------------------------------------------------------------------------
+/** Perform a = a * b + c, element-by-element, in a single pass over the bins.
+ * This gives the same result as multiply(b) followed by add(c), without
+ * going over the workspace twice.
+ *
+ * Error propagation of \f$ f = a * b + c \f$  is given by:
+ * \f$ df^2 = b^2 da^2 + a^2 * db^2 + dc^2 \f$
+ *
+ * @param b_ws :: workspace to multiply by
+ * @param c_ws :: workspace to add to the product
+ **/
+void MDHistoWorkspace::multiplyAdd(const MDHistoWorkspace &b_ws,
+                                   const MDHistoWorkspace &c_ws) {
+  checkWorkspaceSize(b_ws, "multiplyAdd");
+  checkWorkspaceSize(c_ws, "multiplyAdd");
+  forEachBin(m_length, [&](size_t i) {
+    signal_t a = m_signals[i];
+    signal_t da2 = m_errorsSquared[i];
+
+    signal_t b = b_ws.m_signals[i];
+    signal_t db2 = b_ws.m_errorsSquared[i];
+
+    m_signals[i] = a * b + c_ws.m_signals[i];
+    m_errorsSquared[i] = da2 * b * b + db2 * a * a + c_ws.m_errorsSquared[i];
+    m_numEvents[i] += c_ws.m_numEvents[i];
+  });
+  m_nEventsContributed += c_ws.m_nEventsContributed;
+}
+
+//----------------------------------------------------------------------------------------------
+/** Perform a = a * signal + c, element-by-element, in a single pass over the
+ * bins. This gives the same result as multiply(signal, error) followed by
+ * add(c).
+ *
+ * @param signal :: scalar to multiply by
+ * @param error :: error (not squared) of the scalar
+ * @param c_ws :: workspace to add to the product
+ **/
+void MDHistoWorkspace::multiplyAdd(const signal_t signal, const signal_t error,
+                                   const MDHistoWorkspace &c_ws) {
+  checkWorkspaceSize(c_ws, "multiplyAdd");
+  signal_t b = signal;
+  signal_t db2 = error * error;
+  forEachBin(m_length, [&](size_t i) {
+    signal_t a = m_signals[i];
+    signal_t da2 = m_errorsSquared[i];
+
+    m_signals[i] = a * b + c_ws.m_signals[i];
+    m_errorsSquared[i] = da2 * b * b + db2 * a * a + c_ws.m_errorsSquared[i];
+    m_numEvents[i] += c_ws.m_numEvents[i];
+  });
+  m_nEventsContributed += c_ws.m_nEventsContributed;
 }
 
 //----------------------------------------------------------------------------------------------
@@ -977,7 +1058,7 @@ void MDHistoWorkspace::divide(const signal_t signal, const signal_t error) {
  * \f$ df^2 = a^2 / da^2 \f$
  */
 void MDHistoWorkspace::log(double filler) {
-  for (size_t i = 0; i < m_length; ++i) {
+  forEachBin(m_length, [&](size_t i) {
     signal_t a = m_signals[i];
     signal_t da2 = m_errorsSquared[i];
     if (a <= 0) {
@@ -987,7 +1068,7 @@ void MDHistoWorkspace::log(double filler) {
       m_signals[i] = std::log(a);
       m_errorsSquared[i] = da2 / (a * a);
     }
-  }
+  });
 }
 
 //----------------------------------------------------------------------------------------------
@@ -997,7 +1078,7 @@ void MDHistoWorkspace::log(double filler) {
  * \f$ df^2 = (ln(10)^-2) * a^2 / da^2 \f$
  */
 void MDHistoWorkspace::log10(double filler) {
-  for (size_t i = 0; i < m_length; ++i) {
+  forEachBin(m_length, [&](size_t i) {
     signal_t a = m_signals[i];
     signal_t da2 = m_errorsSquared[i];
     if (a <= 0) {
@@ -1007,7 +1088,7 @@ void MDHistoWorkspace::log10(double filler) {
       m_signals[i] = std::log10(a);
       m_errorsSquared[i] = 0.1886117 * da2 / (a * a); // 0.1886117  = ln(10)^-2
     }
-  }
+  });
 }
 
 //----------------------------------------------------------------------------------------------
@@ -1017,12 +1098,12 @@ void MDHistoWorkspace::log10(double filler) {
  * \f$ df^2 = f^2 * da^2 \f$
  */
 void MDHistoWorkspace::exp() {
-  for (size_t i = 0; i < m_length; ++i) {
+  forEachBin(m_length, [&](size_t i) {
     signal_t f = std::exp(m_signals[i]);
     signal_t da2 = m_errorsSquared[i];
     m_signals[i] = f;
     m_errorsSquared[i] = f * f * da2;
-  }
+  });
 }
 
 //----------------------------------------------------------------------------------------------
@@ -1034,13 +1115,13 @@ void MDHistoWorkspace::exp() {
  */
 void MDHistoWorkspace::power(double exponent) {
   double exponent_squared = exponent * exponent;
-  for (size_t i = 0; i < m_length; ++i) {
+  forEachBin(m_length, [&](size_t i) {
     signal_t a = m_signals[i];
     signal_t f = std::pow(a, exponent);
     signal_t da2 = m_errorsSquared[i];
     m_signals[i] = f;
     m_errorsSquared[i] = f * f * exponent_squared * da2 / (a * a);
-  }
+  });
 }
 
 //==============================================================================================
@@ -1058,13 +1139,13 @@ void MDHistoWorkspace::power(double exponent) {
  * @return *this after operation */
 MDHistoWorkspace &MDHistoWorkspace::operator&=(const MDHistoWorkspace &b) {
   checkWorkspaceSize(b, "&= (and)");
-  for (size_t i = 0; i < m_length; ++i) {
+  forEachBin(m_length, [&](size_t i) {
     m_signals[i] = ((m_signals[i] != 0 && !m_masks[i]) &&
                     (b.m_signals[i] != 0 && !b.m_masks[i]))
                        ? 1.0
                        : 0.0;
     m_errorsSquared[i] = 0;
-  }
+  });
   return *this;
 }
 
@@ -1077,13 +1158,13 @@ MDHistoWorkspace &MDHistoWorkspace::operator&=(const MDHistoWorkspace &b) {
  * @return *this after operation */
 MDHistoWorkspace &MDHistoWorkspace::operator|=(const MDHistoWorkspace &b) {
   checkWorkspaceSize(b, "|= (or)");
-  for (size_t i = 0; i < m_length; ++i) {
+  forEachBin(m_length, [&](size_t i) {
     m_signals[i] = ((m_signals[i] != 0 && !m_masks[i]) ||
                     (b.m_signals[i] != 0 && !b.m_masks[i]))
                        ? 1.0
                        : 0.0;
     m_errorsSquared[i] = 0;
-  }
+  });
   return *this;
 }
 
@@ -1097,13 +1178,13 @@ MDHistoWorkspace &MDHistoWorkspace::operator|=(const MDHistoWorkspace &b) {
  * @return *this after operation */
 MDHistoWorkspace &MDHistoWorkspace::operator^=(const MDHistoWorkspace &b) {
   checkWorkspaceSize(b, "^= (xor)");
-  for (size_t i = 0; i < m_length; ++i) {
+  forEachBin(m_length, [&](size_t i) {
     m_signals[i] = ((m_signals[i] != 0 && !m_masks[i]) ^
                     (b.m_signals[i] != 0 && !b.m_masks[i]))
                        ? 1.0
                        : 0.0;
     m_errorsSquared[i] = 0;
-  }
+  });
   return *this;
 }
 
@@ -1114,10 +1195,10 @@ MDHistoWorkspace &MDHistoWorkspace::operator^=(const MDHistoWorkspace &b) {
  * 0.0 is "false", all other values are "true". All errors are set to 0.
  */
 void MDHistoWorkspace::operatorNot() {
-  for (size_t i = 0; i < m_length; ++i) {
+  forEachBin(m_length, [&](size_t i) {
     m_signals[i] = (m_signals[i] == 0.0 || m_masks[i]);
     m_errorsSquared[i] = 0;
-  }
+  });
 }
 
 //----------------------------------------------------------------------------------------------
@@ -1130,10 +1211,10 @@ void MDHistoWorkspace::operatorNot() {
  */
 void MDHistoWorkspace::lessThan(const MDHistoWorkspace &b) {
   checkWorkspaceSize(b, "lessThan");
-  for (size_t i = 0; i < m_length; ++i) {
+  forEachBin(m_length, [&](size_t i) {
     m_signals[i] = (m_signals[i] < b.m_signals[i]) ? 1.0 : 0.0;
     m_errorsSquared[i] = 0;
-  }
+  });
 }
 
 //----------------------------------------------------------------------------------------------
@@ -1145,10 +1226,10 @@ void MDHistoWorkspace::lessThan(const MDHistoWorkspace &b) {
  * @param signal :: signal value on the RHS of the comparison.
  */
 void MDHistoWorkspace::lessThan(const signal_t signal) {
-  for (size_t i = 0; i < m_length; ++i) {
+  forEachBin(m_length, [&](size_t i) {
     m_signals[i] = (m_signals[i] < signal) ? 1.0 : 0.0;
     m_errorsSquared[i] = 0;
-  }
+  });
 }
 
 //----------------------------------------------------------------------------------------------
@@ -1161,10 +1242,10 @@ void MDHistoWorkspace::lessThan(const signal_t signal) {
  */
 void MDHistoWorkspace::greaterThan(const MDHistoWorkspace &b) {
   checkWorkspaceSize(b, "greaterThan");
-  for (size_t i = 0; i < m_length; ++i) {
+  forEachBin(m_length, [&](size_t i) {
     m_signals[i] = (m_signals[i] > b.m_signals[i]) ? 1.0 : 0.0;
     m_errorsSquared[i] = 0;
-  }
+  });
 }
 
 //----------------------------------------------------------------------------------------------
@@ -1176,10 +1257,10 @@ void MDHistoWorkspace::greaterThan(const MDHistoWorkspace &b) {
  * @param signal :: signal value on the RHS of the comparison.
  */
 void MDHistoWorkspace::greaterThan(const signal_t signal) {
-  for (size_t i = 0; i < m_length; ++i) {
+  forEachBin(m_length, [&](size_t i) {
     m_signals[i] = (m_signals[i] > signal) ? 1.0 : 0.0;
     m_errorsSquared[i] = 0;
-  }
+  });
 }
 
 //----------------------------------------------------------------------------------------------
@@ -1194,11 +1275,11 @@ void MDHistoWorkspace::greaterThan(const signal_t signal) {
 void MDHistoWorkspace::equalTo(const MDHistoWorkspace &b,
                                const signal_t tolerance) {
   checkWorkspaceSize(b, "equalTo");
-  for (size_t i = 0; i < m_length; ++i) {
+  forEachBin(m_length, [&](size_t i) {
     signal_t diff = fabs(m_signals[i] - b.m_signals[i]);
     m_signals[i] = (diff < tolerance) ? 1.0 : 0.0;
     m_errorsSquared[i] = 0;
-  }
+  });
 }
 
 //----------------------------------------------------------------------------------------------
@@ -1212,11 +1293,11 @@ void MDHistoWorkspace::equalTo(const MDHistoWorkspace &b,
  */
 void MDHistoWorkspace::equalTo(const signal_t signal,
                                const signal_t tolerance) {
-  for (size_t i = 0; i < m_length; ++i) {
+  forEachBin(m_length, [&](size_t i) {
     signal_t diff = fabs(m_signals[i] - signal);
     m_signals[i] = (diff < tolerance) ? 1.0 : 0.0;
     m_errorsSquared[i] = 0;
-  }
+  });
 }
 
 //----------------------------------------------------------------------------------------------
@@ -1239,12 +1320,12 @@ void MDHistoWorkspace::setUsingMask(const MDHistoWorkspace &mask,
                                     const MDHistoWorkspace &values) {
   checkWorkspaceSize(mask, "setUsingMask");
   checkWorkspaceSize(values, "setUsingMask");
-  for (size_t i = 0; i < m_length; ++i) {
+  forEachBin(m_length, [&](size_t i) {
     if (mask.m_signals[i] != 0.0) {
       m_signals[i] = values.m_signals[i];
       m_errorsSquared[i] = values.m_errorsSquared[i];
     }
-  }
+  });
 }
 
 //----------------------------------------------------------------------------------------------
@@ -1269,12 +1350,12 @@ void MDHistoWorkspace::setUsingMask(const MDHistoWorkspace &mask,
                                     const signal_t error) {
   signal_t errorSquared = error * error;
   checkWorkspaceSize(mask, "setUsingMask");
-  for (size_t i = 0; i < m_length; ++i) {
+  forEachBin(m_length, [&](size_t i) {
     if (mask.m_signals[i] != 0.0) {
       m_signals[i] = signal;
       m_errorsSquared[i] = errorSquared;
     }
-  }
+  });
 }
 
 /**
@@ -0,0 +1,216 @@
+#ifndef MANTID_DATAOBJECTS_ASYNCBLOCKIOTEST_H_
+#define MANTID_DATAOBJECTS_ASYNCBLOCKIOTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidDataObjects/AsyncBlockIO.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+using Mantid::DataObjects::AsyncBlockIO;
+
+class AsyncBlockIOTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static AsyncBlockIOTest *createSuite() { return new AsyncBlockIOTest(); }
+  static void destroySuite(AsyncBlockIOTest *suite) { delete suite; }
+
+  /// A file of rows of two floats held in memory. Writes can be held back.
+  class FakeFile {
+  public:
+    static const size_t nColumns = 2;
+
+    explicit FakeFile(size_t nPoints) : m_data(nPoints * nColumns) {
+      for (size_t i = 0; i < m_data.size(); ++i)
+        m_data[i] = static_cast<float>(i);
+    }
+
+    AsyncBlockIO::ReadFunction reader() {
+      return [this](AsyncBlockIO::Block &block) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const uint64_t nPoints = m_data.size() / nColumns;
+        if (block.end() > nPoints)
+          block.nPoints = block.position < nPoints ? nPoints - block.position
+                                                   : 0;
+        const auto first = m_data.begin() + block.position * nColumns;
+        block.floats.assign(first, first + block.nPoints * nColumns);
+      };
+    }
+
+    AsyncBlockIO::WriteFunction writer() {
+      return [this](const AsyncBlockIO::Block &block) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        ++m_writesStarted;
+        m_released.notify_all();
+        m_released.wait(lock, [this]() { return !m_holdWrites; });
+        if (m_failWrites)
+          throw std::runtime_error("Disk full");
+        std::copy(block.floats.begin(), block.floats.end(),
+                  m_data.begin() + block.position * nColumns);
+      };
+    }
+
+    void holdWrites(bool hold) {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_holdWrites = hold;
+      m_released.notify_all();
+    }
+
+    void waitForWriteToStart() {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_released.wait(lock, [this]() { return m_writesStarted > 0; });
+    }
+
+    void failWrites() {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_failWrites = true;
+    }
+
+    float at(size_t i) {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      return m_data[i];
+    }
+
+  private:
+    std::mutex m_mutex;
+    std::condition_variable m_released;
+    bool m_holdWrites{false};
+    int m_writesStarted{0};
+    bool m_failWrites{false};
+    std::vector<float> m_data;
+  };
+
+  void test_save_is_written_in_the_background() {
+    FakeFile file(100);
+    AsyncBlockIO io(FakeFile::nColumns, file.reader(), file.writer(), []() {});
+    file.holdWrites(true);
+    io.save(std::vector<float>{-1, -2, -3, -4}, 10);
+    // Not written yet, but loaded from the queued copy
+    TS_ASSERT_EQUALS(file.at(20), 20.f);
+    std::vector<float> data;
+    io.load(data, 10, 2);
+    TS_ASSERT_EQUALS(data, (std::vector<float>{-1, -2, -3, -4}));
+    io.load(data, 11, 1);
+    TS_ASSERT_EQUALS(data, (std::vector<float>{-3, -4}));
+    TS_ASSERT_EQUALS(io.numCachedLoads(), 2);
+
+    file.holdWrites(false);
+    io.flush();
+    TS_ASSERT_EQUALS(file.at(20), -1.f);
+    TS_ASSERT_EQUALS(file.at(23), -4.f);
+  }
+
+  void test_adjacent_blocks_are_written_together() {
+    FakeFile file(100);
+    AsyncBlockIO io(FakeFile::nColumns, file.reader(), file.writer(), []() {});
+    file.holdWrites(true);
+    io.save(std::vector<float>{-1, -1}, 0);
+    file.waitForWriteToStart();
+    // Saved out of order; written with one call once sorted
+    io.save(std::vector<float>{-6, -6}, 6);
+    io.save(std::vector<float>{-4, -4}, 4);
+    io.save(std::vector<float>{-5, -5}, 5);
+    file.holdWrites(false);
+    io.flush();
+    TS_ASSERT_EQUALS(io.numWrites(), 2);
+    TS_ASSERT_EQUALS(file.at(8), -4.f);
+    TS_ASSERT_EQUALS(file.at(10), -5.f);
+    TS_ASSERT_EQUALS(file.at(12), -6.f);
+  }
+
+  void test_blocks_saved_twice_keep_the_last_values() {
+    FakeFile file(100);
+    AsyncBlockIO io(FakeFile::nColumns, file.reader(), file.writer(), []() {});
+    file.holdWrites(true);
+    io.save(std::vector<float>{-1, -1, -2, -2}, 3);
+    io.save(std::vector<float>{-7, -7}, 3);
+    std::vector<float> data;
+    io.load(data, 3, 1);
+    TS_ASSERT_EQUALS(data, (std::vector<float>{-7, -7}));
+    file.holdWrites(false);
+    io.flush();
+    TS_ASSERT_EQUALS(file.at(6), -7.f);
+    TS_ASSERT_EQUALS(file.at(8), -2.f);
+  }
+
+  void test_sequential_loads_read_ahead() {
+    FakeFile file(1000);
+    AsyncBlockIO io(FakeFile::nColumns, file.reader(), file.writer(), []() {});
+    io.setBufferSizes(1024, 4096, 100);
+    std::vector<float> data;
+    io.load(data, 0, 10);
+    TS_ASSERT_EQUALS(io.numCachedLoads(), 0);
+    io.wait();
+    TS_ASSERT_EQUALS(io.numReads(), 1);
+    for (uint64_t position = 10; position < 100; position += 10) {
+      io.load(data, position, 10);
+      TS_ASSERT_EQUALS(data.size(), 20);
+      TS_ASSERT_EQUALS(data[0], static_cast<float>(2 * position));
+      io.wait();
+    }
+    TS_ASSERT_EQUALS(io.numCachedLoads(), 9);
+  }
+
+  void test_read_ahead_stops_at_the_end_of_the_file() {
+    FakeFile file(50);
+    AsyncBlockIO io(FakeFile::nColumns, file.reader(), file.writer(), []() {});
+    io.setBufferSizes(1024, 4096, 100);
+    std::vector<float> data;
+    io.load(data, 0, 10);
+    io.wait();
+    TS_ASSERT_EQUALS(io.numReads(), 1);
+    for (uint64_t position = 10; position < 50; position += 10) {
+      io.load(data, position, 10);
+      io.wait();
+    }
+    TS_ASSERT_EQUALS(io.numReads(), 1);
+    TS_ASSERT_EQUALS(io.numCachedLoads(), 4);
+  }
+
+  void test_requested_blocks_are_read_together() {
+    FakeFile file(100);
+    AsyncBlockIO io(FakeFile::nColumns, file.reader(), file.writer(), []() {});
+    io.setBufferSizes(1024, 1024, 0);
+    // Hold the background thread so that the requests queue up
+    file.holdWrites(true);
+    io.save(std::vector<float>{-1, -1}, 99);
+    io.readAhead(30, 10, false);
+    io.readAhead(10, 10, false);
+    io.readAhead(20, 10, false);
+    file.holdWrites(false);
+    io.wait();
+    TS_ASSERT_EQUALS(io.numReads(), 1);
+    std::vector<float> data;
+    io.load(data, 15, 20);
+    TS_ASSERT_EQUALS(data.front(), 30.f);
+    TS_ASSERT_EQUALS(data.back(), 69.f);
+    TS_ASSERT_EQUALS(io.numCachedLoads(), 1);
+  }
+
+  void test_save_drops_blocks_read_ahead() {
+    FakeFile file(100);
+    AsyncBlockIO io(FakeFile::nColumns, file.reader(), file.writer(), []() {});
+    io.readAhead(0, 50, false);
+    io.wait();
+    io.save(std::vector<float>{-1, -1}, 20);
+    io.flush();
+    std::vector<float> data;
+    io.load(data, 19, 2);
+    TS_ASSERT_EQUALS(data, (std::vector<float>{38, 39, -1, -1}));
+  }
+
+  void test_write_errors_are_passed_on() {
+    FakeFile file(100);
+    AsyncBlockIO io(FakeFile::nColumns, file.reader(), file.writer(), []() {});
+    file.failWrites();
+    TS_ASSERT_THROWS_NOTHING(io.save(std::vector<float>{-1, -1}, 0));
+    TS_ASSERT_THROWS(io.flush(), std::runtime_error);
+    TS_ASSERT_THROWS_NOTHING(io.stop());
+  }
+};
+
+#endif /* MANTID_DATAOBJECTS_ASYNCBLOCKIOTEST_H_ */
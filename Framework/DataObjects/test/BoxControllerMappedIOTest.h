@@ -0,0 +1,179 @@
+#ifndef MANTID_DATAOBJECTS_BOXCONTROLLERMAPPEDIOTEST_H_
+#define MANTID_DATAOBJECTS_BOXCONTROLLERMAPPEDIOTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidAPI/BoxController.h"
+#include "MantidDataObjects/BoxControllerMappedIO.h"
+#include "MantidKernel/ConfigService.h"
+#include "MantidKernel/Exception.h"
+#include "MantidKernel/MultiThreaded.h"
+
+#include <Poco/File.h>
+
+#include <memory>
+
+using Mantid::DataObjects::BoxControllerMappedIO;
+using Mantid::Kernel::Exception::FileError;
+
+class BoxControllerMappedIOTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static BoxControllerMappedIOTest *createSuite() {
+    return new BoxControllerMappedIOTest();
+  }
+  static void destroySuite(BoxControllerMappedIOTest *suite) { delete suite; }
+
+  BoxControllerMappedIOTest()
+      : m_bc(new Mantid::API::BoxController(4)),
+        m_fileName(
+            Mantid::Kernel::ConfigService::Instance().getTempDir() +
+            "/BoxControllerMappedIOTest.nxs") {}
+
+  void tearDown() override {
+    Poco::File eventFile(BoxControllerMappedIO::eventFileName(m_fileName));
+    if (eventFile.exists())
+      eventFile.remove();
+  }
+
+  void test_new_file_does_not_open_for_reading() {
+    BoxControllerMappedIO io(m_bc.get());
+    TS_ASSERT_THROWS(io.openFile(m_fileName, "r"), FileError);
+    TS_ASSERT(!io.isOpened());
+    TS_ASSERT(!BoxControllerMappedIO::hasEventFile(m_fileName));
+  }
+
+  void test_events_are_kept_next_to_the_nexus_file() {
+    BoxControllerMappedIO io(m_bc.get());
+    TS_ASSERT(io.openFile(m_fileName, "w"));
+    TS_ASSERT(io.isOpened());
+    TS_ASSERT_EQUALS(io.getFileName(), m_fileName);
+    TS_ASSERT_EQUALS(io.getEventFileName(), m_fileName + ".events");
+    TS_ASSERT_THROWS_NOTHING(io.closeFile());
+    TS_ASSERT(!io.isOpened());
+    TS_ASSERT(BoxControllerMappedIO::hasEventFile(m_fileName));
+  }
+
+  void test_write_read_float() { doTestWriteRead<float, float>(); }
+  void test_write_float_read_double() { doTestWriteRead<float, double>(); }
+  void test_write_double_read_float() { doTestWriteRead<double, float>(); }
+  void test_write_read_double() { doTestWriteRead<double, double>(); }
+
+  void test_file_grows_to_blocks_saved_beyond_its_end() {
+    BoxControllerMappedIO io(m_bc.get());
+    io.openFile(m_fileName, "w");
+    const auto block = makeBlock<float>(io, 3, 1);
+    TS_ASSERT_THROWS_NOTHING(io.saveBlock(block, 0));
+    TS_ASSERT_THROWS_NOTHING(io.saveBlock(block, 100000));
+    TS_ASSERT_EQUALS(io.getFileLength(), 100003);
+
+    std::vector<float> loaded;
+    TS_ASSERT_THROWS_NOTHING(io.loadBlock(loaded, 0, 3));
+    TS_ASSERT_EQUALS(loaded, block);
+    TS_ASSERT_THROWS_NOTHING(io.loadBlock(loaded, 100000, 3));
+    TS_ASSERT_EQUALS(loaded, block);
+    TS_ASSERT_THROWS(io.loadBlock(loaded, 100001, 3), FileError);
+  }
+
+  void test_blocks_are_loaded_in_parallel_while_the_file_grows() {
+    BoxControllerMappedIO io(m_bc.get());
+    io.openFile(m_fileName, "w");
+    const int nBlocks = 200;
+    const size_t nEvents = 500;
+    int nWrong = 0;
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int i = 0; i < nBlocks; ++i) {
+      const uint64_t position = static_cast<uint64_t>(i) * nEvents;
+      const auto block = makeBlock<float>(io, nEvents, position);
+      io.saveBlock(block, position);
+      std::vector<float> loaded;
+      io.loadBlock(loaded, position, nEvents);
+      if (loaded != block) {
+        PARALLEL_ATOMIC
+        ++nWrong;
+      }
+    }
+    TS_ASSERT_EQUALS(nWrong, 0);
+    TS_ASSERT_EQUALS(io.getFileLength(), nBlocks * nEvents);
+  }
+
+  void test_length_and_free_space_are_kept_when_reopened() {
+    std::vector<uint64_t> freeSpace{10, 5, 40, 20};
+    {
+      BoxControllerMappedIO io(m_bc.get());
+      io.openFile(m_fileName, "w");
+      io.saveBlock(makeBlock<float>(io, 100, 1), 0);
+      io.setFreeSpaceVector(freeSpace);
+      io.closeFile();
+    }
+    BoxControllerMappedIO io(m_bc.get());
+    TS_ASSERT_THROWS_NOTHING(io.openFile(m_fileName, "r"));
+    TS_ASSERT_EQUALS(io.getFileLength(), 100);
+    std::vector<uint64_t> readFreeSpace;
+    io.getFreeSpaceVector(readFreeSpace);
+    TS_ASSERT_EQUALS(readFreeSpace, freeSpace);
+  }
+
+  void test_file_opened_for_reading_is_not_written() {
+    {
+      BoxControllerMappedIO io(m_bc.get());
+      io.openFile(m_fileName, "w");
+    }
+    BoxControllerMappedIO io(m_bc.get());
+    io.openFile(m_fileName, "r");
+    TS_ASSERT_THROWS(io.saveBlock(makeBlock<float>(io, 1, 1), 0), FileError);
+  }
+
+  void test_events_of_another_type_do_not_open() {
+    {
+      BoxControllerMappedIO io(m_bc.get());
+      io.setDataType(4, "MDLeanEvent");
+      io.openFile(m_fileName, "w");
+    }
+    BoxControllerMappedIO io(m_bc.get());
+    io.setDataType(4, "MDEvent");
+    TS_ASSERT_THROWS(io.openFile(m_fileName, "r"), FileError);
+    TS_ASSERT(!io.isOpened());
+  }
+
+private:
+  template <typename Type>
+  std::vector<Type> makeBlock(const BoxControllerMappedIO &io, size_t nEvents,
+                              size_t first) {
+    std::vector<Type> block(nEvents * io.getNDataColums());
+    for (size_t i = 0; i < block.size(); ++i)
+      block[i] = static_cast<Type>(first + i) + static_cast<Type>(0.25);
+    return block;
+  }
+
+  template <typename FROM, typename TO> void doTestWriteRead() {
+    const auto block = [this]() {
+      BoxControllerMappedIO io(m_bc.get());
+      io.setDataType(sizeof(FROM), "MDEvent");
+      io.openFile(m_fileName, "w");
+      auto block = makeBlock<FROM>(io, 20, 7);
+      TS_ASSERT_THROWS_NOTHING(io.saveBlock(block, 100));
+      std::vector<FROM> loaded;
+      TS_ASSERT_THROWS_NOTHING(io.loadBlock(loaded, 100, 20));
+      TS_ASSERT_EQUALS(loaded, block);
+      TS_ASSERT_THROWS_NOTHING(io.closeFile());
+      return block;
+    }();
+
+    BoxControllerMappedIO io(m_bc.get());
+    io.setDataType(sizeof(TO), "MDEvent");
+    TS_ASSERT_THROWS_NOTHING(io.openFile(m_fileName, "r"));
+    const size_t nColumns = io.getNDataColums();
+    std::vector<TO> loaded;
+    TS_ASSERT_THROWS_NOTHING(io.loadBlock(loaded, 119, 1));
+    TS_ASSERT_EQUALS(loaded.size(), nColumns);
+    for (size_t i = 0; i < loaded.size(); ++i)
+      TS_ASSERT_DELTA(loaded[i], block[19 * nColumns + i], 1.e-5);
+  }
+
+  std::unique_ptr<Mantid::API::BoxController> m_bc;
+  std::string m_fileName;
+};
+
+#endif /* MANTID_DATAOBJECTS_BOXCONTROLLERMAPPEDIOTEST_H_ */
@@ -0,0 +1,177 @@
+#ifndef MANTID_DATAOBJECTS_COMPRESSEDEVENTSTEST_H_
+#define MANTID_DATAOBJECTS_COMPRESSEDEVENTSTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidDataObjects/CompressedEvents.h"
+
+#include <limits>
+
+using namespace Mantid;
+using namespace Mantid::API;
+using namespace Mantid::DataObjects;
+using Mantid::Types::Event::TofEvent;
+
+class CompressedEventsTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static CompressedEventsTest *createSuite() {
+    return new CompressedEventsTest();
+  }
+  static void destroySuite(CompressedEventsTest *suite) { delete suite; }
+
+  void test_default_constructor() {
+    CompressedEvents compressed;
+    TS_ASSERT_EQUALS(compressed.getEventType(), TOF);
+    TS_ASSERT(compressed.empty());
+    TS_ASSERT_EQUALS(compressed.numPulses(), 0);
+    std::vector<TofEvent> out{TofEvent(1., 2)};
+    compressed.copyTo(out);
+    TS_ASSERT(out.empty());
+  }
+
+  void test_round_trip_TofEvent() {
+    const auto events = makeTofEvents();
+    CompressedEvents compressed(events);
+    TS_ASSERT_EQUALS(compressed.size(), events.size());
+    TS_ASSERT_EQUALS(compressed.numPulses(), 1000);
+    TS_ASSERT(compressed.isSortedByPulseTime());
+
+    std::vector<TofEvent> out;
+    compressed.copyTo(out);
+    TS_ASSERT_EQUALS(out, events);
+    std::vector<WeightedEvent> wrongType;
+    TS_ASSERT_THROWS(compressed.copyTo(wrongType), std::runtime_error);
+  }
+
+  void test_round_trip_WeightedEvent() {
+    std::vector<WeightedEvent> events;
+    for (const auto &event : makeTofEvents())
+      events.emplace_back(event, 2.0f, 3.0f);
+    // One event with a different weight
+    events[5] = WeightedEvent(events[5].tof(), events[5].pulseTime(), 0.5f,
+                              0.25f);
+    CompressedEvents compressed(events);
+    TS_ASSERT_EQUALS(compressed.getEventType(), WEIGHTED);
+
+    std::vector<WeightedEvent> out;
+    compressed.copyTo(out);
+    TS_ASSERT_EQUALS(out, events);
+  }
+
+  void test_round_trip_WeightedEventNoTime() {
+    std::vector<WeightedEventNoTime> events;
+    for (const auto &event : makeTofEvents())
+      events.emplace_back(event.tof(), 2.0f, 3.0f);
+    CompressedEvents compressed(events);
+    TS_ASSERT_EQUALS(compressed.getEventType(), WEIGHTED_NOTIME);
+    TS_ASSERT_EQUALS(compressed.numPulses(), 0);
+
+    std::vector<WeightedEventNoTime> out;
+    compressed.copyTo(out);
+    TS_ASSERT_EQUALS(out, events);
+  }
+
+  void test_round_trip_unusual_values() {
+    const std::vector<TofEvent> events{
+        TofEvent(-1e300, -5),
+        TofEvent(std::numeric_limits<double>::infinity(), 1000000000000),
+        TofEvent(0., std::numeric_limits<int64_t>::min()),
+        TofEvent(-0., std::numeric_limits<int64_t>::max()),
+        TofEvent(std::numeric_limits<double>::denorm_min(), 0),
+        TofEvent(1e300, std::numeric_limits<int64_t>::min())};
+    CompressedEvents compressed(events);
+    TS_ASSERT(!compressed.isSortedByPulseTime());
+    std::vector<TofEvent> out;
+    compressed.copyTo(out);
+    TS_ASSERT_EQUALS(out, events);
+    TS_ASSERT_EQUALS(compressed.tofMin(), -1e300);
+    TS_ASSERT_EQUALS(compressed.tofMax(),
+                     std::numeric_limits<double>::infinity());
+  }
+
+  void test_identical_tofs_use_no_bits() {
+    std::vector<TofEvent> events;
+    for (int64_t i = 0; i < 1000; ++i)
+      events.emplace_back(123.5, 17);
+    CompressedEvents compressed(events);
+    TS_ASSERT_EQUALS(compressed.numPulses(), 1);
+    TS_ASSERT_LESS_THAN(compressed.getMemorySize(), 16);
+    TS_ASSERT_EQUALS(compressed.tof(999), 123.5);
+  }
+
+  void test_tofs_from_floats_are_packed() {
+    const auto events = makeTofEvents();
+    CompressedEvents compressed(events);
+    // The float time-of-flight values span less than 32 bits once packed,
+    // and the pulse index needs a few bytes per pulse
+    TS_ASSERT_LESS_THAN(compressed.getMemorySize(),
+                        events.size() * 4 + compressed.numPulses() * 8);
+    for (size_t i = 0; i < events.size(); i += 97)
+      TS_ASSERT_EQUALS(compressed.tof(i), events[i].tof());
+  }
+
+  void test_copyPulseTimeRange() {
+    auto events = makeTofEvents();
+    // Out of order pulses are selected as well
+    events.emplace_back(1.0, 1234);
+    CompressedEvents compressed(events);
+    std::vector<TofEvent> out;
+    const int64_t stop = 1000 + 3 * PULSE_PERIOD;
+    compressed.copyPulseTimeRange(1200, stop, out);
+    std::vector<TofEvent> expected;
+    for (const auto &event : events)
+      if (event.pulseTime() >= 1200 && event.pulseTime() < stop)
+        expected.push_back(event);
+    TS_ASSERT_EQUALS(out, expected);
+    TS_ASSERT_EQUALS(out.size(), 6);
+  }
+
+  void test_histogramCounts() {
+    const auto events = makeTofEvents();
+    CompressedEvents compressed(events);
+    const MantidVec X{0., 100., 1000., 5000., 20000.};
+    MantidVec Y;
+    compressed.histogramCounts(X, Y);
+    MantidVec expected(4, 0.);
+    for (const auto &event : events)
+      for (size_t bin = 0; bin < 4; ++bin)
+        if (event.tof() >= X[bin] && event.tof() < X[bin + 1])
+          expected[bin] += 1.;
+    TS_ASSERT_EQUALS(Y, expected);
+  }
+
+  void test_histogramWeights() {
+    std::vector<WeightedEventNoTime> events;
+    for (const auto &event : makeTofEvents())
+      events.emplace_back(event.tof(), 2.0f, 4.0f);
+    CompressedEvents compressed(events);
+    const MantidVec X{0., 25000.};
+    MantidVec Y, E;
+    compressed.histogramWeights(X, Y, E);
+    TS_ASSERT_EQUALS(Y[0], 2. * double(events.size()));
+    TS_ASSERT_DELTA(E[0], std::sqrt(4. * double(events.size())), 1e-9);
+
+    CompressedEvents noWeights(makeTofEvents());
+    TS_ASSERT_THROWS(noWeights.histogramWeights(X, Y, E), std::runtime_error);
+  }
+
+private:
+  static const int64_t PULSE_PERIOD = 16666667;
+
+  /// Events in pulse time order with float precision time-of-flight values
+  std::vector<TofEvent> makeTofEvents() {
+    std::vector<TofEvent> events;
+    for (int64_t pulse = 0; pulse < 1000; ++pulse) {
+      for (int64_t i = 0; i < 1 + pulse % 5; ++i) {
+        const auto fraction = double((pulse * 7919 + i * 104729) % 1000);
+        const auto tof = static_cast<float>(100. + 19. * fraction);
+        events.emplace_back(tof, 1000 + pulse * PULSE_PERIOD);
+      }
+    }
+    return events;
+  }
+};
+
+#endif /* MANTID_DATAOBJECTS_COMPRESSEDEVENTSTEST_H_ */
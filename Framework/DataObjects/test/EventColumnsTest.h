@@ -0,0 +1,141 @@
+#ifndef MANTID_DATAOBJECTS_EVENTCOLUMNSTEST_H_
+#define MANTID_DATAOBJECTS_EVENTCOLUMNSTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidDataObjects/EventColumns.h"
+
+using namespace Mantid;
+using namespace Mantid::API;
+using namespace Mantid::DataObjects;
+using Mantid::Types::Event::TofEvent;
+
+class EventColumnsTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static EventColumnsTest *createSuite() { return new EventColumnsTest(); }
+  static void destroySuite(EventColumnsTest *suite) { delete suite; }
+
+  void test_default_constructor() {
+    EventColumns columns;
+    TS_ASSERT_EQUALS(columns.getEventType(), TOF);
+    TS_ASSERT(columns.empty());
+    TS_ASSERT(columns.hasPulseTimes());
+    TS_ASSERT(!columns.hasWeights());
+  }
+
+  void test_round_trip_TofEvent() {
+    const auto events = makeTofEvents();
+    EventColumns columns(events);
+    TS_ASSERT_EQUALS(columns.size(), events.size());
+    TS_ASSERT_EQUALS(columns.pulseTimes().size(), events.size());
+    TS_ASSERT(columns.weights().empty());
+
+    std::vector<TofEvent> out;
+    columns.copyTo(out);
+    TS_ASSERT_EQUALS(out, events);
+    std::vector<WeightedEvent> wrongType;
+    TS_ASSERT_THROWS(columns.copyTo(wrongType), std::runtime_error);
+  }
+
+  void test_round_trip_WeightedEvent() {
+    std::vector<WeightedEvent> events;
+    for (const auto &event : makeTofEvents())
+      events.emplace_back(event, 2.0f, 3.0f);
+    EventColumns columns(events);
+    TS_ASSERT_EQUALS(columns.getEventType(), WEIGHTED);
+
+    std::vector<WeightedEvent> out;
+    columns.copyTo(out);
+    TS_ASSERT_EQUALS(out, events);
+  }
+
+  void test_round_trip_WeightedEventNoTime() {
+    std::vector<WeightedEventNoTime> events;
+    for (const auto &event : makeTofEvents())
+      events.emplace_back(event.tof(), 2.0f, 3.0f);
+    EventColumns columns(events);
+    TS_ASSERT_EQUALS(columns.getEventType(), WEIGHTED_NOTIME);
+    TS_ASSERT(columns.pulseTimes().empty());
+
+    std::vector<WeightedEventNoTime> out;
+    columns.copyTo(out);
+    TS_ASSERT_EQUALS(out, events);
+  }
+
+  void test_sortTof_keeps_columns_together() {
+    EventColumns columns(makeTofEvents());
+    columns.sortTof();
+    const auto &tofs = columns.tofs();
+    const auto &pulseTimes = columns.pulseTimes();
+    TS_ASSERT(std::is_sorted(tofs.cbegin(), tofs.cend()));
+    for (size_t i = 0; i < columns.size(); ++i)
+      TS_ASSERT_EQUALS(static_cast<int64_t>(tofs[i]), 10 * pulseTimes[i]);
+  }
+
+  void test_histogramCounts() {
+    EventColumns columns(makeTofEvents());
+    columns.sortTof();
+    // Events at tof 0, 10, ..., 90; the first one is below the range
+    MantidVec X{5., 25., 50., 100.};
+    MantidVec Y;
+    columns.histogramCounts(X, Y);
+    TS_ASSERT_EQUALS(Y, MantidVec({2., 2., 5.}));
+  }
+
+  void test_histogramWeights() {
+    std::vector<WeightedEventNoTime> events;
+    for (const auto &event : makeTofEvents())
+      events.emplace_back(event.tof(), 2.0f, 4.0f);
+    EventColumns columns(events);
+    columns.sortTof();
+    MantidVec X{5., 25., 50., 100.};
+    MantidVec Y, E;
+    columns.histogramWeights(X, Y, E);
+    TS_ASSERT_EQUALS(Y, MantidVec({4., 4., 10.}));
+    TS_ASSERT_DELTA(E[0], std::sqrt(8.), 1e-12);
+    TS_ASSERT_DELTA(E[2], std::sqrt(20.), 1e-12);
+
+    EventColumns unweighted(makeTofEvents());
+    TS_ASSERT_THROWS(unweighted.histogramWeights(X, Y, E),
+                     std::runtime_error);
+  }
+
+  void test_convertTof_and_maskTof() {
+    EventColumns columns(makeTofEvents());
+    columns.sortTof();
+    columns.convertTof(2., 1.);
+    TS_ASSERT_EQUALS(columns.tofs().front(), 1.);
+    TS_ASSERT_EQUALS(columns.tofs().back(), 181.);
+
+    TS_ASSERT_EQUALS(columns.maskTof(20., 100.), 4);
+    TS_ASSERT_EQUALS(columns.size(), 6);
+    TS_ASSERT_EQUALS(columns.pulseTimes().size(), 6);
+    TS_ASSERT_EQUALS(columns.maskTof(1000., 2000.), 0);
+  }
+
+  void test_compress() {
+    EventColumns columns(makeTofEvents());
+    columns.sortTof();
+    EventColumns out;
+    columns.compress(15., out);
+    TS_ASSERT_EQUALS(out.getEventType(), WEIGHTED_NOTIME);
+    TS_ASSERT_EQUALS(out.size(), 5);
+    TS_ASSERT_EQUALS(out.tofs()[0], 5.);
+    TS_ASSERT_EQUALS(out.weights()[0], 2.f);
+    TS_ASSERT_EQUALS(out.errorSquareds()[0], 2.f);
+    TS_ASSERT_THROWS(columns.compress(15., columns), std::invalid_argument);
+  }
+
+private:
+  /// Events at tof 90, 80, ..., 0 with pulse time tof / 10
+  std::vector<TofEvent> makeTofEvents() {
+    std::vector<TofEvent> events;
+    for (int i = 9; i >= 0; --i)
+      events.emplace_back(10. * i, static_cast<int64_t>(i));
+    return events;
+  }
+};
+
+#endif /* MANTID_DATAOBJECTS_EVENTCOLUMNSTEST_H_ */
@@ -0,0 +1,140 @@
+#ifndef MANTID_DATAOBJECTS_EVENTHISTOGRAMMERTEST_H_
+#define MANTID_DATAOBJECTS_EVENTHISTOGRAMMERTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidDataObjects/EventHistogrammer.h"
+#include "MantidDataObjects/Events.h"
+
+#include <cmath>
+#include <limits>
+
+using namespace Mantid;
+using namespace Mantid::DataObjects;
+using Mantid::Types::Event::TofEvent;
+
+class EventHistogrammerTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static EventHistogrammerTest *createSuite() {
+    return new EventHistogrammerTest();
+  }
+  static void destroySuite(EventHistogrammerTest *suite) { delete suite; }
+
+  void test_detects_linear_binning() {
+    const MantidVec X = linearEdges(10., 20., 1000);
+    EventHistogrammer histogrammer(X);
+    TS_ASSERT_EQUALS(histogrammer.getBinningType(), EventHistogrammer::LINEAR);
+    TS_ASSERT_EQUALS(histogrammer.numBins(), 1000);
+  }
+
+  void test_linear_binning_with_different_last_bin() {
+    // As produced by Rebin with parameters 0.5, 3.3, 20000
+    MantidVec X;
+    for (double x = 0.5; x < 20000.; x += 3.3)
+      X.push_back(x);
+    X.push_back(20000.);
+    EventHistogrammer histogrammer(X);
+    TS_ASSERT_EQUALS(histogrammer.getBinningType(), EventHistogrammer::LINEAR);
+    assertMatchesSearch(X, edgeTofs(X));
+    assertMatchesSearch(X, spreadTofs());
+  }
+
+  void test_detects_logarithmic_binning() {
+    MantidVec X;
+    for (double x = 100.; x < 20000.; x *= 1.004)
+      X.push_back(x);
+    X.push_back(20000.);
+    EventHistogrammer histogrammer(X);
+    TS_ASSERT_EQUALS(histogrammer.getBinningType(),
+                     EventHistogrammer::LOGARITHMIC);
+    assertMatchesSearch(X, edgeTofs(X));
+    assertMatchesSearch(X, spreadTofs());
+  }
+
+  void test_irregular_binning() {
+    const MantidVec X{0., 1., 5., 6., 100., 1000., 2000., 25000.};
+    EventHistogrammer histogrammer(X);
+    TS_ASSERT_EQUALS(histogrammer.getBinningType(),
+                     EventHistogrammer::IRREGULAR);
+    assertMatchesSearch(X, edgeTofs(X));
+    assertMatchesSearch(X, spreadTofs());
+  }
+
+  void test_linear_binning_at_edges() {
+    const MantidVec X = linearEdges(10., 20., 1000);
+    assertMatchesSearch(X, edgeTofs(X));
+    assertMatchesSearch(X, spreadTofs());
+  }
+
+  void test_events_outside_edges_are_ignored() {
+    const MantidVec X = linearEdges(0., 1., 10);
+    const std::vector<double> tofs{-1.,
+                                   10.,
+                                   1e300,
+                                   -std::numeric_limits<double>::infinity(),
+                                   std::numeric_limits<double>::infinity(),
+                                   std::numeric_limits<double>::quiet_NaN()};
+    std::vector<int> bins(tofs.size());
+    EventHistogrammer(X).findBins(tofs.data(), tofs.size(), bins.data());
+    for (const int bin : bins)
+      TS_ASSERT_EQUALS(bin, -1);
+  }
+
+  void test_addWeights_for_event_structs() {
+    const MantidVec X = linearEdges(0., 10., 3);
+    std::vector<WeightedEvent> events;
+    for (int i = 0; i < 30; ++i)
+      events.emplace_back(TofEvent(double(i), 0), 2.0f, 3.0f);
+    MantidVec Y(3, 0.), E(3, 0.);
+    EventHistogrammer(X).addWeights(events.cbegin(), events.cend(), Y, E);
+    TS_ASSERT_EQUALS(Y, MantidVec({20., 20., 20.}));
+    TS_ASSERT_EQUALS(E, MantidVec({30., 30., 30.}));
+  }
+
+private:
+  MantidVec linearEdges(const double start, const double step,
+                        const size_t numBins) {
+    MantidVec X(numBins + 1);
+    for (size_t i = 0; i <= numBins; ++i)
+      X[i] = start + static_cast<double>(i) * step;
+    return X;
+  }
+
+  /// The edges and their neighbouring doubles
+  std::vector<double> edgeTofs(const MantidVec &X) {
+    std::vector<double> tofs;
+    for (const double x : X) {
+      tofs.push_back(std::nextafter(x, -1e300));
+      tofs.push_back(x);
+      tofs.push_back(std::nextafter(x, 1e300));
+    }
+    return tofs;
+  }
+
+  std::vector<double> spreadTofs() {
+    std::vector<double> tofs;
+    for (int i = -100; i < 30000; ++i)
+      tofs.push_back(0.837 * i);
+    return tofs;
+  }
+
+  void assertMatchesSearch(const MantidVec &X,
+                           const std::vector<double> &tofs) {
+    MantidVec expected(X.size() - 1, 0.);
+    for (const double tof : tofs) {
+      for (size_t bin = 0; bin + 1 < X.size(); ++bin) {
+        if (tof >= X[bin] && tof < X[bin + 1]) {
+          expected[bin] += 1.;
+          break;
+        }
+      }
+    }
+    MantidVec Y(X.size() - 1, 0.);
+    EventHistogrammer(X).addCounts(tofs.data(), tofs.size(), Y);
+    TS_ASSERT_EQUALS(Y, expected);
+  }
+};
+
+#endif /* MANTID_DATAOBJECTS_EVENTHISTOGRAMMERTEST_H_ */
@@ -920,6 +920,310 @@ public:
     }
   }
 
+  void test_column_storage_round_trip_all_types() {
+    for (int this_type = 0; this_type < 3; this_type++) {
+      this->fake_data();
+      el.switchTo(static_cast<EventType>(this_type));
+      const EventList original(el);
+
+      TS_ASSERT_EQUALS(el.getStorageType(), STRUCT_STORAGE);
+      el.setStorageType(COLUMN_STORAGE);
+      TS_ASSERT_EQUALS(el.getStorageType(), COLUMN_STORAGE);
+      TS_ASSERT_EQUALS(el.getNumberEvents(), original.getNumberEvents());
+      TS_ASSERT_EQUALS(el.getEventType(), original.getEventType());
+
+      // Copies keep the column storage
+      EventList copy(el);
+      TS_ASSERT_EQUALS(copy.getStorageType(), COLUMN_STORAGE);
+
+      el.setStorageType(STRUCT_STORAGE);
+      TS_ASSERT_EQUALS(el.getStorageType(), STRUCT_STORAGE);
+      TS_ASSERT_EQUALS(el, original);
+      TS_ASSERT_EQUALS(copy, original);
+    }
+  }
+
+  void test_column_storage_histogram_all_types() {
+    for (int this_type = 0; this_type < 3; this_type++) {
+      if (this_type == TOF)
+        this->fake_uniform_data();
+      else
+        this->fake_uniform_data_weights();
+      el.switchTo(static_cast<EventType>(this_type));
+      this->test_setX();
+      const EventList structs(el);
+      el.setStorageType(COLUMN_STORAGE);
+      const EventList columns(el);
+
+      MantidVec X = structs.readX();
+      MantidVec Y1, E1, Y2, E2;
+      structs.generateHistogram(X, Y1, E1);
+      columns.generateHistogram(X, Y2, E2);
+      TS_ASSERT_EQUALS(columns.getStorageType(), COLUMN_STORAGE);
+      TS_ASSERT_EQUALS(Y1, Y2);
+      TS_ASSERT_EQUALS(E1, E2);
+      TS_ASSERT_EQUALS(columns.getSortType(), TOF_SORT);
+      TS_ASSERT_EQUALS(columns.getTofMin(), structs.getTofMin());
+      TS_ASSERT_EQUALS(columns.getTofMax(), structs.getTofMax());
+    }
+  }
+
+  void test_column_storage_convertTof_and_maskTof() {
+    this->fake_uniform_data();
+    EventList structs(el);
+    el.setStorageType(COLUMN_STORAGE);
+
+    el.convertTof(2.5, 1.0);
+    structs.convertTof(2.5, 1.0);
+    el.maskTof(1000., 5000.);
+    structs.maskTof(1000., 5000.);
+    TS_ASSERT_EQUALS(el.getStorageType(), COLUMN_STORAGE);
+    TS_ASSERT_EQUALS(el.getTofs(), structs.getTofs());
+    TS_ASSERT_EQUALS(el.readX(), structs.readX());
+
+    // Const sorts without a column implementation sort a decoded copy
+    el.sortPulseTime();
+    TS_ASSERT_EQUALS(el.getStorageType(), COLUMN_STORAGE);
+    structs.sortPulseTime();
+    TS_ASSERT_EQUALS(el, structs);
+    TS_ASSERT_EQUALS(el.getTofs(), structs.getTofs());
+
+    // Sorting the columns again refreshes the decoded copy
+    el.sortTof();
+    structs.sortTof();
+    TS_ASSERT_EQUALS(el.getStorageType(), COLUMN_STORAGE);
+    TS_ASSERT_EQUALS(el, structs);
+  }
+
+  void test_column_storage_compressEvents() {
+    this->fake_uniform_data(4.0);
+    EventList structs(el);
+    el.setStorageType(COLUMN_STORAGE);
+
+    EventList compressedColumns, compressedStructs;
+    el.compressEvents(BIN_DELTA / 2.0, &compressedColumns);
+    structs.compressEvents(BIN_DELTA / 2.0, &compressedStructs);
+    TS_ASSERT_EQUALS(compressedColumns.getStorageType(), COLUMN_STORAGE);
+    TS_ASSERT_EQUALS(compressedColumns.getEventType(), WEIGHTED_NOTIME);
+    TS_ASSERT_EQUALS(compressedColumns.getSortType(), TOF_SORT);
+    TS_ASSERT_EQUALS(compressedColumns.getWeightedEventsNoTime(),
+                     compressedStructs.getWeightedEventsNoTime());
+
+    // In place
+    el.compressEvents(BIN_DELTA / 2.0, &el);
+    TS_ASSERT_EQUALS(el.getWeightedEventsNoTime(),
+                     compressedStructs.getWeightedEventsNoTime());
+  }
+
+  void test_column_storage_switches_back_when_adding_events() {
+    this->fake_data();
+    const size_t numEvents = el.getNumberEvents();
+    el.setStorageType(COLUMN_STORAGE);
+    el.addEventQuickly(TofEvent(1.0, 2));
+    TS_ASSERT_EQUALS(el.getStorageType(), STRUCT_STORAGE);
+    TS_ASSERT_EQUALS(el.getNumberEvents(), numEvents + 1);
+
+    el.setStorageType(COLUMN_STORAGE);
+    el.clear();
+    TS_ASSERT_EQUALS(el.getStorageType(), COLUMN_STORAGE);
+    TS_ASSERT(el.empty());
+  }
+
+  void test_column_storage_const_readers_in_parallel() {
+    this->fake_uniform_data();
+    this->test_setX();
+    const EventList structs(el);
+    el.setStorageType(COLUMN_STORAGE);
+    el.sortTof();
+    const EventList &columns = el;
+
+    const MantidVec X = structs.readX();
+    MantidVec expectedY, expectedE;
+    structs.generateHistogram(X, expectedY, expectedE);
+    const auto &expectedEvents = structs.getEvents();
+
+    // Reading the events as structs must not release the columns while
+    // other threads histogram them
+    int nWrong = 0;
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int i = 0; i < 200; ++i) {
+      bool same = true;
+      if (i % 2 == 0) {
+        same = columns.getEvents() == expectedEvents;
+      } else {
+        MantidVec Y, E;
+        columns.generateHistogram(X, Y, E);
+        same = Y == expectedY && E == expectedE;
+      }
+      if (!same) {
+        PARALLEL_ATOMIC
+        ++nWrong;
+      }
+    }
+    TS_ASSERT_EQUALS(nWrong, 0);
+    TS_ASSERT_EQUALS(columns.getStorageType(), COLUMN_STORAGE);
+
+    // Modifying the list releases the columns and keeps the events
+    el.getEvents().push_back(TofEvent(1.0, 2));
+    TS_ASSERT_EQUALS(el.getStorageType(), STRUCT_STORAGE);
+    TS_ASSERT_EQUALS(el.getNumberEvents(), structs.getNumberEvents() + 1);
+  }
+
+  void test_compressed_storage_round_trip_all_types() {
+    for (int this_type = 0; this_type < 3; this_type++) {
+      this->fake_data();
+      el.switchTo(static_cast<EventType>(this_type));
+      const EventList original(el);
+
+      el.setStorageType(COMPRESSED_STORAGE);
+      TS_ASSERT_EQUALS(el.getStorageType(), COMPRESSED_STORAGE);
+      TS_ASSERT_EQUALS(el.getNumberEvents(), original.getNumberEvents());
+      TS_ASSERT_EQUALS(el.getSortType(), original.getSortType());
+      TS_ASSERT_LESS_THAN(el.getMemorySize(), original.getMemorySize());
+      TS_ASSERT_EQUALS(el.getTofMin(), original.getTofMin());
+      TS_ASSERT_EQUALS(el.getTofMax(), original.getTofMax());
+
+      // Copies keep the compressed storage
+      EventList copy(el);
+      TS_ASSERT_EQUALS(copy.getStorageType(), COMPRESSED_STORAGE);
+
+      // Switching to columns goes through structs
+      el.setStorageType(COLUMN_STORAGE);
+      TS_ASSERT_EQUALS(el.getStorageType(), COLUMN_STORAGE);
+      el.setStorageType(STRUCT_STORAGE);
+      TS_ASSERT_EQUALS(el, original);
+      TS_ASSERT_EQUALS(copy, original);
+    }
+  }
+
+  void test_compressed_storage_histogram_all_types() {
+    for (int this_type = 0; this_type < 3; this_type++) {
+      if (this_type == TOF)
+        this->fake_uniform_data();
+      else
+        this->fake_uniform_data_weights();
+      el.switchTo(static_cast<EventType>(this_type));
+      this->test_setX();
+      const EventList structs(el);
+      el.setStorageType(COMPRESSED_STORAGE);
+      const EventList compressed(el);
+
+      MantidVec X = structs.readX();
+      MantidVec Y1, E1, Y2, E2;
+      structs.generateHistogram(X, Y1, E1);
+      compressed.generateHistogram(X, Y2, E2);
+      // The events were not sorted, nor expanded
+      TS_ASSERT_EQUALS(compressed.getStorageType(), COMPRESSED_STORAGE);
+      TS_ASSERT_EQUALS(compressed.getSortType(), UNSORTED);
+      TS_ASSERT_EQUALS(Y1, Y2);
+      TS_ASSERT_EQUALS(E1, E2);
+    }
+  }
+
+  void test_compressed_storage_filterByPulseTime() {
+    for (int this_type = 0; this_type < 2; this_type++) {
+      this->fake_data();
+      el.switchTo(static_cast<EventType>(this_type));
+      EventList structs(el);
+      el.setStorageType(COMPRESSED_STORAGE);
+
+      EventList out, expected;
+      el.filterByPulseTime(100, 200, out);
+      structs.filterByPulseTime(100, 200, expected);
+      TS_ASSERT_EQUALS(el.getStorageType(), COMPRESSED_STORAGE);
+      TS_ASSERT_EQUALS(out.getSortType(), PULSETIME_SORT);
+      TS_ASSERT_EQUALS(out, expected);
+    }
+
+    el.switchTo(WEIGHTED_NOTIME);
+    el.setStorageType(COMPRESSED_STORAGE);
+    EventList out;
+    TS_ASSERT_THROWS(el.filterByPulseTime(100, 200, out), std::runtime_error);
+  }
+
+  void test_compressed_storage_splitByTime() {
+    this->fake_data();
+    EventList structs(el);
+    el.setStorageType(COMPRESSED_STORAGE);
+
+    TimeSplitterType split;
+    for (int i = 0; i < 10; i++)
+      split.push_back(SplittingInterval(i * 100, (i + 1) * 100, i));
+    std::vector<EventList> outputs(10), expected(10);
+    std::vector<EventList *> outputPtrs, expectedPtrs;
+    for (size_t i = 0; i < 10; i++) {
+      outputPtrs.push_back(&outputs[i]);
+      expectedPtrs.push_back(&expected[i]);
+    }
+    el.splitByTime(split, outputPtrs);
+    structs.splitByTime(split, expectedPtrs);
+    TS_ASSERT_EQUALS(el.getStorageType(), COMPRESSED_STORAGE);
+    for (size_t i = 0; i < 10; i++)
+      TS_ASSERT_EQUALS(outputs[i], expected[i]);
+  }
+
+  void test_compressed_storage_const_readers_in_parallel() {
+    this->fake_data();
+    this->test_setX();
+    const EventList structs(el);
+    el.setStorageType(COMPRESSED_STORAGE);
+    const EventList &compressed = el;
+
+    // Histogramming sorts the structs, so copy the events first
+    const auto expectedEvents = structs.getEvents();
+    const MantidVec X = structs.readX();
+    MantidVec expectedY, expectedE;
+    structs.generateHistogram(X, expectedY, expectedE);
+
+    // Decoding for a const reader must not release the compressed events
+    // while other threads histogram them
+    int nWrong = 0;
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int i = 0; i < 200; ++i) {
+      bool same = true;
+      if (i % 2 == 0) {
+        same = compressed.getEvents() == expectedEvents;
+      } else {
+        MantidVec Y, E;
+        compressed.generateHistogram(X, Y, E);
+        same = Y == expectedY && E == expectedE;
+      }
+      if (!same) {
+        PARALLEL_ATOMIC
+        ++nWrong;
+      }
+    }
+    TS_ASSERT_EQUALS(nWrong, 0);
+    TS_ASSERT_EQUALS(compressed.getStorageType(), COMPRESSED_STORAGE);
+
+    // Readers follow the decoded copy once a const sort has reordered it
+    EventList out, expected;
+    compressed.filterByPulseTime(100, 200, out);
+    structs.filterByPulseTime(100, 200, expected);
+    TS_ASSERT_EQUALS(out, expected);
+    compressed.sortTof();
+    structs.sortTof();
+    TS_ASSERT_EQUALS(compressed.getTofs(), structs.getTofs());
+    TS_ASSERT_EQUALS(compressed.getPulseTimes(), structs.getPulseTimes());
+    TS_ASSERT_EQUALS(compressed.getStorageType(), COMPRESSED_STORAGE);
+  }
+
+  void test_compressed_storage_switches_back_when_modified() {
+    this->fake_data();
+    EventList structs(el);
+    el.setStorageType(COMPRESSED_STORAGE);
+    el.convertTof(2.5, 1.0);
+    structs.convertTof(2.5, 1.0);
+    TS_ASSERT_EQUALS(el.getStorageType(), STRUCT_STORAGE);
+    TS_ASSERT_EQUALS(el, structs);
+
+    // Const sorts only sort a decoded copy
+    el.setStorageType(COMPRESSED_STORAGE);
+    el.sortTof();
+    TS_ASSERT_EQUALS(el.getStorageType(), COMPRESSED_STORAGE);
+    TS_ASSERT_EQUALS(el.getSortType(), TOF_SORT);
+  }
+
   void test_histogram_tof_event_by_pulse_time() {
     // Generate TOF events with Pulse times uniformly distributed.
     EventList eList = this->fake_uniform_pulse_data();
@@ -1599,6 +1903,67 @@ public:
     }
   }
 
+  void test_sort_long_lists() {
+    // Long enough to use the radix sort
+    checkSortLongList(20000);
+  }
+
+  void test_sort_very_long_lists() { checkSortLongList(300000); }
+
+  void checkSortLongList(const int numEvents) {
+    for (int this_type = 0; this_type < 3; this_type++) {
+      EventType curType = static_cast<EventType>(this_type);
+      EventList el;
+      srand(1234);
+      for (int i = 0; i < numEvents; i++)
+        el += TofEvent(1e7 * (rand() * 1.0 / RAND_MAX), rand() % 1000);
+      el.switchTo(curType);
+      const double totalCounts = el.integrate(0., 0., true);
+
+      el.sortTof();
+      TS_ASSERT_EQUALS(el.getNumberEvents(), numEvents);
+      TS_ASSERT_EQUALS(el.integrate(0., 0., true), totalCounts);
+      for (size_t i = 1; i < el.getNumberEvents(); i++)
+        TSM_ASSERT_LESS_THAN_EQUALS(this_type, el.getEvent(i - 1).tof(),
+                                    el.getEvent(i).tof());
+
+      if (curType == WEIGHTED_NOTIME)
+        continue;
+      el.sortPulseTime();
+      TS_ASSERT_EQUALS(el.getNumberEvents(), numEvents);
+      for (size_t i = 1; i < el.getNumberEvents(); i++)
+        TSM_ASSERT_LESS_THAN_EQUALS(this_type, el.getEvent(i - 1).pulseTime(),
+                                    el.getEvent(i).pulseTime());
+
+      el.sortPulseTimeTOF();
+      TS_ASSERT_EQUALS(el.getNumberEvents(), numEvents);
+      for (size_t i = 1; i < el.getNumberEvents(); i++) {
+        TSM_ASSERT_LESS_THAN_EQUALS(this_type, el.getEvent(i - 1).pulseTime(),
+                                    el.getEvent(i).pulseTime());
+        if (el.getEvent(i - 1).pulseTime() == el.getEvent(i).pulseTime())
+          TSM_ASSERT_LESS_THAN_EQUALS(this_type, el.getEvent(i - 1).tof(),
+                                      el.getEvent(i).tof());
+      }
+
+      const double tofFactor = 0.5;
+      const double tofShift = 1e-6;
+      el.sortTimeAtSample(tofFactor, tofShift);
+      TS_ASSERT_EQUALS(el.getNumberEvents(), numEvents);
+      for (size_t i = 1; i < el.getNumberEvents(); i++) {
+        const auto previous = el.getEvent(i - 1);
+        const auto current = el.getEvent(i);
+        TSM_ASSERT_LESS_THAN_EQUALS(
+            this_type,
+            previous.pulseTime().totalNanoseconds() +
+                static_cast<int64_t>(tofFactor * (previous.tof() * 1e3) +
+                                     (tofShift * 1e9)),
+            current.pulseTime().totalNanoseconds() +
+                static_cast<int64_t>(tofFactor * (current.tof() * 1e3) +
+                                     (tofShift * 1e9)));
+      }
+    }
+  }
+
   //-----------------------------------------------------------------------------------------------
   void test_filterByPulseTime() {
     // Go through each possible EventType (except the no-time one) as the input
@@ -1644,6 +2009,34 @@ public:
     TS_ASSERT_THROWS(el.filterByPulseTime(100, 200, el), std::invalid_argument);
   }
 
+  void test_filterByPulseTime_and_splitByTime_window_edges() {
+    // Three events per pulse, pulses in reverse order
+    EventList events;
+    for (int64_t pulse = 999; pulse >= 0; --pulse)
+      for (int i = 0; i < 3; ++i)
+        events += TofEvent(double(i), pulse);
+
+    EventList out;
+    events.filterByPulseTime(100, 200, out);
+    TS_ASSERT_EQUALS(out.getNumberEvents(), 300);
+    TS_ASSERT_EQUALS(out.getPulseTimeMin(), DateAndTime(100));
+    TS_ASSERT_EQUALS(out.getPulseTimeMax(), DateAndTime(199));
+    events.filterByPulseTime(1000, 2000, out);
+    TS_ASSERT(out.empty());
+
+    TimeSplitterType split;
+    split.push_back(SplittingInterval(-5, 1, 0));
+    split.push_back(SplittingInterval(1, 1, 1));
+    split.push_back(SplittingInterval(500, 999, 2));
+    std::vector<EventList> outputs(3);
+    std::vector<EventList *> outputPtrs{&outputs[0], &outputs[1], &outputs[2]};
+    events.splitByTime(split, outputPtrs);
+    TS_ASSERT_EQUALS(outputs[0].getNumberEvents(), 3);
+    TS_ASSERT(outputs[1].empty());
+    TS_ASSERT_EQUALS(outputs[2].getNumberEvents(), 3 * 499);
+    TS_ASSERT_EQUALS(outputs[2].getPulseTimeMax(), DateAndTime(998));
+  }
+
   void test_filter_by_time_at_sample_behaves_like_filter_by_pulse_time() {
 
     const double tofFactor = 0; // No TOF component
@@ -596,6 +596,30 @@ public:
       TS_ASSERT_LESS_THAN_EQUALS(ve[i].pulseTime(), ve[i + 1].pulseTime());
   }
 
+  void test_sortAll_uneven_list_sizes() {
+    // One long list, a few medium ones and many short ones, which are sorted
+    // in separate batches
+    EventWorkspace_sptr test_in =
+        WorkspaceCreationHelper::createRandomEventWorkspace(10, NUMPIXELS);
+    srand(1234);
+    for (int wi = 0; wi < 5; wi++) {
+      const int numEvents = (wi == 0) ? 100000 : 10000;
+      for (int i = 0; i < numEvents; i++)
+        test_in->getSpectrum(wi) +=
+            TofEvent(1e4 * (rand() * 1.0 / RAND_MAX), rand() % 1000);
+    }
+
+    test_in->sortAll(TOF_SORT, nullptr);
+
+    TS_ASSERT_EQUALS(test_in->getSortType(), TOF_SORT);
+    for (int wi = 0; wi < NUMPIXELS; wi++) {
+      std::vector<TofEvent> ve = test_in->getSpectrum(wi).getEvents();
+      TS_ASSERT_EQUALS(ve.size(), wi == 0 ? 100010 : wi < 5 ? 10010 : 10);
+      for (size_t i = 0; i < ve.size() - 1; i++)
+        TS_ASSERT_LESS_THAN_EQUALS(ve[i].tof(), ve[i + 1].tof());
+    }
+  }
+
   void test_sortAll_ByTime() {
     EventWorkspace_sptr test_in =
         WorkspaceCreationHelper::createRandomEventWorkspace(NUMBINS, NUMPIXELS);
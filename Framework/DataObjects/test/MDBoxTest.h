@@ -167,6 +167,30 @@ public:
     TS_ASSERT_DELTA(b.getErrorSquared(), 3.4 * 3, 1e-5);
   }
 
+  void test_sortEventsAlongCurve() {
+    BoxController_sptr sc(new BoxController(2));
+    MDBox<MDLeanEvent<2>, 2> b(sc.get());
+    b.setExtents(0, 0.0, 4.0);
+    b.setExtents(1, 0.0, 4.0);
+    // One event in each quarter of the box, in reverse curve order
+    const coord_t centers[4][2] = {{3., 3.}, {3., 1.}, {1., 3.}, {1., 1.}};
+    for (size_t i = 0; i < 4; i++) {
+      MDLeanEvent<2> ev(float(i), 0.f);
+      ev.setCenter(0, centers[i][0]);
+      ev.setCenter(1, centers[i][1]);
+      b.addEvent(ev);
+    }
+
+    b.sortEventsAlongCurve();
+
+    const auto &events = b.getConstEvents();
+    TS_ASSERT_EQUALS(events.size(), 4);
+    for (size_t i = 0; i < events.size(); i++) {
+      TS_ASSERT_EQUALS(events[i].getSignal(), float(3 - i));
+    }
+    b.releaseEvents();
+  }
+
   /** Add a vector of events */
   void test_BuildAndAddLeanEvents() {
     BoxController_sptr sc(new BoxController(2));
@@ -19,6 +19,7 @@
 #include "MantidKernel/Timer.h"
 #include "MantidKernel/Utils.h"
 #include "MantidKernel/WarningSuppressions.h"
+#include "MantidTestHelpers/BoxControllerDummyIO.h"
 #include "MantidTestHelpers/MDEventsTestHelper.h"
 #include <Poco/File.h>
 #include <boost/random/linear_congruential.hpp>
@@ -958,6 +959,79 @@ public:
 
   void test_addEvents_inParallel() { do_test_addEvents_inParallel(nullptr); }
 
+  //-------------------------------------------------------------------------------------
+  /** Adding events and splitting boxes from many threads at once leaves no
+   * box needing a split and loses no events.
+   * */
+  void test_addEventsAndSplit_inParallel() {
+    typedef MDGridBox<MDLeanEvent<2>, 2> gbox_t;
+    gbox_t *b = MDEventsTestHelper::makeMDGridBox<2>();
+    BoxController *const bc = b->getBoxController();
+    bc->setSplitThreshold(100);
+    bc->setMaxDepth(4);
+    int num_repeat = 1000;
+
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int i = 0; i < num_repeat; i++) {
+      std::vector<MDLeanEvent<2>> events;
+      // Make an event at a different place in each box for every repeat
+      const double offset = 0.001 * i;
+      for (double x = offset; x < 10; x += 1.0)
+        for (double y = offset; y < 10; y += 1.0) {
+          double centers[2] = {x, y};
+          events.push_back(MDLeanEvent<2>(2.0, 2.0, centers));
+        }
+      TS_ASSERT_THROWS_NOTHING(b->addEventsAndSplit(events););
+    }
+
+    b->refreshCache(nullptr);
+    TS_ASSERT_EQUALS(b->getNPoints(), 100 * num_repeat);
+    TS_ASSERT_EQUALS(b->getSignal(), 100 * num_repeat * 2.0);
+
+    std::vector<API::IMDNode *> boxes;
+    b->getBoxes(boxes, 1000, false);
+    size_t nLeaves(0);
+    for (auto box : boxes) {
+      const size_t numChildren = box->getNumChildren();
+      if (numChildren == 0) {
+        ++nLeaves;
+        TS_ASSERT(!bc->willSplit(box->getNPoints(), box->getDepth()));
+        continue;
+      }
+      for (size_t i = 1; i < numChildren; i++) {
+        TSM_ASSERT_EQUALS("Children IDs need to be sequential!",
+                          box->getChild(i)->getID(),
+                          box->getChild(i - 1)->getID() + 1);
+      }
+    }
+    TS_ASSERT_LESS_THAN(100, nLeaves);
+
+    delete b;
+    delete bc;
+  }
+
+  /** Boxes of a file-backed workspace are written out by the disk buffer
+   * without the locks used to add events concurrently */
+  void test_addEventsAndSplit_throws_if_fileBacked() {
+    typedef MDGridBox<MDLeanEvent<2>, 2> gbox_t;
+    gbox_t *b = MDEventsTestHelper::makeMDGridBox<2>();
+    BoxController *const bc = b->getBoxController();
+    auto fileIO = boost::shared_ptr<API::IBoxControllerIO>(
+        new MantidTestHelpers::BoxControllerDummyIO(bc));
+    bc->setFileBacked(fileIO, "fakeFile");
+
+    std::vector<MDLeanEvent<2>> events;
+    double centers[2] = {1.5, 1.5};
+    events.push_back(MDLeanEvent<2>(2.0, 2.0, centers));
+    TS_ASSERT_THROWS(b->addEventsAndSplit(events), std::runtime_error);
+    b->refreshCache(nullptr);
+    TS_ASSERT_EQUALS(b->getNPoints(), 0);
+
+    bc->clearFileBacked();
+    delete b;
+    delete bc;
+  }
+
   /** Disabled because parallel RefreshCache is not implemented. Might not be
    * ever? */
   void xtest_addEvents_inParallel_then_refreshCache_inParallel() {
@@ -882,6 +882,50 @@ public:
     checkWorkspace(a, 1.5, 1.5 * 1.5 * (.5 + 1. / 3.), 1.0);
   }
 
+  //--------------------------------------------------------------------------------------
+  void test_multiplyAdd_ws() {
+    MDHistoWorkspace_sptr a = MDEventsTestHelper::makeFakeMDHistoWorkspace(
+        2.0, 2, 5, 10.0, 2.0 /*errorSquared*/);
+    MDHistoWorkspace_sptr b = MDEventsTestHelper::makeFakeMDHistoWorkspace(
+        3.0, 2, 5, 10.0, 3.0 /*errorSquared*/);
+    MDHistoWorkspace_sptr c = MDEventsTestHelper::makeFakeMDHistoWorkspace(
+        1.5, 2, 5, 10.0, 0.5 /*errorSquared*/);
+    a->multiplyAdd(*b, *c);
+    checkWorkspace(a, 7.5, 36. * (.5 + 1. / 3.) + 0.5, 2.0);
+  }
+
+  void test_multiplyAdd_scalar() {
+    MDHistoWorkspace_sptr a = MDEventsTestHelper::makeFakeMDHistoWorkspace(
+        2.0, 2, 5, 10.0, 2.0 /*errorSquared*/);
+    MDHistoWorkspace_sptr c = MDEventsTestHelper::makeFakeMDHistoWorkspace(
+        1.5, 2, 5, 10.0, 0.5 /*errorSquared*/);
+    a->multiplyAdd(3.0, sqrt(3.0), *c);
+    checkWorkspace(a, 7.5, 36. * (.5 + 1. / 3.) + 0.5, 2.0);
+  }
+
+  void test_multiplyAdd_ws_of_other_size_throws() {
+    MDHistoWorkspace_sptr a = MDEventsTestHelper::makeFakeMDHistoWorkspace(
+        2.0, 2, 5, 10.0, 2.0 /*errorSquared*/);
+    MDHistoWorkspace_sptr c = MDEventsTestHelper::makeFakeMDHistoWorkspace(
+        1.5, 2, 6, 10.0, 0.5 /*errorSquared*/);
+    TS_ASSERT_THROWS(a->multiplyAdd(*a, *c), std::invalid_argument);
+  }
+
+  //--------------------------------------------------------------------------------------
+  /** Workspaces of more than a few thousand bins are processed in blocks by
+   * several threads; every bin must still be visited exactly once. */
+  void test_operations_on_many_bins() {
+    MDHistoWorkspace_sptr a = MDEventsTestHelper::makeFakeMDHistoWorkspace(
+        2.0, 3, 37, 10.0, 2.0 /*errorSquared*/);
+    MDHistoWorkspace_sptr b = MDEventsTestHelper::makeFakeMDHistoWorkspace(
+        3.0, 3, 37, 10.0, 3.0 /*errorSquared*/);
+    *a *= *b;
+    checkWorkspace(a, 6.0, 36. * (.5 + 1. / 3.), 1.0);
+    a->add(1.0, 0.0);
+    a->lessThan(7.5);
+    checkWorkspace(a, 1.0, 0.0, 1.0);
+  }
+
   //--------------------------------------------------------------------------------------
   void test_exp() {
     MDHistoWorkspace_sptr a =
@@ -0,0 +1,76 @@
+#ifndef MANTID_DATAOBJECTS_MORTONCURVETEST_H_
+#define MANTID_DATAOBJECTS_MORTONCURVETEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidDataObjects/MortonCurve.h"
+
+#include <stdexcept>
+
+using Mantid::coord_t;
+using Mantid::DataObjects::MortonCurve;
+
+class MortonCurveTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static MortonCurveTest *createSuite() { return new MortonCurveTest(); }
+  static void destroySuite(MortonCurveTest *suite) { delete suite; }
+
+  void test_bad_number_of_dimensions_throws() {
+    std::vector<coord_t> min(65, 0), max(65, 1);
+    TS_ASSERT_THROWS(MortonCurve(0, min.data(), max.data()),
+                     std::invalid_argument);
+    TS_ASSERT_THROWS(MortonCurve(65, min.data(), max.data()),
+                     std::invalid_argument);
+    TS_ASSERT_THROWS_NOTHING(MortonCurve(64, min.data(), max.data()));
+  }
+
+  void test_bits_fill_the_key() {
+    const coord_t min[4] = {0, 0, 0, 0}, max[4] = {1, 1, 1, 1};
+    TS_ASSERT_EQUALS(MortonCurve(1, min, max).bitsPerDimension(), 32);
+    TS_ASSERT_EQUALS(MortonCurve(2, min, max).bitsPerDimension(), 32);
+    TS_ASSERT_EQUALS(MortonCurve(3, min, max).bitsPerDimension(), 21);
+    TS_ASSERT_EQUALS(MortonCurve(4, min, max).bitsPerDimension(), 16);
+  }
+
+  void test_quadrants_follow_the_z_order() {
+    const coord_t min[2] = {0, 0}, max[2] = {4, 4};
+    MortonCurve curve(2, min, max);
+    // The first dimension gives the more significant bit of each pair
+    const coord_t lowLow[2] = {1, 1}, lowHigh[2] = {1, 3},
+                  highLow[2] = {3, 1}, highHigh[2] = {3, 3};
+    TS_ASSERT_LESS_THAN(curve.key(lowLow), curve.key(lowHigh));
+    TS_ASSERT_LESS_THAN(curve.key(lowHigh), curve.key(highLow));
+    TS_ASSERT_LESS_THAN(curve.key(highLow), curve.key(highHigh));
+  }
+
+  void test_bits_are_interleaved() {
+    const coord_t min[2] = {0, 0}, max[2] = {1, 1};
+    MortonCurve curve(2, min, max);
+    // The lowest cell along the first dimension and the highest along the
+    // second has every odd bit of the key set
+    const coord_t point[2] = {0, 1};
+    TS_ASSERT_EQUALS(curve.key(point), 0x5555555555555555ull);
+  }
+
+  void test_points_outside_are_clamped() {
+    const coord_t min[2] = {-1, -1}, max[2] = {1, 1};
+    MortonCurve curve(2, min, max);
+    const coord_t below[2] = {-5, -5}, corner[2] = {-1, -1};
+    const coord_t above[2] = {5, 5}, top[2] = {1, 1};
+    TS_ASSERT_EQUALS(curve.key(below), curve.key(corner));
+    TS_ASSERT_EQUALS(curve.key(below), 0);
+    TS_ASSERT_EQUALS(curve.key(above), curve.key(top));
+    TS_ASSERT_EQUALS(curve.key(above), ~uint64_t(0));
+  }
+
+  void test_flat_dimension_does_not_change_the_key() {
+    const coord_t min[2] = {0, 2}, max[2] = {1, 2};
+    MortonCurve curve(2, min, max);
+    const coord_t a[2] = {0.5, 2}, b[2] = {0.5, 7};
+    TS_ASSERT_EQUALS(curve.key(a), curve.key(b));
+  }
+};
+
+#endif /* MANTID_DATAOBJECTS_MORTONCURVETEST_H_ */
@@ -56,6 +56,20 @@ public:
     ws.swap(cloned);
   }
 
+  void test_clone_shares_data_until_written() {
+    Workspace2D_sptr cloned(ws->clone());
+    TS_ASSERT_EQUALS(cloned->sharedY(1).get(), ws->sharedY(1).get());
+    TS_ASSERT_EQUALS(cloned->sharedE(1).get(), ws->sharedE(1).get());
+
+    const double oldY = ws->y(1)[0];
+    cloned->mutableY(1)[0] = oldY + 1.0;
+    TS_ASSERT_EQUALS(ws->y(1)[0], oldY);
+    TS_ASSERT_EQUALS(cloned->y(1)[0], oldY + 1.0);
+    TS_ASSERT_DIFFERS(cloned->sharedY(1).get(), ws->sharedY(1).get());
+    // Other spectra are unaffected
+    TS_ASSERT_EQUALS(cloned->sharedY(2).get(), ws->sharedY(2).get());
+  }
+
   void testInit() {
     ws->setTitle("testInit");
     TS_ASSERT_EQUALS(ws->getNumberHistograms(), nhist);
@@ -0,0 +1,71 @@
+#ifndef MANTID_GEOMETRY_INSTRUMENTCACHE_H_
+#define MANTID_GEOMETRY_INSTRUMENTCACHE_H_
+
+#include "MantidGeometry/DllConfig.h"
+
+#include <boost/shared_ptr.hpp>
+#include <map>
+#include <string>
+
+namespace Mantid {
+namespace Geometry {
+class Instrument;
+class Object;
+
+/**
+  Functions to write an instrument built from an instrument definition file to
+  a binary cache file, and to read it back without parsing the definition
+  again.
+
+  The cache holds the component tree with the positions, rotations, shapes and
+  detector IDs of the components, the source, sample, chopper points and
+  monitors, the parameters defined in the definition file and the other
+  properties the parser sets on the instrument. Shapes are stored as their XML
+  definitions. The pixels of rectangular and structured detectors are made
+  from the bank definitions, and only their positions and rotations are
+  stored.
+
+  Each file is stamped with a key identifying the definition it was made from,
+  and with the revision of Mantid that wrote it. A file with a different key or
+  revision is ignored, so that changes to the definition or to the way it is
+  parsed are never hidden by an old cache.
+
+  Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+namespace InstrumentCache {
+/// The shapes of the types of an instrument definition, by type name
+using TypeShapes = std::map<std::string, boost::shared_ptr<Object>>;
+
+MANTID_GEOMETRY_DLL void save(const std::string &filename,
+                              const std::string &key,
+                              const Instrument &instrument,
+                              const TypeShapes &typeShapes);
+
+MANTID_GEOMETRY_DLL bool load(const std::string &filename,
+                              const std::string &key, Instrument &instrument,
+                              TypeShapes &typeShapes);
+}
+
+} // namespace Geometry
+} // namespace Mantid
+
+#endif /* MANTID_GEOMETRY_INSTRUMENTCACHE_H_ */
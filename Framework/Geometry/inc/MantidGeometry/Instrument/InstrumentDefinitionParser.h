@@ -220,6 +220,14 @@ private:
   /// Reads in or creates the geometry cache ('vtp') file
   CachingOption setupGeometryCache();
 
+  /// Paths of the binary instrument cache, in the order they are tried
+  std::vector<std::string>
+  instrumentCacheFileNames(const std::string &mangledName) const;
+  /// Reads the instrument from the binary instrument cache if it is there
+  bool loadInstrumentCache();
+  /// Writes the instrument to the binary instrument cache
+  void saveInstrumentCache();
+
   /// If appropriate, creates a second instrument containing neutronic detector
   /// positions
   void createNeutronicInstrument();
@@ -238,6 +238,10 @@ public:
   /// a parameter with a specified type.
   boost::shared_ptr<Parameter>
   getRecursiveByType(const IComponent *comp, const std::string &type) const;
+  /// Use getRecursive() for every detector, searching shared ancestors once
+  std::vector<boost::shared_ptr<Parameter>>
+  getRecursiveForDetectors(const std::string &name,
+                           const std::string &type = "") const;
 
   /** Get the values of a given parameter of all the components that have the
    * name: compName
@@ -53,6 +53,10 @@ public:
   }
   /// @return The number of elements the environment is composed of
   inline size_t nelements() const { return m_components.size(); }
+  /// @return A const reference to the element at the given index
+  inline const Object &getComponent(const size_t index) const {
+    return *m_components[index];
+  }
 
   Geometry::BoundingBox boundingBox() const;
   /// Select a random point within a component
@@ -0,0 +1,96 @@
+#ifndef MANTID_GEOMETRY_DETECTORBVH_H_
+#define MANTID_GEOMETRY_DETECTORBVH_H_
+
+#include "MantidGeometry/DllConfig.h"
+#include "MantidKernel/V3D.h"
+
+#include <array>
+#include <vector>
+
+namespace Mantid {
+namespace Geometry {
+class ComponentInfo;
+class DetectorInfo;
+
+/** DetectorBVH : a bounding volume hierarchy over the detectors of an
+  instrument, for finding the detector a ray from a point hits first.
+
+  The hierarchy is built once from the bounding boxes of the detector shapes
+  given by ComponentInfo. Monitors and detectors without a shape are left
+  out. Rays are tested against the boxes of the hierarchy nearest first, and
+  against the shapes of the detectors in the boxes they hit, skipping any box
+  further away than the nearest detector found so far.
+
+  Once built the hierarchy is not modified, so it can be used to trace rays
+  from several threads at once. The ComponentInfo it was built from must
+  outlive it, and the detectors must not be moved while it is in use.
+
+  Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+class MANTID_GEOMETRY_DLL DetectorBVH {
+public:
+  /// The detector hit by a ray
+  struct Hit {
+    bool found;           ///< Whether the ray hit a detector
+    size_t detectorIndex; ///< Index of the detector in DetectorInfo
+    double distance;      ///< Distance from the ray start to the detector
+  };
+
+  DetectorBVH(const ComponentInfo &componentInfo,
+              const DetectorInfo &detectorInfo);
+
+  /// Number of detectors in the hierarchy
+  size_t size() const { return m_detectors.size(); }
+  Hit trace(const Kernel::V3D &start, const Kernel::V3D &direction) const;
+  std::vector<Hit> traceMany(const Kernel::V3D &start,
+                             const std::vector<Kernel::V3D> &directions) const;
+
+private:
+  /// An axis-aligned box
+  struct Box {
+    std::array<double, 3> min;
+    std::array<double, 3> max;
+  };
+  /// A node of the hierarchy, stored in depth-first order. The first child
+  /// of an inner node follows it, the second is at index.
+  struct Node {
+    Box box;
+    size_t index; ///< Second child, or first detector of a leaf
+    size_t count; ///< Number of detectors of a leaf, 0 for inner nodes
+  };
+
+  size_t build(std::vector<size_t> &order, size_t begin, size_t end);
+  double intersectShape(size_t detector, const Kernel::V3D &start,
+                        const Kernel::V3D &direction) const;
+
+  const ComponentInfo &m_componentInfo;
+  /// Detector indices, grouped by leaf
+  std::vector<size_t> m_detectors;
+  /// Bounding boxes of the detectors, in the order of m_detectors
+  std::vector<Box> m_boxes;
+  std::vector<Node> m_nodes;
+};
+
+} // namespace Geometry
+} // namespace Mantid
+
+#endif /* MANTID_GEOMETRY_DETECTORBVH_H_ */
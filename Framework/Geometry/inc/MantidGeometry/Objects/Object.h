@@ -23,6 +23,7 @@ class V3D;
 namespace Geometry {
 class CacheGeometryHandler;
 class CompGrp;
+class CompiledObject;
 class GeometryHandler;
 class Rule;
 class Surface;
@@ -223,6 +224,8 @@ private:
 
   /// Top rule [ Geometric scope of object]
   std::unique_ptr<Rule> TopRule;
+  /// Flattened rules and surfaces for ray tracing, null if not compilable
+  std::unique_ptr<CompiledObject> m_compiled;
   /// Object's bounding box
   BoundingBox m_boundingBox;
   // -- DEPRECATED --
@@ -0,0 +1,882 @@
+#include "MantidGeometry/Instrument/InstrumentCache.h"
+#include "MantidGeometry/Instrument.h"
+#include "MantidGeometry/Instrument/Component.h"
+#include "MantidGeometry/Instrument/Detector.h"
+#include "MantidGeometry/Instrument/ObjCompAssembly.h"
+#include "MantidGeometry/Instrument/RectangularDetector.h"
+#include "MantidGeometry/Instrument/RectangularDetectorPixel.h"
+#include "MantidGeometry/Instrument/ReferenceFrame.h"
+#include "MantidGeometry/Instrument/StructuredDetector.h"
+#include "MantidGeometry/Instrument/XMLInstrumentParameter.h"
+#include "MantidGeometry/Objects/Object.h"
+#include "MantidGeometry/Objects/ShapeFactory.h"
+#include "MantidKernel/Interpolation.h"
+#include "MantidKernel/MantidVersion.h"
+
+#include <Poco/Exception.h>
+#include <Poco/File.h>
+#include <Poco/Process.h>
+
+#include <boost/make_shared.hpp>
+
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <thread>
+#include <type_traits>
+#include <typeinfo>
+#include <unordered_map>
+
+namespace Mantid {
+namespace Geometry {
+
+using Kernel::Quat;
+using Kernel::V3D;
+
+namespace {
+/// Identifies an instrument cache file
+const std::string MAGIC("MantidInstrumentCache");
+/// Changed whenever the layout of the file changes.
+/// It MUST also be incremented by every change to InstrumentDefinitionParser
+/// or to this file that changes the instrument built from an IDF. Caches
+/// are also stamped with MantidVersion::revisionFull(), but that revision
+/// does not change for uncommitted changes, so a build with a modified
+/// parser would otherwise reuse caches written by the old parser.
+const uint32_t FORMAT_VERSION = 1;
+/// Index written for a missing shape or component
+const uint32_t NONE = std::numeric_limits<uint32_t>::max();
+
+/// The types of component that can be cached
+enum class Kind : uint8_t {
+  Component,
+  CompAssembly,
+  ObjComponent,
+  Detector,
+  ObjCompAssembly,
+  RectangularDetector,
+  RectangularDetectorPixel,
+  StructuredDetector
+};
+
+/**
+ * Find the kind of a component. Only the exact types are accepted, as a
+ * derived type could hold data that is not cached.
+ * @param component :: A component of an instrument
+ * @return The kind of the component
+ * @throw std::runtime_error if the component cannot be cached
+ */
+Kind kindOf(const IComponent &component) {
+  const auto &type = typeid(component);
+  if (type == typeid(Component))
+    return Kind::Component;
+  if (type == typeid(CompAssembly))
+    return Kind::CompAssembly;
+  if (type == typeid(ObjComponent))
+    return Kind::ObjComponent;
+  if (type == typeid(Detector))
+    return Kind::Detector;
+  if (type == typeid(ObjCompAssembly))
+    return Kind::ObjCompAssembly;
+  if (type == typeid(RectangularDetector))
+    return Kind::RectangularDetector;
+  if (type == typeid(RectangularDetectorPixel))
+    return Kind::RectangularDetectorPixel;
+  if (type == typeid(StructuredDetector))
+    return Kind::StructuredDetector;
+  throw std::runtime_error("Components of type " + component.type() +
+                           " cannot be cached");
+}
+
+/// Appends values to a block of bytes
+class OutputBuffer {
+public:
+  template <typename T> void write(const T &value) {
+    static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value,
+                  "Only numbers can be written as bytes");
+    m_data.append(reinterpret_cast<const char *>(&value), sizeof(T));
+  }
+  void write(const bool value) { write(static_cast<uint8_t>(value)); }
+  void write(const std::string &value) {
+    write(static_cast<uint64_t>(value.size()));
+    m_data.append(value);
+  }
+  void write(const V3D &value) {
+    write(value.X());
+    write(value.Y());
+    write(value.Z());
+  }
+  void write(const Quat &value) {
+    write(value.real());
+    write(value.imagI());
+    write(value.imagJ());
+    write(value.imagK());
+  }
+  void write(const std::vector<double> &values) {
+    write(static_cast<uint64_t>(values.size()));
+    m_data.append(reinterpret_cast<const char *>(values.data()),
+                  values.size() * sizeof(double));
+  }
+  void append(const OutputBuffer &other) { m_data.append(other.m_data); }
+  const std::string &data() const { return m_data; }
+
+private:
+  std::string m_data;
+};
+
+/// Reads values from a block of bytes written by OutputBuffer
+class InputBuffer {
+public:
+  explicit InputBuffer(const std::string &data) : m_data(data) {}
+  template <typename T> T read() {
+    static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value,
+                  "Only numbers can be read as bytes");
+    T value;
+    std::memcpy(&value, take(sizeof(T)), sizeof(T));
+    return value;
+  }
+  bool readBool() { return read<uint8_t>() != 0; }
+  std::string readString() {
+    const auto size = readSize(1);
+    return std::string(take(size), size);
+  }
+  V3D readV3D() {
+    const double x = read<double>();
+    const double y = read<double>();
+    const double z = read<double>();
+    return V3D(x, y, z);
+  }
+  Quat readQuat() {
+    const double w = read<double>();
+    const double a = read<double>();
+    const double b = read<double>();
+    const double c = read<double>();
+    return Quat(w, a, b, c);
+  }
+  std::vector<double> readDoubles() {
+    const auto size = readSize(sizeof(double));
+    std::vector<double> values(size);
+    std::memcpy(values.data(), take(size * sizeof(double)),
+                size * sizeof(double));
+    return values;
+  }
+  /// Read the number of items that follow, each at least itemSize bytes
+  size_t readSize(const size_t itemSize) {
+    const auto size = read<uint64_t>();
+    if (size > (m_data.size() - m_position) / itemSize)
+      throw std::runtime_error("Instrument cache file is truncated");
+    return static_cast<size_t>(size);
+  }
+  bool atEnd() const { return m_position == m_data.size(); }
+
+private:
+  const char *take(const size_t size) {
+    if (m_data.size() - m_position < size)
+      throw std::runtime_error("Instrument cache file is truncated");
+    const char *bytes = m_data.data() + m_position;
+    m_position += size;
+    return bytes;
+  }
+
+  const std::string &m_data;
+  size_t m_position{0};
+};
+
+/// Writes an instrument to the blocks of a cache file
+class Writer {
+public:
+  Writer(const Instrument &instrument, const InstrumentCache::TypeShapes &);
+  std::string contents(const std::string &key) const;
+
+private:
+  void writeInstrument();
+  void writeComponent(const IComponent &component, bool generated);
+  void writeChildren(const ICompAssembly &assembly, bool generated);
+  void writeMarks();
+  void writeParameters();
+  uint32_t shapeIndex(const boost::shared_ptr<const Object> &shape);
+  uint32_t componentIndex(const IComponent *component) const;
+
+  const Instrument &m_instrument;
+  OutputBuffer m_header;
+  OutputBuffer m_shapes;
+  OutputBuffer m_components;
+  OutputBuffer m_marks;
+  OutputBuffer m_parameters;
+  std::unordered_map<const Object *, uint32_t> m_shapeIndices;
+  std::unordered_map<const IComponent *, uint32_t> m_componentIndices;
+};
+
+/**
+ * Write the instrument to blocks of bytes
+ * @param instrument :: A base instrument
+ * @param typeShapes :: The shapes of the types in its definition
+ * @throw std::runtime_error if the instrument cannot be cached
+ */
+Writer::Writer(const Instrument &instrument,
+               const InstrumentCache::TypeShapes &typeShapes)
+    : m_instrument(instrument) {
+  if (instrument.isParametrized())
+    throw std::runtime_error("Parametrized instruments cannot be cached");
+  if (instrument.getPhysicalInstrument())
+    throw std::runtime_error(
+        "Instruments with neutronic positions cannot be cached");
+  OutputBuffer types;
+  types.write(static_cast<uint64_t>(typeShapes.size()));
+  for (const auto &type : typeShapes) {
+    types.write(type.first);
+    types.write(shapeIndex(type.second));
+  }
+  writeInstrument();
+  writeMarks();
+  writeParameters();
+  m_shapes.append(types);
+}
+
+/**
+ * @param key :: Identifies the definition the instrument was built from
+ * @return The contents of the cache file
+ */
+std::string Writer::contents(const std::string &key) const {
+  OutputBuffer file;
+  file.write(MAGIC);
+  file.write(FORMAT_VERSION);
+  file.write(key);
+  file.write(std::string(Kernel::MantidVersion::revisionFull()));
+  file.write(static_cast<uint64_t>(m_shapeIndices.size()));
+  file.append(m_shapes);
+  file.append(m_header);
+  file.append(m_components);
+  file.append(m_marks);
+  file.append(m_parameters);
+  return file.data();
+}
+
+/// Write the properties and the component tree of the instrument
+void Writer::writeInstrument() {
+  m_header.write(m_instrument.getValidFromDate().totalNanoseconds());
+  m_header.write(m_instrument.getValidToDate().totalNanoseconds());
+  m_header.write(m_instrument.getDefaultView());
+  m_header.write(m_instrument.getDefaultAxis());
+  const auto frame = m_instrument.getReferenceFrame();
+  m_header.write(static_cast<uint8_t>(frame->pointingUp()));
+  m_header.write(static_cast<uint8_t>(frame->pointingAlongBeam()));
+  m_header.write(frame->vecThetaSign());
+  m_header.write(static_cast<uint8_t>(frame->getHandedness()));
+  m_header.write(frame->origin());
+  const auto &units = m_instrument.getLogfileUnit();
+  m_header.write(static_cast<uint64_t>(units.size()));
+  for (const auto &unit : units) {
+    m_header.write(unit.first);
+    m_header.write(unit.second);
+  }
+
+  m_componentIndices.emplace(&m_instrument, 0);
+  m_components.write(m_instrument.getRelativePos());
+  m_components.write(m_instrument.getRelativeRot());
+  writeChildren(m_instrument, false);
+}
+
+/**
+ * Write a component and the components below it, depth first
+ * @param component :: The component
+ * @param generated :: If true the component was made by its parent, and only
+ * the data needed to check it and to place it is written
+ */
+void Writer::writeComponent(const IComponent &component, const bool generated) {
+  const auto kind = kindOf(component);
+  const auto index = static_cast<uint32_t>(m_componentIndices.size());
+  m_componentIndices.emplace(&component, index);
+  m_components.write(kind);
+  m_components.write(component.getName());
+  m_components.write(component.getRelativePos());
+  m_components.write(component.getRelativeRot());
+
+  switch (kind) {
+  case Kind::Component:
+    break;
+  case Kind::ObjComponent:
+    if (!generated)
+      m_components.write(
+          shapeIndex(dynamic_cast<const ObjComponent &>(component).shape()));
+    break;
+  case Kind::Detector:
+  case Kind::RectangularDetectorPixel: {
+    const auto &detector = dynamic_cast<const Detector &>(component);
+    if (!generated) {
+      if (kind == Kind::RectangularDetectorPixel)
+        throw std::runtime_error("Pixels outside a rectangular detector "
+                                 "cannot be cached");
+      m_components.write(shapeIndex(detector.shape()));
+    }
+    m_components.write(static_cast<int32_t>(detector.getID()));
+    break;
+  }
+  case Kind::CompAssembly:
+    writeChildren(dynamic_cast<const CompAssembly &>(component), generated);
+    break;
+  case Kind::ObjCompAssembly: {
+    const auto &assembly = dynamic_cast<const ObjCompAssembly &>(component);
+    if (!generated)
+      m_components.write(shapeIndex(assembly.shape()));
+    writeChildren(assembly, generated);
+    break;
+  }
+  case Kind::RectangularDetector: {
+    if (generated)
+      throw std::runtime_error("Nested detector banks cannot be cached");
+    const auto &bank = dynamic_cast<const RectangularDetector &>(component);
+    boost::shared_ptr<const Object> pixelShape;
+    if (bank.xpixels() > 0 && bank.ypixels() > 0)
+      pixelShape = bank.getAtXY(0, 0)->shape();
+    m_components.write(shapeIndex(pixelShape));
+    m_components.write(static_cast<int32_t>(bank.xpixels()));
+    m_components.write(bank.xstart());
+    m_components.write(bank.xstep());
+    m_components.write(static_cast<int32_t>(bank.ypixels()));
+    m_components.write(bank.ystart());
+    m_components.write(bank.ystep());
+    m_components.write(static_cast<int32_t>(bank.idstart()));
+    m_components.write(bank.idfillbyfirst_y());
+    m_components.write(static_cast<int32_t>(bank.idstepbyrow()));
+    m_components.write(static_cast<int32_t>(bank.idstep()));
+    writeChildren(bank, true);
+    break;
+  }
+  case Kind::StructuredDetector: {
+    if (generated)
+      throw std::runtime_error("Nested detector banks cannot be cached");
+    const auto &bank = dynamic_cast<const StructuredDetector &>(component);
+    m_components.write(static_cast<uint64_t>(bank.xPixels()));
+    m_components.write(static_cast<uint64_t>(bank.yPixels()));
+    m_components.write(bank.getXValues());
+    m_components.write(bank.getYValues());
+    m_components.write(static_cast<int32_t>(bank.idStart()));
+    m_components.write(bank.idFillByFirstY());
+    m_components.write(static_cast<int32_t>(bank.idStepByRow()));
+    m_components.write(static_cast<int32_t>(bank.idStep()));
+    writeChildren(bank, true);
+    break;
+  }
+  }
+}
+
+/**
+ * Write the children of an assembly
+ * @param assembly :: The assembly
+ * @param generated :: If true the children were made by a detector bank
+ */
+void Writer::writeChildren(const ICompAssembly &assembly,
+                           const bool generated) {
+  const int count = assembly.nelements();
+  m_components.write(static_cast<uint32_t>(count));
+  for (int i = 0; i < count; ++i)
+    writeComponent(*assembly.getChild(i), generated);
+}
+
+/// Write the detectors, monitors, source, sample and chopper points
+void Writer::writeMarks() {
+  detid2det_map detectors;
+  m_instrument.getDetectors(detectors);
+  m_marks.write(static_cast<uint64_t>(detectors.size()));
+  for (const auto &detector : detectors) {
+    m_marks.write(componentIndex(detector.second.get()));
+    m_marks.write(m_instrument.isMonitor(detector.first));
+  }
+  m_marks.write(componentIndex(m_instrument.getSource().get()));
+  m_marks.write(componentIndex(m_instrument.getSample().get()));
+  const auto chopperPoints = m_instrument.getNumberOfChopperPoints();
+  m_marks.write(static_cast<uint64_t>(chopperPoints));
+  for (size_t i = 0; i < chopperPoints; ++i)
+    m_marks.write(componentIndex(m_instrument.getChopperPoint(i).get()));
+}
+
+/// Write the parameters of the instrument definition
+void Writer::writeParameters() {
+  const auto &parameters = m_instrument.getLogfileCache();
+  m_parameters.write(static_cast<uint64_t>(parameters.size()));
+  for (const auto &item : parameters) {
+    const auto &parameter = *item.second;
+    m_parameters.write(item.first.first);
+    m_parameters.write(componentIndex(item.first.second));
+    m_parameters.write(componentIndex(parameter.m_component));
+    m_parameters.write(parameter.m_logfileID);
+    m_parameters.write(parameter.m_value);
+    m_parameters.write(parameter.m_paramName);
+    m_parameters.write(parameter.m_type);
+    m_parameters.write(parameter.m_tie);
+    m_parameters.write(static_cast<uint64_t>(parameter.m_constraint.size()));
+    for (const auto &constraint : parameter.m_constraint)
+      m_parameters.write(constraint);
+    m_parameters.write(parameter.m_penaltyFactor);
+    m_parameters.write(parameter.m_fittingFunction);
+    m_parameters.write(parameter.m_formula);
+    m_parameters.write(parameter.m_formulaUnit);
+    m_parameters.write(parameter.m_resultUnit);
+    m_parameters.write(static_cast<bool>(parameter.m_interpolation));
+    if (parameter.m_interpolation) {
+      std::ostringstream interpolation;
+      interpolation << std::setprecision(17) << *parameter.m_interpolation;
+      m_parameters.write(interpolation.str());
+    }
+    m_parameters.write(parameter.m_extractSingleValueAs);
+    m_parameters.write(parameter.m_eq);
+    m_parameters.write(parameter.m_angleConvertConst);
+    m_parameters.write(parameter.m_description);
+  }
+}
+
+/**
+ * Find the index of a shape, adding it to the shapes written if it is new
+ * @param shape :: A shape, may be null
+ * @return The index of the shape, or NONE for a null shape
+ * @throw std::runtime_error if the shape was not made from XML
+ */
+uint32_t Writer::shapeIndex(const boost::shared_ptr<const Object> &shape) {
+  if (!shape)
+    return NONE;
+  const auto found = m_shapeIndices.find(shape.get());
+  if (found != m_shapeIndices.end())
+    return found->second;
+  const auto &xml = shape->getShapeXML();
+  if (xml.empty() && shape->hasValidShape())
+    throw std::runtime_error("Shapes without an XML definition cannot be "
+                             "cached");
+  const auto index = static_cast<uint32_t>(m_shapeIndices.size());
+  m_shapeIndices.emplace(shape.get(), index);
+  m_shapes.write(xml);
+  m_shapes.write(static_cast<int32_t>(shape->getName()));
+  return index;
+}
+
+/**
+ * @param component :: A component of the instrument, may be null
+ * @return The index of the component in the order written, or NONE for null
+ * @throw std::runtime_error if the component is not in the tree
+ */
+uint32_t Writer::componentIndex(const IComponent *component) const {
+  if (!component)
+    return NONE;
+  const auto found = m_componentIndices.find(component);
+  if (found == m_componentIndices.end())
+    throw std::runtime_error("Instrument refers to a component outside of its "
+                             "tree");
+  return found->second;
+}
+
+/// Reads an instrument from the contents of a cache file
+class Reader {
+public:
+  Reader(const std::string &data, Instrument &instrument,
+         InstrumentCache::TypeShapes &typeShapes);
+  bool readHeader(const std::string &key);
+  void read();
+
+private:
+  void readInstrument();
+  IComponent *readComponent(ICompAssembly &parent, IComponent *generated);
+  void readChildren(ICompAssembly &assembly, bool generated);
+  void readMarks();
+  void readParameters();
+  boost::shared_ptr<Object> shape(uint32_t index) const;
+  IComponent *component(uint32_t index) const;
+
+  InputBuffer m_input;
+  Instrument &m_instrument;
+  InstrumentCache::TypeShapes &m_typeShapes;
+  std::vector<boost::shared_ptr<Object>> m_shapes;
+  std::vector<IComponent *> m_components;
+};
+
+Reader::Reader(const std::string &data, Instrument &instrument,
+               InstrumentCache::TypeShapes &typeShapes)
+    : m_input(data), m_instrument(instrument), m_typeShapes(typeShapes) {}
+
+/**
+ * Read the start of the file
+ * @param key :: Identifies the definition the instrument is wanted for
+ * @return True if the file holds the instrument wanted
+ * @throw std::runtime_error if the file is not an instrument cache
+ */
+bool Reader::readHeader(const std::string &key) {
+  if (m_input.readString() != MAGIC)
+    throw std::runtime_error("File is not an instrument cache");
+  return m_input.read<uint32_t>() == FORMAT_VERSION &&
+         m_input.readString() == key &&
+         m_input.readString() == Kernel::MantidVersion::revisionFull();
+}
+
+/// Read the rest of the file into the instrument
+void Reader::read() {
+  Geometry::ShapeFactory shapeFactory;
+  const auto numberOfShapes = m_input.readSize(1);
+  m_shapes.reserve(numberOfShapes);
+  for (size_t i = 0; i < numberOfShapes; ++i) {
+    const auto xml = m_input.readString();
+    // The XML includes the enclosing type element
+    auto shape = xml.empty() ? boost::make_shared<Object>()
+                             : shapeFactory.createShape(xml, false);
+    shape->setName(m_input.read<int32_t>());
+    m_shapes.push_back(shape);
+  }
+  const auto numberOfTypes = m_input.readSize(1);
+  for (size_t i = 0; i < numberOfTypes; ++i) {
+    auto name = m_input.readString();
+    m_typeShapes[name] = shape(m_input.read<uint32_t>());
+  }
+  readInstrument();
+  readMarks();
+  readParameters();
+  if (!m_input.atEnd())
+    throw std::runtime_error("Unexpected data at the end of instrument cache");
+}
+
+/// Read the properties and the component tree of the instrument
+void Reader::readInstrument() {
+  m_instrument.setValidFromDate(
+      Types::Core::DateAndTime(m_input.read<int64_t>()));
+  m_instrument.setValidToDate(
+      Types::Core::DateAndTime(m_input.read<int64_t>()));
+  m_instrument.setDefaultView(m_input.readString());
+  m_instrument.setDefaultViewAxis(m_input.readString());
+  const auto up = static_cast<PointingAlong>(m_input.read<uint8_t>());
+  const auto alongBeam = static_cast<PointingAlong>(m_input.read<uint8_t>());
+  const auto thetaSignVector = m_input.readV3D();
+  const auto thetaSign =
+      thetaSignVector.X() != 0.0 ? X : (thetaSignVector.Y() != 0.0 ? Y : Z);
+  const auto handedness = static_cast<Handedness>(m_input.read<uint8_t>());
+  const auto origin = m_input.readString();
+  m_instrument.setReferenceFrame(boost::make_shared<ReferenceFrame>(
+      up, alongBeam, thetaSign, handedness, origin));
+  auto &units = m_instrument.getLogfileUnit();
+  const auto numberOfUnits = m_input.readSize(2 * sizeof(uint64_t));
+  for (size_t i = 0; i < numberOfUnits; ++i) {
+    auto name = m_input.readString();
+    units[name] = m_input.readString();
+  }
+
+  m_components.push_back(&m_instrument);
+  m_instrument.setPos(m_input.readV3D());
+  m_instrument.setRot(m_input.readQuat());
+  readChildren(m_instrument, false);
+}
+
+/**
+ * Read a component and the components below it
+ * @param parent :: The assembly holding the component
+ * @param generated :: The component made by a detector bank, or null if the
+ * component is to be created
+ * @return The component
+ * @throw std::runtime_error if a generated component does not match the file
+ */
+IComponent *Reader::readComponent(ICompAssembly &parent,
+                                  IComponent *generated) {
+  const auto kind = m_input.read<Kind>();
+  const auto name = m_input.readString();
+  const auto position = m_input.readV3D();
+  const auto rotation = m_input.readQuat();
+  if (generated && (kindOf(*generated) != kind || generated->getName() != name))
+    throw std::runtime_error("Instrument cache does not match the components "
+                             "of detector bank " +
+                             parent.getName());
+
+  IComponent *component = generated;
+  switch (kind) {
+  case Kind::Component:
+    if (!component) {
+      component = new Component(name, &parent);
+      parent.add(component);
+    }
+    break;
+  case Kind::ObjComponent:
+    if (!component) {
+      component = new ObjComponent(name, shape(m_input.read<uint32_t>()),
+                                   &parent);
+      parent.add(component);
+    }
+    break;
+  case Kind::Detector:
+  case Kind::RectangularDetectorPixel: {
+    if (!component && kind == Kind::RectangularDetectorPixel)
+      throw std::runtime_error("Pixels outside a rectangular detector "
+                               "cannot be cached");
+    auto shapeOfDetector =
+        component ? nullptr : shape(m_input.read<uint32_t>());
+    const auto id = m_input.read<int32_t>();
+    if (!component) {
+      component = new Detector(name, id, shapeOfDetector, &parent);
+      parent.add(component);
+    } else if (dynamic_cast<Detector *>(component)->getID() != id) {
+      throw std::runtime_error("Instrument cache does not match the detector "
+                               "IDs of detector bank " +
+                               parent.getName());
+    }
+    break;
+  }
+  case Kind::CompAssembly: {
+    auto assembly = dynamic_cast<CompAssembly *>(component);
+    if (!assembly)
+      component = assembly = new CompAssembly(name, &parent);
+    readChildren(*assembly, generated != nullptr);
+    break;
+  }
+  case Kind::ObjCompAssembly: {
+    auto assembly = dynamic_cast<ObjCompAssembly *>(component);
+    if (!assembly) {
+      component = assembly = new ObjCompAssembly(name, &parent);
+      assembly->setOutline(shape(m_input.read<uint32_t>()));
+    }
+    readChildren(*assembly, generated != nullptr);
+    break;
+  }
+  case Kind::RectangularDetector: {
+    if (generated)
+      throw std::runtime_error("Nested detector banks cannot be cached");
+    auto bank = new RectangularDetector(name, &parent);
+    component = bank;
+    auto pixelShape = shape(m_input.read<uint32_t>());
+    const auto xpixels = m_input.read<int32_t>();
+    const auto xstart = m_input.read<double>();
+    const auto xstep = m_input.read<double>();
+    const auto ypixels = m_input.read<int32_t>();
+    const auto ystart = m_input.read<double>();
+    const auto ystep = m_input.read<double>();
+    const auto idstart = m_input.read<int32_t>();
+    const auto idfillbyfirst_y = m_input.readBool();
+    const auto idstepbyrow = m_input.read<int32_t>();
+    const auto idstep = m_input.read<int32_t>();
+    bank->initialize(pixelShape, xpixels, xstart, xstep, ypixels, ystart,
+                     ystep, idstart, idfillbyfirst_y, idstepbyrow, idstep);
+    readChildren(*bank, true);
+    break;
+  }
+  case Kind::StructuredDetector: {
+    if (generated)
+      throw std::runtime_error("Nested detector banks cannot be cached");
+    auto bank = new StructuredDetector(name, &parent);
+    component = bank;
+    const auto xPixels = m_input.read<uint64_t>();
+    const auto yPixels = m_input.read<uint64_t>();
+    const auto x = m_input.readDoubles();
+    const auto y = m_input.readDoubles();
+    const auto idStart = m_input.read<int32_t>();
+    const auto idFillByFirstY = m_input.readBool();
+    const auto idStepByRow = m_input.read<int32_t>();
+    const auto idStep = m_input.read<int32_t>();
+    const bool isZBeam =
+        m_instrument.getReferenceFrame()->isVectorPointingAlongBeam(
+            V3D(0, 0, 1));
+    bank->initialize(static_cast<size_t>(xPixels),
+                     static_cast<size_t>(yPixels), x, y, isZBeam, idStart,
+                     idFillByFirstY, idStepByRow, idStep);
+    readChildren(*bank, true);
+    break;
+  }
+  default:
+    throw std::runtime_error("Unknown component in instrument cache");
+  }
+  component->setPos(position);
+  component->setRot(rotation);
+  return component;
+}
+
+/**
+ * Read the children of an assembly
+ * @param assembly :: The assembly
+ * @param generated :: If true the children have already been made by a
+ * detector bank
+ */
+void Reader::readChildren(ICompAssembly &assembly, const bool generated) {
+  const auto count = m_input.read<uint32_t>();
+  if (generated && static_cast<int>(count) != assembly.nelements())
+    throw std::runtime_error("Instrument cache does not match the components "
+                             "of detector bank " +
+                             assembly.getName());
+  for (uint32_t i = 0; i < count; ++i) {
+    // Components are numbered in the order they are written, parents first
+    const auto index = m_components.size();
+    m_components.push_back(nullptr);
+    IComponent *child = generated ? assembly.getChild(i).get() : nullptr;
+    m_components[index] = readComponent(assembly, child);
+  }
+}
+
+/// Read the detectors, monitors, source, sample and chopper points
+void Reader::readMarks() {
+  const auto numberOfDetectors = m_input.readSize(sizeof(uint32_t) + 1);
+  std::vector<const IDetector *> monitors;
+  for (size_t i = 0; i < numberOfDetectors; ++i) {
+    const auto detector =
+        dynamic_cast<const IDetector *>(component(m_input.read<uint32_t>()));
+    const bool isMonitor = m_input.readBool();
+    if (!detector)
+      throw std::runtime_error("Instrument cache marks a component that is "
+                               "not a detector");
+    if (isMonitor)
+      monitors.push_back(detector);
+    else
+      m_instrument.markAsDetectorIncomplete(detector);
+  }
+  m_instrument.markAsDetectorFinalize();
+  for (const auto monitor : monitors)
+    m_instrument.markAsMonitor(monitor);
+
+  const auto source = m_input.read<uint32_t>();
+  if (source != NONE)
+    m_instrument.markAsSource(component(source));
+  const auto sample = m_input.read<uint32_t>();
+  if (sample != NONE)
+    m_instrument.markAsSamplePos(component(sample));
+  const auto numberOfChopperPoints = m_input.readSize(sizeof(uint32_t));
+  for (size_t i = 0; i < numberOfChopperPoints; ++i) {
+    const auto chopper =
+        dynamic_cast<const ObjComponent *>(component(m_input.read<uint32_t>()));
+    if (!chopper)
+      throw std::runtime_error("Instrument cache marks a component that is "
+                               "not a chopper point");
+    m_instrument.markAsChopperPoint(chopper);
+  }
+}
+
+/// Read the parameters of the instrument definition
+void Reader::readParameters() {
+  auto &parameters = m_instrument.getLogfileCache();
+  const auto numberOfParameters = m_input.readSize(1);
+  for (size_t i = 0; i < numberOfParameters; ++i) {
+    const auto name = m_input.readString();
+    const auto keyComponent = component(m_input.read<uint32_t>());
+    const auto parameterComponent = component(m_input.read<uint32_t>());
+    const auto logfileID = m_input.readString();
+    const auto value = m_input.readString();
+    const auto paramName = m_input.readString();
+    const auto type = m_input.readString();
+    const auto tie = m_input.readString();
+    std::vector<std::string> constraint(m_input.readSize(sizeof(uint64_t)));
+    for (auto &item : constraint)
+      item = m_input.readString();
+    auto penaltyFactor = m_input.readString();
+    const auto fittingFunction = m_input.readString();
+    const auto formula = m_input.readString();
+    const auto formulaUnit = m_input.readString();
+    const auto resultUnit = m_input.readString();
+    boost::shared_ptr<Kernel::Interpolation> interpolation;
+    if (m_input.readBool()) {
+      interpolation = boost::make_shared<Kernel::Interpolation>();
+      std::istringstream stream(m_input.readString());
+      stream >> *interpolation;
+    }
+    const auto extractSingleValueAs = m_input.readString();
+    const auto eq = m_input.readString();
+    const auto angleConvertConst = m_input.read<double>();
+    const auto description = m_input.readString();
+    parameters[std::make_pair(name, keyComponent)] =
+        boost::make_shared<XMLInstrumentParameter>(
+            logfileID, value, interpolation, formula, formulaUnit, resultUnit,
+            paramName, type, tie, constraint, penaltyFactor, fittingFunction,
+            extractSingleValueAs, eq, parameterComponent, angleConvertConst,
+            description);
+  }
+}
+
+/**
+ * @param index :: Index of a shape in the file, or NONE
+ * @return The shape, or null for NONE
+ */
+boost::shared_ptr<Object> Reader::shape(const uint32_t index) const {
+  if (index == NONE)
+    return nullptr;
+  if (index >= m_shapes.size())
+    throw std::runtime_error("Instrument cache refers to an unknown shape");
+  return m_shapes[index];
+}
+
+/**
+ * @param index :: Index of a component read, or NONE
+ * @return The component, or null for NONE
+ */
+IComponent *Reader::component(const uint32_t index) const {
+  if (index == NONE)
+    return nullptr;
+  if (index >= m_components.size() || !m_components[index])
+    throw std::runtime_error("Instrument cache refers to an unknown component");
+  return m_components[index];
+}
+} // namespace
+
+namespace InstrumentCache {
+
+/**
+ * Write an instrument to a cache file. The file is written under a temporary
+ * name and then renamed, so that it is never read while incomplete.
+ * @param filename :: The path of the cache file
+ * @param key :: Identifies the definition the instrument was built from
+ * @param instrument :: The instrument, as built from the definition
+ * @param typeShapes :: The shapes of the types in the definition, stored so
+ * that they can be given back by load
+ * @throw std::runtime_error if the instrument cannot be cached or the file
+ * cannot be written
+ */
+void save(const std::string &filename, const std::string &key,
+          const Instrument &instrument, const TypeShapes &typeShapes) {
+  const auto contents = Writer(instrument, typeShapes).contents(key);
+
+  std::ostringstream temporaryName;
+  temporaryName << filename << '.' << Poco::Process::id() << '.'
+                << std::this_thread::get_id() << ".tmp";
+  const auto temporary = temporaryName.str();
+  {
+    std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+    file.write(contents.data(),
+               static_cast<std::streamsize>(contents.size()));
+    if (!file)
+      throw std::runtime_error("Unable to write instrument cache " +
+                               temporary);
+  }
+  try {
+    Poco::File(temporary).renameTo(filename);
+  } catch (Poco::Exception &exc) {
+    Poco::File(temporary).remove();
+    throw std::runtime_error("Unable to write instrument cache " + filename +
+                             ": " + exc.displayText());
+  }
+}
+
+/**
+ * Read an instrument from a cache file, if the file holds the instrument
+ * wanted. The whole file is read at once.
+ * @param filename :: The path of the cache file
+ * @param key :: Identifies the definition the instrument is wanted for
+ * @param instrument :: An empty instrument to read into. Its name, filename
+ * and XML text are not stored in the cache and must already be set.
+ * @param typeShapes :: Filled with the shapes of the types in the definition
+ * @return False if the file does not exist or was made for a different
+ * definition or version of Mantid
+ * @throw std::runtime_error if the file cannot be read. The instrument may
+ * then be partly filled.
+ */
+bool load(const std::string &filename, const std::string &key,
+          Instrument &instrument, TypeShapes &typeShapes) {
+  std::ifstream file(filename, std::ios::binary);
+  if (!file)
+    return false;
+  file.seekg(0, std::ios::end);
+  const auto size = static_cast<std::streamoff>(file.tellg());
+  if (size < 0)
+    throw std::runtime_error("Unable to read instrument cache " + filename);
+  std::string contents(static_cast<size_t>(size), '\0');
+  file.seekg(0, std::ios::beg);
+  file.read(&contents[0], size);
+  if (!file)
+    throw std::runtime_error("Unable to read instrument cache " + filename);
+
+  Reader reader(contents, instrument, typeShapes);
+  if (!reader.readHeader(key))
+    return false;
+  reader.read();
+  return true;
+}
+} // namespace InstrumentCache
+
+} // namespace Geometry
+} // namespace Mantid
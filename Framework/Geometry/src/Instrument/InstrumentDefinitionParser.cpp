@@ -2,6 +2,7 @@
 #include <sstream>
 
 #include "MantidGeometry/Instrument/Detector.h"
+#include "MantidGeometry/Instrument/InstrumentCache.h"
 #include "MantidGeometry/Instrument/InstrumentDefinitionParser.h"
 #include "MantidGeometry/Instrument/ObjCompAssembly.h"
 #include "MantidGeometry/Instrument/RectangularDetector.h"
@@ -26,6 +27,7 @@
 #include <Poco/DOM/NodeFilter.h>
 #include <Poco/DOM/NodeIterator.h>
 #include <Poco/DOM/NodeList.h>
+#include <Poco/File.h>
 #include <Poco/Path.h>
 #include <Poco/SAX/AttributesImpl.h>
 #include <Poco/String.h>
@@ -222,6 +224,12 @@ void InstrumentDefinitionParser::throwIfTypeNameNotUnique(
  */
 Instrument_sptr
 InstrumentDefinitionParser::parseXML(Kernel::ProgressBase *progressReporter) {
+  // An instrument built from the same XML before need not be parsed again
+  if (loadInstrumentCache()) {
+    m_cachingOption = setupGeometryCache();
+    return m_instrument;
+  }
+
   auto pDoc = getDocument();
 
   // Get pointer to root element
@@ -279,6 +287,8 @@ InstrumentDefinitionParser::parseXML(Kernel::ProgressBase *progressReporter) {
   // (which does the final sorting).
   m_instrument->markAsDetectorFinalize();
 
+  saveInstrumentCache();
+
   // And give back what we created
   return m_instrument;
 }
@@ -2536,6 +2546,75 @@ InstrumentDefinitionParser::setupGeometryCache() {
   return cachingOption;
 }
 
+/** The binary instrument cache is kept next to the geometry cache, or in the
+temporary directory if that is read only.
+@param mangledName :: The mangled name of the instrument
+@return The paths the cache may be at, the preferred one first. Empty if the
+instrument has no mangled name.
+*/
+std::vector<std::string> InstrumentDefinitionParser::instrumentCacheFileNames(
+    const std::string &mangledName) const {
+  if (mangledName.empty())
+    return {};
+  Poco::Path path(ConfigService::Instance().getVTPFileDirectory());
+  path.makeDirectory();
+  path.append(mangledName + ".instcache");
+  Poco::Path fallBack(ConfigService::Instance().getTempDir());
+  fallBack.makeDirectory();
+  fallBack.append(mangledName + ".instcache");
+  return {path.toString(), fallBack.toString()};
+}
+
+/** Reads the instrument from the binary instrument cache, in place of parsing
+the XML. A cache that cannot be read is ignored.
+@return True if the instrument was read from the cache
+*/
+bool InstrumentDefinitionParser::loadInstrumentCache() {
+  const std::string key = getMangledName();
+  for (const auto &filename : instrumentCacheFileNames(key)) {
+    // Read into a new instrument, so that a bad cache leaves no trace
+    auto instrument = boost::make_shared<Instrument>(m_instrument->getName());
+    instrument->setFilename(m_instrument->getFilename());
+    instrument->setXmlText(m_instrument->getXmlText());
+    std::map<std::string, boost::shared_ptr<Geometry::Object>> shapes;
+    try {
+      if (!InstrumentCache::load(filename, key, *instrument, shapes))
+        continue;
+    } catch (std::exception &exc) {
+      g_log.warning() << "Unable to read instrument cache " << filename
+                      << ": " << exc.what() << '\n';
+      continue;
+    }
+    g_log.information("Loaded instrument from cache " + filename);
+    m_instrument = instrument;
+    mapTypeNameToShape.swap(shapes);
+    return true;
+  }
+  return false;
+}
+
+/** Writes the instrument to the binary instrument cache, so that it is not
+parsed again. Failing to write the cache does not stop the instrument being
+used.
+*/
+void InstrumentDefinitionParser::saveInstrumentCache() {
+  const std::string key = getMangledName();
+  const auto filenames = instrumentCacheFileNames(key);
+  if (filenames.empty())
+    return;
+  std::string filename = filenames.front();
+  Poco::File dir(Poco::Path(filename).parent());
+  if (!dir.exists() || !dir.canWrite())
+    filename = filenames.back();
+  try {
+    InstrumentCache::save(filename, key, *m_instrument, mapTypeNameToShape);
+    g_log.information("Created instrument cache " + filename);
+  } catch (std::exception &exc) {
+    g_log.information() << "Instrument cache not written: " << exc.what()
+                        << '\n';
+  }
+}
+
 /**
 Getter for the applied caching option.
 @return selected caching.
@@ -759,17 +759,13 @@ bool ParameterMap::contains(const IComponent *comp,
     return false;
 
   const ComponentID id = comp->getComponentID();
-  auto it_found = m_map.find(id);
-  if (it_found != m_map.end()) {
-    auto itrs = m_map.equal_range(id);
-    for (auto itr = itrs.first; itr != itrs.second; ++itr) {
-      const Parameter_sptr &param = itr->second;
-      if (*param == parameter)
-        return true;
-    }
-    return false;
-  } else
-    return false;
+  auto itrs = m_map.equal_range(id);
+  for (auto itr = itrs.first; itr != itrs.second; ++itr) {
+    const Parameter_sptr &param = itr->second;
+    if (*param == parameter)
+      return true;
+  }
+  return false;
 }
 
 /** Return a named parameter of a given type
@@ -821,17 +817,13 @@ component_map_it ParameterMap::positionOf(const IComponent *comp,
     return result;
   const bool anytype = (strlen(type) == 0);
   if (!m_map.empty()) {
-    const ComponentID id = comp->getComponentID();
-    auto it_found = m_map.find(id);
-    if (it_found != m_map.end()) {
-      auto itrs = m_map.equal_range(id);
-      for (auto itr = itrs.first; itr != itrs.second; ++itr) {
-        const auto &param = itr->second;
-        if (strcasecmp(param->nameAsCString(), name) == 0 &&
-            (anytype || param->type() == type)) {
-          result = itr;
-          break;
-        }
+    auto itrs = m_map.equal_range(comp->getComponentID());
+    for (auto itr = itrs.first; itr != itrs.second; ++itr) {
+      const auto &param = itr->second;
+      if (strcasecmp(param->nameAsCString(), name) == 0 &&
+          (anytype || param->type() == type)) {
+        result = itr;
+        break;
       }
     }
   }
@@ -853,17 +845,13 @@ component_map_cit ParameterMap::positionOf(const IComponent *comp,
     return result;
   const bool anytype = (strlen(type) == 0);
   if (!m_map.empty()) {
-    const ComponentID id = comp->getComponentID();
-    auto it_found = m_map.find(id);
-    if (it_found != m_map.end()) {
-      auto itrs = m_map.equal_range(id);
-      for (auto itr = itrs.first; itr != itrs.second; ++itr) {
-        const auto &param = itr->second;
-        if (strcasecmp(param->nameAsCString(), name) == 0 &&
-            (anytype || param->type() == type)) {
-          result = itr;
-          break;
-        }
+    auto itrs = m_map.equal_range(comp->getComponentID());
+    for (auto itr = itrs.first; itr != itrs.second; ++itr) {
+      const auto &param = itr->second;
+      if (strcasecmp(param->nameAsCString(), name) == 0 &&
+          (anytype || param->type() == type)) {
+        result = itr;
+        break;
       }
     }
   }
@@ -878,20 +866,17 @@ component_map_cit ParameterMap::positionOf(const IComponent *comp,
 Parameter_sptr ParameterMap::getByType(const IComponent *comp,
                                        const std::string &type) const {
   Parameter_sptr result;
-  if (!m_map.empty()) {
-    const ComponentID id = comp->getComponentID();
-    auto it_found = m_map.find(id);
-    if (it_found != m_map.end() && it_found->first) {
-      auto itrs = m_map.equal_range(id);
-      for (auto itr = itrs.first; itr != itrs.second; ++itr) {
-        const auto &param = itr->second;
-        if (strcasecmp(param->type().c_str(), type.c_str()) == 0) {
-          result = boost::atomic_load(&param);
-          break;
-        }
-      } // found->firdst
-    }   // it_found != m_map.end()
-  }     //! m_map.empty()
+  const ComponentID id = comp->getComponentID();
+  if (!m_map.empty() && id) {
+    auto itrs = m_map.equal_range(id);
+    for (auto itr = itrs.first; itr != itrs.second; ++itr) {
+      const auto &param = itr->second;
+      if (strcasecmp(param->type().c_str(), type.c_str()) == 0) {
+        result = boost::atomic_load(&param);
+        break;
+      }
+    }
+  }
   return result;
 }
 
@@ -903,13 +888,15 @@ Parameter_sptr ParameterMap::getByType(const IComponent *comp,
 */
 Parameter_sptr ParameterMap::getRecursiveByType(const IComponent *comp,
                                                 const std::string &type) const {
-  boost::shared_ptr<const IComponent> compInFocus(comp, NoDeleting());
-  while (compInFocus != nullptr) {
-    Parameter_sptr param = getByType(compInFocus.get(), type);
+  // Parameters are stored against the base components, so walk up the base
+  // tree rather than creating a parametrized parent at each level
+  const IComponent *compInFocus = comp->getComponentID();
+  while (compInFocus) {
+    Parameter_sptr param = getByType(compInFocus, type);
     if (param) {
       return param;
     }
-    compInFocus = compInFocus->getParent();
+    compInFocus = compInFocus->getBareParent();
   }
   // Nothing was found!
   return Parameter_sptr();
@@ -941,20 +928,61 @@ Parameter_sptr ParameterMap::getRecursive(const IComponent *comp,
                                           const char *name,
                                           const char *type) const {
   checkIsNotMaskingParameter(name);
-  Parameter_sptr result = this->get(comp->getComponentID(), name, type);
-  if (result)
-    return result;
-
-  auto parent = comp->getParent();
-  while (parent) {
-    result = this->get(parent->getComponentID(), name, type);
+  Parameter_sptr result;
+  // Parameters are stored against the base components, so walk up the base
+  // tree rather than creating a parametrized parent at each level
+  const IComponent *current = comp->getComponentID();
+  while (current) {
+    result = this->get(current, name, type);
     if (result)
       return result;
-    parent = parent->getParent();
+    current = current->getBareParent();
   }
   return result;
 }
 
+/**
+ * Find a parameter by name for every detector of the instrument, going up
+ * the component tree as getRecursive() does. Each component shared by several
+ * detectors, such as a tube or a bank, is searched only once, which makes
+ * this much quicker than calling getRecursive() for each detector.
+ * @param name :: Parameter name
+ * @param type :: An optional type string
+ * @returns the first matching parameter of each detector, by detector index.
+ * Detectors without the parameter get a NULL shared pointer.
+ * @throw std::runtime_error if the map has no ComponentInfo
+ */
+std::vector<Parameter_sptr>
+ParameterMap::getRecursiveForDetectors(const std::string &name,
+                                       const std::string &type) const {
+  checkIsNotMaskingParameter(name);
+  const auto &info = componentInfo();
+  // Detectors come first in the component indices
+  const size_t numberOfDetectors = detectorInfo().size();
+
+  std::vector<Parameter_sptr> found(info.size());
+  std::vector<bool> searched(info.size(), false);
+  std::vector<size_t> unresolved;
+  for (size_t detector = 0; detector < numberOfDetectors; ++detector) {
+    // Go up until a parameter or an already searched component is found
+    size_t index = detector;
+    unresolved.clear();
+    while (!searched[index]) {
+      searched[index] = true;
+      found[index] =
+          this->get(info.componentID(index), name.c_str(), type.c_str());
+      if (found[index] || !info.hasParent(index))
+        break;
+      unresolved.push_back(index);
+      index = info.parent(index);
+    }
+    for (const auto component : unresolved)
+      found[component] = found[index];
+  }
+  found.resize(numberOfDetectors);
+  return found;
+}
+
 /**
  * Return the value of a parameter as a string
  * @param comp :: Component to which parameter is related
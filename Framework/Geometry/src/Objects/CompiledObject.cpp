@@ -0,0 +1,529 @@
+#include "MantidGeometry/Objects/CompiledObject.h"
+#include "MantidGeometry/Objects/Object.h"
+#include "MantidGeometry/Objects/Rules.h"
+#include "MantidGeometry/Objects/Track.h"
+#include "MantidGeometry/Surfaces/Cylinder.h"
+#include "MantidGeometry/Surfaces/Plane.h"
+#include "MantidGeometry/Surfaces/Quadratic.h"
+#include "MantidGeometry/Surfaces/Sphere.h"
+#include "MantidKernel/Tolerance.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Mantid {
+namespace Geometry {
+using Kernel::Tolerance;
+using Kernel::V3D;
+
+const size_t CompiledObject::MaxCrossings;
+
+struct CompiledObject::Crossing {
+  V3D point;       ///< Where the ray crosses the surface
+  double distance; ///< The distance of the point from the start of the ray
+  int flag;        ///< 1 if the ray enters the object, -1 if it leaves it
+};
+
+namespace {
+/// Number of rays traced together by the batched trace
+const size_t BLOCK_SIZE = 16;
+
+/// A segment of a ray, as indices of the crossings that bound it
+struct Leg {
+  int entry; ///< Index of the entry crossing, or -1 for the start of the ray
+  int exit;  ///< Index of the exit crossing
+};
+
+/**
+ * Find the positive real roots of a quadratic, in the order and with the
+ * rejection of repeated roots of Line::intersect.
+ * @param a :: coefficient of the square term
+ * @param b :: coefficient of the linear term
+ * @param c :: constant term
+ * @param roots :: two roots are stored here
+ * @return the number of roots stored
+ */
+size_t positiveRoots(const double a, const double b, const double c,
+                     double *roots) {
+  double first, second;
+  bool single;
+  if (a == 0.0) {
+    if (b == 0.0)
+      return 0;
+    first = second = -c / b;
+    single = true;
+  } else {
+    const double cf = b * b - 4 * a * c;
+    if (cf < 0)
+      return 0;
+    const double q = (b >= 0) ? -0.5 * (b + sqrt(cf)) : -0.5 * (b - sqrt(cf));
+    first = q / a;
+    second = c / q;
+    single = (cf == 0);
+  }
+  size_t count(0);
+  if (first >= 0.0) {
+    roots[count++] = first;
+    if (single)
+      return count;
+  }
+  if (second >= 0.0) {
+    // Points closer than the tolerance are the same point
+    if (count == 0 || std::abs(second - first) >= Tolerance)
+      roots[count++] = second;
+  }
+  return count;
+}
+
+/**
+ * Pair the crossings of a ray into the legs inside the object, in the same
+ * way as Track::buildLink.
+ * @param crossings :: the crossings, ordered along the ray
+ * @param count :: the number of crossings
+ * @param legs :: the legs are stored here
+ * @return the number of legs stored
+ */
+template <typename Crossing>
+size_t buildLegs(const Crossing *crossings, const size_t count, Leg *legs) {
+  size_t numLegs(0);
+  size_t ac(0);
+  // Leaving the object before entering it means the ray starts inside
+  while (ac < count && crossings[ac].flag != 1) {
+    if (crossings[ac].flag == -1)
+      legs[numLegs++] = Leg{-1, static_cast<int>(ac)};
+    ++ac;
+  }
+  if (ac == count)
+    return numLegs;
+  size_t work(ac);
+  size_t bc(ac + 1);
+  while (bc < count) {
+    if (crossings[ac].flag == 1 && crossings[bc].flag == -1) {
+      if (std::abs(crossings[ac].distance - crossings[bc].distance) >
+          Tolerance)
+        legs[numLegs++] = Leg{static_cast<int>(ac), static_cast<int>(bc)};
+      else // Touching surfaces
+        legs[numLegs++] = Leg{static_cast<int>(work), static_cast<int>(ac)};
+      work = bc;
+      ac += 2;
+      bc += 2;
+    } else { // Glancing points or void edges
+      ++ac;
+      ++bc;
+    }
+  }
+  return numLegs;
+}
+} // namespace
+
+/**
+ * Compile an object
+ * @param object :: the object to compile. It must outlive the result.
+ * @return the compiled object, or a null pointer if the object has surfaces
+ * that cannot be compiled
+ */
+std::unique_ptr<CompiledObject> CompiledObject::compile(const Object &object) {
+  const auto &surfaces = object.getSurfacePtr();
+  if (!object.topRule() || surfaces.empty())
+    return nullptr;
+  std::unique_ptr<CompiledObject> compiled(new CompiledObject(object));
+  if (!compiled->compileSurfaces(surfaces) ||
+      !compiled->compileRule(object.topRule(), surfaces))
+    return nullptr;
+  return compiled;
+}
+
+/// @param object :: the object that is compiled
+CompiledObject::CompiledObject(const Object &object) : m_object(object) {}
+
+/**
+ * Store the data of each surface needed to intersect it with rays
+ * @param surfaces :: the surfaces of the object
+ * @return false if a surface is not quadratic or there are too many surfaces
+ */
+bool CompiledObject::compileSurfaces(
+    const std::vector<const Surface *> &surfaces) {
+  size_t maxCrossings(0);
+  m_surfaces.reserve(surfaces.size());
+  for (const auto surface : surfaces) {
+    CompiledSurface compiled;
+    compiled.surface = surface;
+    compiled.value = 0.;
+    compiled.coefficients.fill(0.);
+    if (const auto plane = dynamic_cast<const Plane *>(surface)) {
+      compiled.kind = CompiledSurface::Kind::Plane;
+      compiled.vector = plane->getNormal();
+      compiled.value = plane->getDistance();
+      maxCrossings += 1;
+    } else if (const auto sphere = dynamic_cast<const Sphere *>(surface)) {
+      compiled.kind = CompiledSurface::Kind::Sphere;
+      compiled.vector = sphere->getCentre();
+      compiled.value = sphere->getRadius();
+      maxCrossings += 2;
+    } else if (const auto cylinder = dynamic_cast<const Cylinder *>(surface)) {
+      compiled.kind = CompiledSurface::Kind::Cylinder;
+      compiled.vector = cylinder->getCentre();
+      compiled.axis = cylinder->getNormal();
+      compiled.value = cylinder->getRadius();
+      maxCrossings += 2;
+    } else if (const auto quadratic = dynamic_cast<const Quadratic *>(surface)) {
+      compiled.kind = CompiledSurface::Kind::Quadratic;
+      const auto &coefficients = quadratic->copyBaseEqn();
+      std::copy(coefficients.begin(), coefficients.end(),
+                compiled.coefficients.begin());
+      maxCrossings += 2;
+    } else {
+      return false;
+    }
+    m_surfaces.push_back(compiled);
+  }
+  return maxCrossings <= MaxCrossings;
+}
+
+/**
+ * Append a rule and its leaves to the flattened tree
+ * @param rule :: the rule to append
+ * @param surfaces :: the surfaces of the object, sorted by address
+ * @return false if the rule is of an unknown type
+ */
+bool CompiledObject::compileRule(const Rule *rule,
+                                 const std::vector<const Surface *> &surfaces) {
+  Node node{Node::Type::Constant, 0, 0, nullptr};
+  if (!rule) {
+    // A missing leaf is never valid
+    m_nodes.push_back(node);
+    return true;
+  }
+  if (const auto point = dynamic_cast<const SurfPoint *>(rule)) {
+    const Surface *key = point->getKey();
+    const auto found = std::lower_bound(surfaces.begin(), surfaces.end(), key);
+    if (key && found != surfaces.end() && *found == key) {
+      node.type = Node::Type::Surface;
+      node.sign = point->getSign();
+      node.index = static_cast<size_t>(found - surfaces.begin());
+    }
+    m_nodes.push_back(node);
+    return true;
+  }
+  if (const auto group = dynamic_cast<const CompGrp *>(rule)) {
+    node.type = Node::Type::Complement;
+    m_nodes.push_back(node);
+    if (group->leaf(0))
+      return compileRule(group->leaf(0), surfaces);
+    // The complement of nothing is everything
+    m_nodes.back() = Node{Node::Type::Constant, 1, 0, nullptr};
+    return true;
+  }
+  if (const auto object = dynamic_cast<const CompObj *>(rule)) {
+    if (object->getObj())
+      node = Node{Node::Type::ComplementObject, 0, 0, object->getObj()};
+    else
+      node.sign = 1;
+    m_nodes.push_back(node);
+    return true;
+  }
+  if (dynamic_cast<const BoolValue *>(rule)) {
+    node.sign = rule->isValid(V3D()) ? 1 : 0;
+    m_nodes.push_back(node);
+    return true;
+  }
+  if (dynamic_cast<const Intersection *>(rule))
+    node.type = Node::Type::Intersection;
+  else if (dynamic_cast<const Union *>(rule))
+    node.type = Node::Type::Union;
+  else
+    return false;
+  const size_t parent = m_nodes.size();
+  m_nodes.push_back(node);
+  if (!compileRule(rule->leaf(0), surfaces))
+    return false;
+  m_nodes[parent].index = m_nodes.size();
+  return compileRule(rule->leaf(1), surfaces);
+}
+
+/**
+ * Evaluate the flattened rule tree at a point, as Rule::isValid does
+ * @param node :: the index of the node to evaluate
+ * @param point :: the point to test
+ * @return true if the point satisfies the rule at node
+ */
+bool CompiledObject::evaluate(const size_t node, const V3D &point) const {
+  const Node &rule = m_nodes[node];
+  switch (rule.type) {
+  case Node::Type::Intersection:
+    return evaluate(node + 1, point) && evaluate(rule.index, point);
+  case Node::Type::Union:
+    return evaluate(node + 1, point) || evaluate(rule.index, point);
+  case Node::Type::Surface:
+    return side(m_surfaces[rule.index], point) * rule.sign >= 0;
+  case Node::Type::Complement:
+    return !evaluate(node + 1, point);
+  case Node::Type::ComplementObject:
+    return !rule.object->isValid(point);
+  case Node::Type::Constant:
+    return rule.sign > 0;
+  }
+  return false;
+}
+
+/**
+ * Find the side of a surface a point is on
+ * @param surface :: the surface
+ * @param point :: the point to test
+ * @return 1 if the point is outside the surface, -1 if it is inside it and 0
+ * if it is on the surface
+ */
+int CompiledObject::side(const CompiledSurface &surface,
+                         const V3D &point) const {
+  switch (surface.kind) {
+  case CompiledSurface::Kind::Plane: {
+    const double displace = surface.vector.scalar_prod(point) - surface.value;
+    if (Tolerance < std::abs(displace))
+      return (displace > 0) ? 1 : -1;
+    return 0;
+  }
+  case CompiledSurface::Kind::Sphere: {
+    const double displace = point.distance(surface.vector) - surface.value;
+    if (std::abs(displace) < Tolerance)
+      return 0;
+    return (displace > 0.0) ? 1 : -1;
+  }
+  default:
+    return surface.surface->side(point);
+  }
+}
+
+/**
+ * Find where a ray crosses a surface ahead of its start
+ * @param surface :: the surface
+ * @param start :: the start of the ray
+ * @param unit :: the direction of the ray as a unit vector
+ * @param distances :: up to two distances along the ray are stored here
+ * @return the number of distances stored
+ */
+size_t CompiledObject::intersect(const CompiledSurface &surface,
+                                 const V3D &start, const V3D &unit,
+                                 double *distances) const {
+  switch (surface.kind) {
+  case CompiledSurface::Kind::Plane: {
+    const double startDotN = start.scalar_prod(surface.vector);
+    const double unitDotN = unit.scalar_prod(surface.vector);
+    if (std::abs(unitDotN) < Tolerance) // Parallel to the plane
+      return 0;
+    const double distance = (surface.value - startDotN) / unitDotN;
+    if (distance <= 0)
+      return 0;
+    distances[0] = distance;
+    return 1;
+  }
+  case CompiledSurface::Kind::Sphere: {
+    const V3D fromCentre = start - surface.vector;
+    return positiveRoots(1.0, 2.0 * fromCentre.scalar_prod(unit),
+                         fromCentre.scalar_prod(fromCentre) -
+                             surface.value * surface.value,
+                         distances);
+  }
+  case CompiledSurface::Kind::Cylinder: {
+    const V3D fromCentre = start - surface.vector;
+    const double unitDotN = surface.axis.scalar_prod(unit);
+    const double centreDotN = surface.axis.scalar_prod(fromCentre);
+    return positiveRoots(1.0 - unitDotN * unitDotN,
+                         2.0 * (fromCentre.scalar_prod(unit) -
+                                centreDotN * unitDotN),
+                         fromCentre.scalar_prod(fromCentre) -
+                             (surface.value * surface.value +
+                              centreDotN * centreDotN),
+                         distances);
+  }
+  case CompiledSurface::Kind::Quadratic: {
+    const auto &c = surface.coefficients;
+    const double a(start[0]), b(start[1]), z(start[2]);
+    const double d(unit[0]), e(unit[1]), f(unit[2]);
+    return positiveRoots(
+        c[0] * d * d + c[1] * e * e + c[2] * f * f + c[3] * d * e +
+            c[4] * d * f + c[5] * e * f,
+        2 * c[0] * a * d + 2 * c[1] * b * e + 2 * c[2] * z * f +
+            c[3] * (a * e + b * d) + c[4] * (a * f + z * d) +
+            c[5] * (b * f + z * e) + c[6] * d + c[7] * e + c[8] * f,
+        c[0] * a * a + c[1] * b * b + c[2] * z * z + c[3] * a * b +
+            c[4] * a * z + c[5] * b * z + c[6] * a + c[7] * b + c[8] * z +
+            c[9],
+        distances);
+  }
+  }
+  return 0;
+}
+
+/**
+ * Classify the points where a ray crosses the surfaces and order them along
+ * the ray, as Object::interceptSurface and Track::addPoint do
+ * @param start :: the start of the ray
+ * @param unit :: the direction of the ray as a unit vector
+ * @param direction :: the direction of the ray as given
+ * @param distances :: the distances of the points along the ray
+ * @param count :: the number of distances
+ * @param crossings :: the ordered crossings are stored here
+ * @return the number of crossings stored
+ */
+size_t CompiledObject::findCrossings(const V3D &start, const V3D &unit,
+                                     const V3D &direction,
+                                     const double *distances,
+                                     const size_t count,
+                                     Crossing *crossings) const {
+  size_t numCrossings(0);
+  for (size_t i = 0; i < count; ++i) {
+    const V3D point = start + unit * distances[i];
+    const double distance = point.distance(start);
+    if (distance <= 0.0)
+      continue;
+    const Crossing crossing{point, distance, calcValidType(point, direction)};
+    // Crossings within the tolerance are ordered by their flags
+    auto before = [&crossing](const Crossing &other) {
+      const double diff = std::abs(other.distance - crossing.distance);
+      return (diff > Tolerance) ? other.distance < crossing.distance
+                                : other.flag < crossing.flag;
+    };
+    size_t position(0);
+    while (position < numCrossings && before(crossings[position]))
+      ++position;
+    std::copy_backward(crossings + position, crossings + numCrossings,
+                       crossings + numCrossings + 1);
+    crossings[position] = crossing;
+    ++numCrossings;
+  }
+  return numCrossings;
+}
+
+/**
+ * Trace up to BLOCK_SIZE rays. Each surface is intersected with all rays
+ * before moving on to the next.
+ * @param starts :: the starts of the rays
+ * @param directions :: the directions of the rays
+ * @param count :: the number of rays
+ * @param segments :: the segments of each ray are stored here
+ */
+void CompiledObject::traceBlock(const V3D *starts, const V3D *directions,
+                                const size_t count,
+                                Segments *segments) const {
+  std::array<V3D, BLOCK_SIZE> units;
+  std::array<std::array<double, MaxCrossings>, BLOCK_SIZE> distances;
+  std::array<size_t, BLOCK_SIZE> numDistances;
+  for (size_t ray = 0; ray < count; ++ray) {
+    units[ray] = directions[ray];
+    units[ray].normalize();
+    numDistances[ray] = 0;
+  }
+  for (const auto &surface : m_surfaces) {
+    for (size_t ray = 0; ray < count; ++ray) {
+      numDistances[ray] +=
+          intersect(surface, starts[ray], units[ray],
+                    distances[ray].data() + numDistances[ray]);
+    }
+  }
+  std::array<Crossing, MaxCrossings> crossings;
+  std::array<Leg, MaxCrossings> legs;
+  for (size_t ray = 0; ray < count; ++ray) {
+    const size_t numCrossings =
+        findCrossings(starts[ray], units[ray], directions[ray],
+                      distances[ray].data(), numDistances[ray],
+                      crossings.data());
+    const size_t numLegs =
+        buildLegs(crossings.data(), numCrossings, legs.data());
+    segments[ray].clear();
+    for (size_t i = 0; i < numLegs; ++i) {
+      const auto &leg = legs[i];
+      const double entry =
+          leg.entry < 0 ? 0. : crossings[leg.entry].distance;
+      segments[ray].push_back(Segment{entry, crossings[leg.exit].distance});
+    }
+  }
+}
+
+/**
+ * @param point :: the point to test
+ * @return true if the point is inside the object or on its surface
+ */
+bool CompiledObject::isValid(const V3D &point) const {
+  return evaluate(0, point);
+}
+
+/**
+ * Find whether a ray enters or leaves the object at a point on its surface
+ * @param point :: the point on the surface
+ * @param direction :: the direction of the ray
+ * @retval 1 :: the ray enters the object
+ * @retval -1 :: the ray leaves the object
+ * @retval 0 :: neither, e.g. the ray grazes the surface
+ */
+int CompiledObject::calcValidType(const V3D &point,
+                                  const V3D &direction) const {
+  const V3D shift(direction * Tolerance * 25.0);
+  const bool before = isValid(point - shift);
+  const bool after = isValid(point + shift);
+  if (before == after)
+    return 0;
+  return before ? -1 : 1;
+}
+
+/**
+ * Add the links of a track inside the object to the track, as
+ * Object::interceptSurface does
+ * @param track :: the track
+ * @return the number of links added
+ */
+int CompiledObject::interceptSurface(Track &track) const {
+  const V3D &start = track.startPoint();
+  const V3D &direction = track.direction();
+  V3D unit(direction);
+  unit.normalize();
+  std::array<double, MaxCrossings> distances;
+  size_t numDistances(0);
+  for (const auto &surface : m_surfaces)
+    numDistances +=
+        intersect(surface, start, unit, distances.data() + numDistances);
+  std::array<Crossing, MaxCrossings> crossings;
+  const size_t numCrossings = findCrossings(
+      start, unit, direction, distances.data(), numDistances, crossings.data());
+  std::array<Leg, MaxCrossings> legs;
+  const size_t numLegs = buildLegs(crossings.data(), numCrossings, legs.data());
+  const int before = track.count();
+  for (size_t i = 0; i < numLegs; ++i) {
+    const auto &leg = legs[i];
+    const auto &exit = crossings[leg.exit];
+    track.addLink(leg.entry < 0 ? start : crossings[leg.entry].point,
+                  exit.point, exit.distance, m_object);
+  }
+  return track.count() - before;
+}
+
+/**
+ * Trace a ray through the object
+ * @param start :: the start of the ray
+ * @param direction :: the direction of the ray
+ * @param segments :: the segments of the ray inside the object are stored here
+ * @return the number of segments
+ */
+size_t CompiledObject::trace(const V3D &start, const V3D &direction,
+                             Segments &segments) const {
+  traceBlock(&start, &direction, 1, &segments);
+  return segments.size();
+}
+
+/**
+ * Trace a batch of rays through the object
+ * @param starts :: the starts of the rays
+ * @param directions :: the directions of the rays
+ * @param count :: the number of rays
+ * @param segments :: the segments of each ray inside the object are stored
+ * here
+ */
+void CompiledObject::trace(const V3D *starts, const V3D *directions,
+                           const size_t count, Segments *segments) const {
+  for (size_t first = 0; first < count; first += BLOCK_SIZE) {
+    traceBlock(starts + first, directions + first,
+               std::min(BLOCK_SIZE, count - first), segments + first);
+  }
+}
+
+} // namespace Geometry
+} // namespace Mantid
@@ -0,0 +1,269 @@
+#include "MantidGeometry/Objects/DetectorBVH.h"
+#include "MantidGeometry/Instrument/ComponentInfo.h"
+#include "MantidGeometry/Instrument/DetectorInfo.h"
+#include "MantidGeometry/Objects/BoundingBox.h"
+#include "MantidGeometry/Objects/Object.h"
+#include "MantidGeometry/Objects/Track.h"
+#include "MantidKernel/MultiThreaded.h"
+#include "MantidKernel/Quat.h"
+#include "MantidKernel/Tolerance.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+namespace Mantid {
+namespace Geometry {
+
+using Kernel::V3D;
+
+namespace {
+/// Most detectors held by a leaf of the hierarchy
+const size_t LEAF_SIZE = 4;
+/// Deepest hierarchy that can be traversed. The hierarchy is balanced, so
+/// this is far more than any instrument needs.
+const size_t MAX_DEPTH = 64;
+const double INF = std::numeric_limits<double>::infinity();
+
+/**
+ * Distance along a ray at which it enters a box
+ * @param min :: The lower corner of the box
+ * @param max :: The upper corner of the box
+ * @param start :: The start of the ray
+ * @param inverseDirection :: The reciprocal of each component of the direction
+ * @param limit :: Distance beyond which the box is of no interest
+ * @return The distance, 0 if the ray starts inside the box, or infinity if it
+ * misses the box or enters it beyond limit
+ */
+double entryDistance(const std::array<double, 3> &min,
+                     const std::array<double, 3> &max, const V3D &start,
+                     const std::array<double, 3> &inverseDirection,
+                     const double limit) {
+  double near = 0.0;
+  double far = limit;
+  for (size_t i = 0; i < 3; ++i) {
+    double t1 = (min[i] - start[i]) * inverseDirection[i];
+    double t2 = (max[i] - start[i]) * inverseDirection[i];
+    if (t1 > t2)
+      std::swap(t1, t2);
+    near = std::max(near, t1);
+    far = std::min(far, t2);
+  }
+  return near <= far ? near : INF;
+}
+} // namespace
+
+/**
+ * Build the hierarchy over the detectors of an instrument
+ * @param componentInfo :: The positions, rotations and shapes of the
+ * components. It must outlive the hierarchy.
+ * @param detectorInfo :: The detectors of the same instrument
+ * @throw std::runtime_error if the detectors are scanning
+ */
+DetectorBVH::DetectorBVH(const ComponentInfo &componentInfo,
+                         const DetectorInfo &detectorInfo)
+    : m_componentInfo(componentInfo) {
+  if (detectorInfo.isScanning())
+    throw std::runtime_error(
+        "DetectorBVH cannot be built for scanning detectors");
+
+  for (size_t i = 0; i < detectorInfo.size(); ++i) {
+    if (detectorInfo.isMonitor(i) || !componentInfo.hasShape(i))
+      continue;
+    const auto box = componentInfo.boundingBox(i);
+    if (box.isNull())
+      continue;
+    // Grow the box a little so that rays grazing the shape are not lost
+    const double pad = Kernel::Tolerance;
+    m_boxes.push_back(
+        {{{box.xMin() - pad, box.yMin() - pad, box.zMin() - pad}},
+         {{box.xMax() + pad, box.yMax() + pad, box.zMax() + pad}}});
+    m_detectors.push_back(i);
+  }
+  if (m_detectors.empty())
+    return;
+
+  std::vector<size_t> order(m_detectors.size());
+  std::iota(order.begin(), order.end(), 0);
+  build(order, 0, order.size());
+
+  // Store the detectors in the order the leaves refer to them
+  std::vector<size_t> detectors(order.size());
+  std::vector<Box> boxes(order.size());
+  for (size_t i = 0; i < order.size(); ++i) {
+    detectors[i] = m_detectors[order[i]];
+    boxes[i] = m_boxes[order[i]];
+  }
+  m_detectors.swap(detectors);
+  m_boxes.swap(boxes);
+}
+
+/**
+ * Find the detector a ray hits first
+ * @param start :: The start of the ray
+ * @param direction :: The direction of the ray, a unit vector
+ * @return The detector hit, if any, and its distance from start
+ */
+DetectorBVH::Hit DetectorBVH::trace(const V3D &start,
+                                    const V3D &direction) const {
+  Hit hit{false, 0, INF};
+  // Also rejects directions that are not a number
+  if (m_nodes.empty() || !(direction.norm2() > 0.0))
+    return hit;
+  const std::array<double, 3> inverseDirection{
+      {1.0 / direction[0], 1.0 / direction[1], 1.0 / direction[2]}};
+
+  // Nodes still to visit, with the distance at which the ray enters them
+  std::array<std::pair<size_t, double>, MAX_DEPTH> stack;
+  size_t top = 0;
+  const auto &root = m_nodes.front().box;
+  const double rootDistance =
+      entryDistance(root.min, root.max, start, inverseDirection, INF);
+  if (rootDistance < INF)
+    stack[top++] = std::make_pair(size_t(0), rootDistance);
+
+  while (top > 0) {
+    const auto entry = stack[--top];
+    if (entry.second >= hit.distance)
+      continue;
+    const auto &node = m_nodes[entry.first];
+    if (node.count > 0) {
+      for (size_t i = node.index; i < node.index + node.count; ++i) {
+        const auto &box = m_boxes[i];
+        if (entryDistance(box.min, box.max, start, inverseDirection,
+                          hit.distance) == INF)
+          continue;
+        const double distance =
+            intersectShape(m_detectors[i], start, direction);
+        if (distance < hit.distance)
+          hit = {true, m_detectors[i], distance};
+      }
+      continue;
+    }
+    // Visit the nearer child first, so it is pushed last
+    const size_t first = entry.first + 1;
+    const size_t second = node.index;
+    const double firstDistance =
+        entryDistance(m_nodes[first].box.min, m_nodes[first].box.max, start,
+                      inverseDirection, hit.distance);
+    const double secondDistance =
+        entryDistance(m_nodes[second].box.min, m_nodes[second].box.max, start,
+                      inverseDirection, hit.distance);
+    auto nearChild = std::make_pair(first, firstDistance);
+    auto farChild = std::make_pair(second, secondDistance);
+    if (secondDistance < firstDistance)
+      std::swap(nearChild, farChild);
+    if (farChild.second < INF)
+      stack[top++] = farChild;
+    if (nearChild.second < INF)
+      stack[top++] = nearChild;
+  }
+  return hit;
+}
+
+/**
+ * Find the detector each of several rays from the same point hits first. The
+ * rays are traced in parallel.
+ * @param start :: The start of the rays
+ * @param directions :: The directions of the rays, unit vectors
+ * @return The detector hit by each ray
+ */
+std::vector<DetectorBVH::Hit>
+DetectorBVH::traceMany(const V3D &start,
+                       const std::vector<V3D> &directions) const {
+  std::vector<Hit> hits(directions.size());
+  const auto numRays = static_cast<int64_t>(directions.size());
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < numRays; ++i)
+    hits[i] = trace(start, directions[i]);
+  return hits;
+}
+
+/**
+ * Build the node of the hierarchy holding a range of detectors, and the
+ * nodes below it
+ * @param order :: Positions in m_boxes of the detectors, reordered so that
+ * each node holds a contiguous range
+ * @param begin :: The start of the range in order
+ * @param end :: The end of the range in order
+ * @return The index of the node
+ */
+size_t DetectorBVH::build(std::vector<size_t> &order, const size_t begin,
+                          const size_t end) {
+  Box box = m_boxes[order[begin]];
+  Box centres{{{INF, INF, INF}}, {{-INF, -INF, -INF}}};
+  for (size_t i = begin; i < end; ++i) {
+    const auto &item = m_boxes[order[i]];
+    for (size_t k = 0; k < 3; ++k) {
+      box.min[k] = std::min(box.min[k], item.min[k]);
+      box.max[k] = std::max(box.max[k], item.max[k]);
+      const double centre = 0.5 * (item.min[k] + item.max[k]);
+      centres.min[k] = std::min(centres.min[k], centre);
+      centres.max[k] = std::max(centres.max[k], centre);
+    }
+  }
+
+  const size_t index = m_nodes.size();
+  m_nodes.push_back({box, begin, end - begin});
+  if (end - begin <= LEAF_SIZE)
+    return index;
+
+  // Split at the median of the box centres along their widest spread
+  size_t axis = 0;
+  for (size_t k = 1; k < 3; ++k) {
+    if (centres.max[k] - centres.min[k] >
+        centres.max[axis] - centres.min[axis])
+      axis = k;
+  }
+  const size_t middle = begin + (end - begin) / 2;
+  std::nth_element(order.begin() + begin, order.begin() + middle,
+                   order.begin() + end, [this, axis](size_t a, size_t b) {
+                     return m_boxes[a].min[axis] + m_boxes[a].max[axis] <
+                            m_boxes[b].min[axis] + m_boxes[b].max[axis];
+                   });
+  build(order, begin, middle);
+  // Building the children may reallocate m_nodes
+  const size_t second = build(order, middle, end);
+  m_nodes[index].index = second;
+  m_nodes[index].count = 0;
+  return index;
+}
+
+/**
+ * Intersect a ray with the shape of a detector
+ * @param detector :: The index of the detector
+ * @param start :: The start of the ray
+ * @param direction :: The direction of the ray, a unit vector
+ * @return The distance at which the ray enters the shape, or infinity if it
+ * misses
+ */
+double DetectorBVH::intersectShape(const size_t detector, const V3D &start,
+                                   const V3D &direction) const {
+  const V3D position = m_componentInfo.position(detector);
+  const V3D scale = m_componentInfo.scaleFactor(detector);
+  const Kernel::Quat rotation = m_componentInfo.rotation(detector);
+  Kernel::Quat unrotation(rotation);
+  unrotation.inverse();
+
+  // Put the ray into the frame of the shape
+  V3D localStart(start - position);
+  unrotation.rotate(localStart);
+  localStart /= scale;
+  V3D localDirection(direction);
+  unrotation.rotate(localDirection);
+  localDirection /= scale;
+  localDirection.normalize();
+
+  Track track(localStart, localDirection);
+  if (m_componentInfo.shape(detector).interceptSurface(track) == 0)
+    return INF;
+  V3D entry = track.cbegin()->entryPoint;
+  entry *= scale;
+  rotation.rotate(entry);
+  entry += position;
+  return entry.distance(start);
+}
+
+} // namespace Geometry
+} // namespace Mantid
@@ -1,5 +1,6 @@
 #include "MantidGeometry/Objects/Object.h"
 
+#include "MantidGeometry/Objects/CompiledObject.h"
 #include "MantidGeometry/Objects/Rules.h"
 #include "MantidGeometry/Objects/Track.h"
 #include "MantidGeometry/Rendering/CacheGeometryHandler.h"
@@ -95,6 +96,8 @@ Object &Object::operator=(const Object &A) {
 
     if (TopRule)
       createSurfaceList();
+    else
+      m_compiled.reset();
   }
   return *this;
 }
@@ -466,6 +469,8 @@ int Object::checkSurfaceValid(const Kernel::V3D &C,
 bool Object::isValid(const Kernel::V3D &Pt) const {
   if (!TopRule)
     return false;
+  if (m_compiled)
+    return m_compiled->isValid(Pt);
   return TopRule->isValid(Pt);
 }
 
@@ -513,6 +518,7 @@ int Object::createSurfaceList(const int outFlag) {
   if (sc != SurList.end()) {
     SurList.erase(sc, SurList.end());
   }
+  m_compiled = CompiledObject::compile(*this);
   if (outFlag) {
 
     std::vector<const Surface *>::const_iterator vc;
@@ -614,6 +620,7 @@ void Object::print() const {
 void Object::makeComplement() {
   std::unique_ptr<Rule> NCG = procComp(std::move(TopRule));
   TopRule = std::move(NCG);
+  m_compiled = CompiledObject::compile(*this);
 }
 
 /**
@@ -670,6 +677,7 @@ void Object::write(std::ostream &OX) const {
 */
 int Object::procString(const std::string &Line) {
   TopRule = nullptr;
+  m_compiled.reset();
   std::map<int, std::unique_ptr<Rule>> RuleList; // List for the rules
   int Ridx = 0; // Current index (not necessary size of RuleList
   // SURFACE REPLACEMENT
@@ -753,6 +761,8 @@ int Object::procString(const std::string &Line) {
 * @return Number of segments added
 */
 int Object::interceptSurface(Geometry::Track &UT) const {
+  if (m_compiled)
+    return m_compiled->interceptSurface(UT);
   int cnt = UT.count(); // Number of intersections original track
   // Loop over all the surfaces.
   LineIntersectVisit LI(UT.startPoint(), UT.direction());
@@ -835,10 +845,7 @@ double Object::solidAngle(const Kernel::V3D &observer,
 */
 double Object::rayTraceSolidAngle(const Kernel::V3D &observer) const {
   // Calculation of solid angle as numerical double integral over all
-  // angles. This could be optimised further e.g. by
-  // using a light weight version of the interceptSurface method - this does
-  // more work
-  // than is necessary in this application.
+  // angles.
   // Accuracy is of the order of 1% for objects with an accurate bounding box,
   // though
   // less in the case of high aspect ratios.
@@ -884,6 +891,26 @@ double Object::rayTraceSolidAngle(const Kernel::V3D &observer) const {
       axis = Kernel::V3D(1.0, 0.0, 0.0);
     zToPt(theta0, axis);
   }
+  // The rays of each value of theta are traced together
+  std::vector<Kernel::V3D> starts, directions;
+  std::vector<CompiledObject::Segments> segments;
+  auto countHits = [&]() {
+    int hits(0);
+    if (m_compiled) {
+      starts.assign(directions.size(), observer);
+      segments.resize(directions.size());
+      m_compiled->trace(starts.data(), directions.data(), directions.size(),
+                        segments.data());
+      for (const auto &raySegments : segments)
+        hits += raySegments.empty() ? 0 : 1;
+    } else {
+      for (const auto &dir : directions) {
+        Track tr(observer, dir);
+        hits += (this->interceptSurface(tr) > 0) ? 1 : 0;
+      }
+    }
+    return hits;
+  };
   dtheta = thetaMax / res;
   int count = 0, countPhi;
   sum = 0.;
@@ -894,21 +921,18 @@ double Object::rayTraceSolidAngle(const Kernel::V3D &observer) const {
     if (resPhi < resPhiMin)
       resPhi = resPhiMin;
     dphi = 2 * M_PI / resPhi;
-    countPhi = 0;
+    directions.clear();
     for (jphi = 1; jphi <= resPhi; jphi++) {
       // integrate phi from 0 to 2*PI
       phi = 2.0 * M_PI * (jphi - 0.5) / resPhi;
       Kernel::V3D dir(sin(theta) * cos(phi), sin(theta) * sin(phi), cos(theta));
       if (usePt)
         zToPt.rotate(dir);
-      if (!useBB || boundingBox.doesLineIntersect(observer, dir)) {
-        Track tr(observer, dir);
-        if (this->interceptSurface(tr) > 0) {
-          sum += dtheta * dphi * sin(theta);
-          countPhi++;
-        }
-      }
+      if (!useBB || boundingBox.doesLineIntersect(observer, dir))
+        directions.push_back(dir);
     }
+    countPhi = countHits();
+    sum += countPhi * dtheta * dphi * sin(theta);
     // this break (only used in no BB defined) may be wrong if object has hole
     // in middle
     if (!useBB && countPhi == 0)
@@ -927,19 +951,17 @@ double Object::rayTraceSolidAngle(const Kernel::V3D &observer) const {
       if (resPhi < resPhiMin)
         resPhi = resPhiMin;
       dphi = 2 * M_PI / resPhi;
-      countPhi = 0;
+      directions.clear();
       for (jphi = 1; jphi <= resPhi; jphi++) {
         phi = 2.0 * M_PI * (jphi - 0.5) / resPhi;
         Kernel::V3D dir(sin(theta) * cos(phi), sin(theta) * sin(phi),
                         cos(theta));
         if (usePt)
           zToPt.rotate(dir);
-        Track tr(observer, dir);
-        if (this->interceptSurface(tr) > 0) {
-          sum += dtheta * dphi * sin(theta);
-          countPhi++;
-        }
+        directions.push_back(dir);
       }
+      countPhi = countHits();
+      sum += countPhi * dtheta * dphi * sin(theta);
       if (countPhi == 0)
         break;
     }
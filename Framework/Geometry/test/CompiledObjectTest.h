@@ -0,0 +1,225 @@
+#ifndef MANTID_GEOMETRY_COMPILEDOBJECTTEST_H_
+#define MANTID_GEOMETRY_COMPILEDOBJECTTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidGeometry/Objects/CompiledObject.h"
+#include "MantidGeometry/Objects/Object.h"
+#include "MantidGeometry/Objects/Rules.h"
+#include "MantidGeometry/Objects/Track.h"
+#include "MantidGeometry/Surfaces/LineIntersectVisit.h"
+#include "MantidGeometry/Surfaces/Surface.h"
+#include "MantidGeometry/Surfaces/SurfaceFactory.h"
+#include "MantidKernel/Tolerance.h"
+
+#include <boost/make_shared.hpp>
+
+#include <map>
+#include <random>
+#include <string>
+
+using namespace Mantid::Geometry;
+using Mantid::Kernel::V3D;
+
+class CompiledObjectTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static CompiledObjectTest *createSuite() { return new CompiledObjectTest(); }
+  static void destroySuite(CompiledObjectTest *suite) { delete suite; }
+
+  void test_object_without_rules_is_not_compiled() {
+    Object object;
+    TS_ASSERT(!CompiledObject::compile(object));
+  }
+
+  void test_object_with_too_many_surfaces_is_not_compiled() {
+    // A row of 17 spheres, crossed up to 34 times by a ray
+    std::map<int, std::string> surfaces;
+    std::string rule;
+    for (int i = 1; i <= 17; ++i) {
+      surfaces[i] = "s " + std::to_string(3 * i) + " 0 0 1";
+      rule += (i == 1 ? "-" : " : -") + std::to_string(i);
+    }
+    auto object = createObject(surfaces, rule);
+    TS_ASSERT(!CompiledObject::compile(*object));
+
+    Track track(V3D(0, 0, 0), V3D(1, 0, 0));
+    TS_ASSERT_EQUALS(object->interceptSurface(track), 17);
+  }
+
+  void test_isValid_matches_rule_tree() {
+    for (const auto &object : createObjects()) {
+      auto compiled = CompiledObject::compile(*object);
+      TS_ASSERT(compiled);
+      std::mt19937 generator(1);
+      std::uniform_real_distribution<double> position(-6., 6.);
+      for (int i = 0; i < 1000; ++i) {
+        const V3D point(position(generator), position(generator),
+                        position(generator));
+        TS_ASSERT_EQUALS(compiled->isValid(point),
+                         object->topRule()->isValid(point));
+      }
+    }
+  }
+
+  void test_interceptSurface_matches_rule_tree() {
+    for (const auto &object : createObjects()) {
+      auto compiled = CompiledObject::compile(*object);
+      std::mt19937 generator(2);
+      for (int i = 0; i < 500; ++i) {
+        const V3D start = randomPoint(generator);
+        const V3D direction = randomDirection(generator);
+        Track expected(start, direction);
+        const int expectedCount = interceptWithRules(*object, expected);
+        Track track(start, direction);
+        TS_ASSERT_EQUALS(compiled->interceptSurface(track), expectedCount);
+        TS_ASSERT_EQUALS(track.count(), expected.count());
+        auto expectedLink = expected.cbegin();
+        for (const auto &link : track) {
+          TS_ASSERT_DELTA(link.distFromStart, expectedLink->distFromStart,
+                          1e-10);
+          TS_ASSERT_DELTA(link.distInsideObject,
+                          expectedLink->distInsideObject, 1e-10);
+          TS_ASSERT_EQUALS(link.object, expectedLink->object);
+          ++expectedLink;
+        }
+      }
+    }
+  }
+
+  void test_trace_of_sphere() {
+    auto object = createObject({{41, "s 1 1 1 4"}}, "-41");
+    auto compiled = CompiledObject::compile(*object);
+    CompiledObject::Segments segments;
+    TS_ASSERT_EQUALS(compiled->trace(V3D(-1, 1.5, 1), V3D(1, 0, 0), segments),
+                     1);
+    TS_ASSERT_DELTA(segments[0].entry, 0., 1e-12);
+    TS_ASSERT_DELTA(segments[0].exit, sqrt(15.75) + 2, 1e-12);
+
+    TS_ASSERT_EQUALS(
+        compiled->trace(V3D(-10, 1.5, 1), V3D(1, 0, 0), segments), 1);
+    TS_ASSERT_DELTA(segments[0].entry, 11 - sqrt(15.75), 1e-12);
+    TS_ASSERT_DELTA(segments[0].exit, 11 + sqrt(15.75), 1e-12);
+
+    TS_ASSERT_EQUALS(
+        compiled->trace(V3D(-10, 1.5, 1), V3D(-1, 0, 0), segments), 0);
+    TS_ASSERT(segments.empty());
+  }
+
+  void test_batched_trace_matches_interceptSurface() {
+    for (const auto &object : createObjects()) {
+      auto compiled = CompiledObject::compile(*object);
+      std::mt19937 generator(3);
+      // More rays than are traced together
+      const size_t numRays = 100;
+      std::vector<V3D> starts, directions;
+      for (size_t i = 0; i < numRays; ++i) {
+        starts.push_back(randomPoint(generator));
+        directions.push_back(randomDirection(generator));
+      }
+      std::vector<CompiledObject::Segments> segments(numRays);
+      compiled->trace(starts.data(), directions.data(), numRays,
+                      segments.data());
+      for (size_t i = 0; i < numRays; ++i) {
+        Track track(starts[i], directions[i]);
+        object->interceptSurface(track);
+        TS_ASSERT_EQUALS(segments[i].size(),
+                         static_cast<size_t>(track.count()));
+        auto segment = segments[i].begin();
+        for (const auto &link : track) {
+          TS_ASSERT_DELTA(segment->entry, link.entryPoint.distance(starts[i]),
+                          1e-10);
+          TS_ASSERT_DELTA(segment->exit, link.distFromStart, 1e-10);
+          ++segment;
+        }
+      }
+    }
+  }
+
+private:
+  boost::shared_ptr<Object>
+  createObject(const std::map<int, std::string> &surfaces,
+               const std::string &rule) {
+    std::map<int, boost::shared_ptr<Surface>> surfaceMap;
+    for (const auto &surface : surfaces) {
+      surfaceMap[surface.first] =
+          SurfaceFactory::Instance()->processLine(surface.second);
+      surfaceMap[surface.first]->setName(surface.first);
+    }
+    auto object = boost::make_shared<Object>();
+    object->setObject(1, rule);
+    object->populate(surfaceMap);
+    return object;
+  }
+
+  /// Shapes using each kind of surface and rule
+  std::vector<boost::shared_ptr<Object>> createObjects() {
+    return {
+        // Sphere
+        createObject({{41, "s 1 1 1 4"}}, "-41"),
+        // Capped cylinder
+        createObject({{31, "cx 3.0"}, {32, "px 1.2"}, {33, "px -3.2"}},
+                     "-31 -32 33"),
+        // Capped cylinder with a spherical hole, and a separate cube
+        createObject({{31, "cx 3.0"},
+                      {32, "px 1.2"},
+                      {33, "px -3.2"},
+                      {41, "s -1 0 0 1.5"},
+                      {1, "px 2"},
+                      {2, "px 4"},
+                      {3, "py -1"},
+                      {4, "py 1"},
+                      {5, "pz -1"},
+                      {6, "pz 1"}},
+                     "(-31 -32 33 41) : (1 -2 3 -4 5 -6)"),
+        // Complement of a group: a cube with a cylindrical hole
+        createObject({{1, "px -4"},
+                      {2, "px 4"},
+                      {3, "py -4"},
+                      {4, "py 4"},
+                      {5, "pz -4"},
+                      {6, "pz 4"},
+                      {31, "cz 2.0"},
+                      {32, "pz 2"},
+                      {33, "pz -2"}},
+                     "1 -2 3 -4 5 -6 #(-31 -32 33)"),
+        // Capped cone
+        createObject({{51, "k/x 0 0 0 1"}, {52, "px 4"}, {53, "px 0.5"}},
+                     "-51 -52 53")};
+  }
+
+  V3D randomPoint(std::mt19937 &generator) {
+    std::uniform_real_distribution<double> position(-6., 6.);
+    return V3D(position(generator), position(generator), position(generator));
+  }
+
+  V3D randomDirection(std::mt19937 &generator) {
+    std::normal_distribution<double> component;
+    V3D direction(component(generator), component(generator),
+                  component(generator));
+    direction.normalize();
+    return direction;
+  }
+
+  /// Fill a track as Object::interceptSurface does with the rule tree
+  int interceptWithRules(const Object &object, Track &track) {
+    LineIntersectVisit visit(track.startPoint(), track.direction());
+    for (const auto surface : object.getSurfacePtr())
+      surface->acceptVisitor(visit);
+    const V3D shift(track.direction() * Mantid::Kernel::Tolerance * 25.0);
+    auto distance = visit.getDistance().cbegin();
+    for (const auto &point : visit.getPoints()) {
+      if (*distance++ > 0.0) {
+        const bool before = object.topRule()->isValid(point - shift);
+        const bool after = object.topRule()->isValid(point + shift);
+        const int flag = (before == after) ? 0 : (before ? -1 : 1);
+        track.addPoint(flag, point, object);
+      }
+    }
+    track.buildLink();
+    return track.count();
+  }
+};
+
+#endif /* MANTID_GEOMETRY_COMPILEDOBJECTTEST_H_ */
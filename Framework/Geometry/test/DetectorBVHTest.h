@@ -0,0 +1,140 @@
+#ifndef MANTID_GEOMETRY_DETECTORBVHTEST_H_
+#define MANTID_GEOMETRY_DETECTORBVHTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidGeometry/Instrument/ComponentInfo.h"
+#include "MantidGeometry/Instrument/DetectorInfo.h"
+#include "MantidGeometry/Instrument/InstrumentVisitor.h"
+#include "MantidGeometry/Instrument/RectangularDetector.h"
+#include "MantidGeometry/Objects/DetectorBVH.h"
+#include "MantidGeometry/Objects/InstrumentRayTracer.h"
+#include "MantidKernel/ConfigService.h"
+#include "MantidTestHelpers/ComponentCreationHelper.h"
+
+#include <random>
+
+using namespace Mantid::Geometry;
+using Mantid::Kernel::V3D;
+
+class DetectorBVHTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static DetectorBVHTest *createSuite() { return new DetectorBVHTest(); }
+  static void destroySuite(DetectorBVHTest *suite) { delete suite; }
+
+  DetectorBVHTest() {
+    // Start logging framework
+    Mantid::Kernel::ConfigService::Instance();
+  }
+
+  void test_all_detectors_are_in_hierarchy() {
+    auto instrument =
+        ComponentCreationHelper::createTestInstrumentRectangular(2, 10);
+    auto wrappers = InstrumentVisitor::makeWrappers(*instrument);
+    DetectorBVH bvh(*std::get<0>(wrappers), *std::get<1>(wrappers));
+    TS_ASSERT_EQUALS(bvh.size(), 200);
+  }
+
+  void test_trace_of_pixel() {
+    auto instrument =
+        ComponentCreationHelper::createTestInstrumentRectangular(1, 100);
+    auto wrappers = InstrumentVisitor::makeWrappers(*instrument);
+    const auto &detectorInfo = *std::get<1>(wrappers);
+    DetectorBVH bvh(*std::get<0>(wrappers), detectorInfo);
+
+    // Towards pixel (1,2), 5 m from the sample
+    const double w = 0.008;
+    V3D direction(w * 1, w * 2, 5.0);
+    direction.normalize();
+    const auto hit = bvh.trace(detectorInfo.samplePosition(), direction);
+    TS_ASSERT(hit.found);
+    const auto bank = boost::dynamic_pointer_cast<const RectangularDetector>(
+        instrument->getComponentByName("bank1"));
+    const auto xy = bank->getXYForDetectorID(
+        detectorInfo.detectorIDs()[hit.detectorIndex]);
+    TS_ASSERT_EQUALS(xy.first, 1);
+    TS_ASSERT_EQUALS(xy.second, 2);
+    TS_ASSERT_DELTA(hit.distance, 5.0, 1e-2);
+
+    const auto miss = bvh.trace(detectorInfo.samplePosition(), V3D(0, 0, -1));
+    TS_ASSERT(!miss.found);
+    const auto parallel =
+        bvh.trace(detectorInfo.samplePosition(), V3D(1, 0, 0));
+    TS_ASSERT(!parallel.found);
+    const auto zero = bvh.trace(detectorInfo.samplePosition(), V3D(0, 0, 0));
+    TS_ASSERT(!zero.found);
+  }
+
+  void test_trace_matches_InstrumentRayTracer_for_rectangular_detectors() {
+    checkAgainstInstrumentRayTracer(
+        ComponentCreationHelper::createTestInstrumentRectangular(2, 10));
+  }
+
+  void test_trace_matches_InstrumentRayTracer_for_cylindrical_detectors() {
+    checkAgainstInstrumentRayTracer(
+        ComponentCreationHelper::createTestInstrumentCylindrical(2));
+  }
+
+  void test_traceMany_matches_trace() {
+    auto instrument =
+        ComponentCreationHelper::createTestInstrumentRectangular(2, 10);
+    auto wrappers = InstrumentVisitor::makeWrappers(*instrument);
+    const auto &detectorInfo = *std::get<1>(wrappers);
+    DetectorBVH bvh(*std::get<0>(wrappers), detectorInfo);
+
+    const auto directions = directionsTowardsDetectors(detectorInfo);
+    const auto hits = bvh.traceMany(detectorInfo.samplePosition(), directions);
+    TS_ASSERT_EQUALS(hits.size(), directions.size());
+    for (size_t i = 0; i < directions.size(); ++i) {
+      const auto hit = bvh.trace(detectorInfo.samplePosition(), directions[i]);
+      TS_ASSERT_EQUALS(hits[i].found, hit.found);
+      TS_ASSERT_EQUALS(hits[i].detectorIndex, hit.detectorIndex);
+      TS_ASSERT_EQUALS(hits[i].distance, hit.distance);
+    }
+  }
+
+private:
+  /// Directions from the sample towards points near each detector
+  std::vector<V3D>
+  directionsTowardsDetectors(const DetectorInfo &detectorInfo) {
+    std::mt19937 generator(1);
+    std::uniform_real_distribution<double> jitter(-0.005, 0.005);
+    std::vector<V3D> directions;
+    for (size_t i = 0; i < detectorInfo.size(); ++i) {
+      for (int j = 0; j < 5; ++j) {
+        V3D direction = detectorInfo.position(i) +
+                        V3D(jitter(generator), jitter(generator),
+                            jitter(generator)) -
+                        detectorInfo.samplePosition();
+        direction.normalize();
+        directions.push_back(direction);
+      }
+    }
+    return directions;
+  }
+
+  void checkAgainstInstrumentRayTracer(Instrument_sptr instrument) {
+    auto wrappers = InstrumentVisitor::makeWrappers(*instrument);
+    const auto &detectorInfo = *std::get<1>(wrappers);
+    DetectorBVH bvh(*std::get<0>(wrappers), detectorInfo);
+    InstrumentRayTracer tracer(instrument);
+
+    size_t numHits = 0;
+    for (const auto &direction : directionsTowardsDetectors(detectorInfo)) {
+      const auto hit = bvh.trace(detectorInfo.samplePosition(), direction);
+      tracer.traceFromSample(direction);
+      const auto detector = tracer.getDetectorResult();
+      TS_ASSERT_EQUALS(hit.found, static_cast<bool>(detector));
+      if (hit.found && detector) {
+        TS_ASSERT_EQUALS(detectorInfo.detectorIDs()[hit.detectorIndex],
+                         detector->getID());
+        ++numHits;
+      }
+    }
+    TS_ASSERT(numHits > 0);
+  }
+};
+
+#endif /* MANTID_GEOMETRY_DETECTORBVHTEST_H_ */
@@ -0,0 +1,176 @@
+#ifndef MANTID_GEOMETRY_INSTRUMENTCACHETEST_H_
+#define MANTID_GEOMETRY_INSTRUMENTCACHETEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidGeometry/ICompAssembly.h"
+#include "MantidGeometry/IDetector.h"
+#include "MantidGeometry/Instrument.h"
+#include "MantidGeometry/Instrument/InstrumentCache.h"
+#include "MantidGeometry/Instrument/InstrumentDefinitionParser.h"
+#include "MantidGeometry/Instrument/ParameterMap.h"
+#include "MantidGeometry/Instrument/ReferenceFrame.h"
+#include "MantidGeometry/Instrument/XMLInstrumentParameter.h"
+#include "MantidKernel/ConfigService.h"
+#include "MantidKernel/Strings.h"
+
+#include <boost/make_shared.hpp>
+#include <Poco/File.h>
+#include <Poco/Path.h>
+#include <fstream>
+#include <iterator>
+
+using namespace Mantid::Geometry;
+using Mantid::Kernel::ConfigService;
+
+class InstrumentCacheTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static InstrumentCacheTest *createSuite() {
+    return new InstrumentCacheTest();
+  }
+  static void destroySuite(InstrumentCacheTest *suite) { delete suite; }
+
+  InstrumentCacheTest() {
+    Poco::Path path(ConfigService::Instance().getTempDir());
+    path.makeDirectory();
+    path.append("InstrumentCacheTest.instcache");
+    m_filename = path.toString();
+  }
+
+  void tearDown() override {
+    Poco::File file(m_filename);
+    if (file.exists())
+      file.remove();
+  }
+
+  void test_instrument_is_unchanged_by_cache() {
+    checkRoundTrip("IDF_for_UNIT_TESTING.xml");
+  }
+
+  void test_rectangular_detectors_are_unchanged_by_cache() {
+    checkRoundTrip("IDF_for_RECTANGULAR_UNIT_TESTING.xml");
+  }
+
+  void test_cache_with_other_key_is_ignored() {
+    auto instrument = parse("IDF_for_UNIT_TESTING.xml");
+    InstrumentCache::save(m_filename, "key", *instrument, {});
+
+    Instrument loaded(instrument->getName());
+    InstrumentCache::TypeShapes shapes;
+    TS_ASSERT(!InstrumentCache::load(m_filename, "other", loaded, shapes));
+    TS_ASSERT_EQUALS(loaded.nelements(), 0);
+  }
+
+  void test_missing_cache_is_ignored() {
+    Instrument loaded("Missing");
+    InstrumentCache::TypeShapes shapes;
+    TS_ASSERT(!InstrumentCache::load(m_filename, "key", loaded, shapes));
+  }
+
+  void test_truncated_cache_throws() {
+    auto instrument = parse("IDF_for_UNIT_TESTING.xml");
+    InstrumentCache::save(m_filename, "key", *instrument, {});
+    std::string contents;
+    {
+      std::ifstream in(m_filename.c_str(), std::ios::binary);
+      contents.assign(std::istreambuf_iterator<char>(in),
+                      std::istreambuf_iterator<char>());
+    }
+    std::ofstream(m_filename.c_str(), std::ios::binary | std::ios::trunc)
+        .write(contents.data(),
+               static_cast<std::streamsize>(contents.size() / 2));
+
+    Instrument loaded(instrument->getName());
+    InstrumentCache::TypeShapes shapes;
+    TS_ASSERT_THROWS(InstrumentCache::load(m_filename, "key", loaded, shapes),
+                     std::runtime_error);
+  }
+
+  void test_parametrized_instrument_is_not_cached() {
+    auto instrument = parse("IDF_for_UNIT_TESTING.xml");
+    auto pmap = boost::make_shared<ParameterMap>();
+    Instrument parametrized(instrument, pmap);
+    TS_ASSERT_THROWS(
+        InstrumentCache::save(m_filename, "key", parametrized, {}),
+        std::runtime_error);
+    TS_ASSERT(!Poco::File(m_filename).exists());
+  }
+
+private:
+  Instrument_sptr parse(const std::string &idf) {
+    const std::string filename =
+        ConfigService::Instance().getInstrumentDirectory() +
+        "/IDFs_for_UNIT_TESTING/" + idf;
+    InstrumentDefinitionParser parser(
+        filename, "For Unit Testing",
+        Mantid::Kernel::Strings::loadFile(filename));
+    return parser.parseXML(nullptr);
+  }
+
+  void checkRoundTrip(const std::string &idf) {
+    auto instrument = parse(idf);
+    InstrumentCache::save(m_filename, "key", *instrument, {});
+
+    Instrument loaded(instrument->getName());
+    InstrumentCache::TypeShapes shapes;
+    TS_ASSERT(InstrumentCache::load(m_filename, "key", loaded, shapes));
+
+    checkComponent(*instrument, loaded);
+    TS_ASSERT_EQUALS(loaded.getDetectorIDs(), instrument->getDetectorIDs());
+    TS_ASSERT_EQUALS(loaded.getMonitors(), instrument->getMonitors());
+    TS_ASSERT_EQUALS(loaded.getSource()->getName(),
+                     instrument->getSource()->getName());
+    TS_ASSERT_EQUALS(loaded.getSample()->getName(),
+                     instrument->getSample()->getName());
+    TS_ASSERT_EQUALS(loaded.getDefaultView(), instrument->getDefaultView());
+    TS_ASSERT_EQUALS(loaded.getValidFromDate(),
+                     instrument->getValidFromDate());
+    TS_ASSERT_EQUALS(loaded.getValidToDate(), instrument->getValidToDate());
+    const auto frame = loaded.getReferenceFrame();
+    const auto expectedFrame = instrument->getReferenceFrame();
+    TS_ASSERT_EQUALS(frame->pointingUp(), expectedFrame->pointingUp());
+    TS_ASSERT_EQUALS(frame->pointingAlongBeam(),
+                     expectedFrame->pointingAlongBeam());
+    TS_ASSERT_EQUALS(frame->getHandedness(), expectedFrame->getHandedness());
+
+    const auto &cache = loaded.getLogfileCache();
+    const auto &expectedCache = instrument->getLogfileCache();
+    TS_ASSERT_EQUALS(cache.size(), expectedCache.size());
+    for (const auto &item : expectedCache) {
+      const auto component =
+          loaded.getComponentByName(item.first.second->getFullName());
+      TS_ASSERT(component);
+      const auto found =
+          cache.find(std::make_pair(item.first.first, component.get()));
+      TS_ASSERT(found != cache.end());
+      if (found != cache.end())
+        TS_ASSERT_EQUALS(found->second->m_value, item.second->m_value);
+    }
+  }
+
+  void checkComponent(const IComponent &expected, const IComponent &actual) {
+    TS_ASSERT_EQUALS(actual.getName(), expected.getName());
+    TS_ASSERT_EQUALS(typeid(actual).name(), typeid(expected).name());
+    TS_ASSERT_EQUALS(actual.getPos(), expected.getPos());
+    TS_ASSERT_EQUALS(actual.getRotation(), expected.getRotation());
+    const auto detector = dynamic_cast<const IDetector *>(&expected);
+    if (detector) {
+      TS_ASSERT_EQUALS(dynamic_cast<const IDetector &>(actual).getID(),
+                       detector->getID());
+    }
+    const auto assembly = dynamic_cast<const ICompAssembly *>(&expected);
+    if (!assembly)
+      return;
+    const auto &actualAssembly = dynamic_cast<const ICompAssembly &>(actual);
+    TS_ASSERT_EQUALS(actualAssembly.nelements(), assembly->nelements());
+    for (int i = 0;
+         i < std::min(assembly->nelements(), actualAssembly.nelements()); ++i)
+      checkComponent(*assembly->getChild(i), *actualAssembly.getChild(i));
+  }
+
+  std::string m_filename;
+};
+
+#endif /* MANTID_GEOMETRY_INSTRUMENTCACHETEST_H_ */
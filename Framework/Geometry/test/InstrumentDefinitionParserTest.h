@@ -1,9 +1,13 @@
 #ifndef MANTID_GEOMETRY_INSTRUMENTDEFINITIONPARSERTEST_H_
 #define MANTID_GEOMETRY_INSTRUMENTDEFINITIONPARSERTEST_H_
 
+#include "MantidGeometry/IDetector.h"
 #include "MantidGeometry/Instrument/InstrumentDefinitionParser.h"
 #include "MantidGeometry/Instrument/RectangularDetector.h"
 #include "MantidGeometry/Instrument/ReferenceFrame.h"
+#include "MantidGeometry/Instrument/XMLInstrumentParameter.h"
+#include "MantidGeometry/Objects/BoundingBox.h"
+#include "MantidGeometry/Objects/Object.h"
 #include "MantidKernel/ChecksumHelper.h"
 #include "MantidKernel/ConfigService.h"
 #include "MantidKernel/Exception.h"
@@ -14,6 +18,9 @@
 
 #include <gmock/gmock.h>
 #include <boost/algorithm/string/replace.hpp>
+#include <Poco/File.h>
+#include <Poco/Path.h>
+#include <Poco/Timestamp.h>
 
 using namespace Mantid;
 using namespace Mantid::Kernel;
@@ -107,6 +114,28 @@ private:
     return IDFEnvironment(idf, vtp, idf_file_contents, instrument_name);
   }
 
+  /// The files the binary instrument cache of an instrument may be written to
+  std::vector<std::string>
+  instrumentCacheFiles(const std::string &mangledName) {
+    std::vector<std::string> files;
+    for (const auto &dir : {ConfigService::Instance().getVTPFileDirectory(),
+                            ConfigService::Instance().getTempDir()}) {
+      Poco::Path path(dir);
+      path.makeDirectory();
+      path.append(mangledName + ".instcache");
+      files.push_back(path.toString());
+    }
+    return files;
+  }
+
+  void removeFiles(const std::vector<std::string> &files) {
+    for (const auto &file : files) {
+      Poco::File cacheFile(file);
+      if (cacheFile.exists())
+        cacheFile.remove();
+    }
+  }
+
   // Helper method to create the IDF File.
   ScopedFile createIDFFileObject(const std::string &idf_filename,
                                  const std::string &idf_file_contents) {
@@ -533,6 +562,86 @@ public:
                                     ptrMonShape->getPos()));
   }
 
+  void test_parsing_again_loads_instrument_from_cache() {
+    std::string filename = ConfigService::Instance().getInstrumentDirectory() +
+                           "/IDFs_for_UNIT_TESTING/IDF_for_UNIT_TESTING2.xml";
+    std::string xmlText = Strings::loadFile(filename);
+    InstrumentDefinitionParser parser(filename, "For Unit Testing2", xmlText);
+    const auto cacheFiles = instrumentCacheFiles(parser.getMangledName());
+    removeFiles(cacheFiles);
+
+    // The first parse reads the XML and writes the cache
+    Instrument_sptr parsed;
+    TS_ASSERT_THROWS_NOTHING(parsed = parser.parseXML(nullptr));
+    std::string cacheFile;
+    for (const auto &file : cacheFiles)
+      if (Poco::File(file).exists())
+        cacheFile = file;
+    TS_ASSERT(!cacheFile.empty());
+    if (cacheFile.empty())
+      return;
+    // Parsing the XML would write the cache again and change this
+    const Poco::Timestamp written(0);
+    Poco::File(cacheFile).setLastModified(written);
+
+    InstrumentDefinitionParser cachedParser(filename, "For Unit Testing2",
+                                            xmlText);
+    Instrument_sptr cached;
+    TS_ASSERT_THROWS_NOTHING(cached = cachedParser.parseXML(nullptr));
+    TS_ASSERT_EQUALS(Poco::File(cacheFile).getLastModified(), written);
+
+    // The geometry cache written or read by the first parse is read
+    const auto firstOption = parser.getAppliedCachingOption();
+    const auto expectedOption =
+        firstOption == InstrumentDefinitionParser::WroteCacheTemp ||
+                firstOption == InstrumentDefinitionParser::ReadFallBack
+            ? InstrumentDefinitionParser::ReadFallBack
+            : InstrumentDefinitionParser::ReadGeomCache;
+    TS_ASSERT_EQUALS(cachedParser.getAppliedCachingOption(), expectedOption);
+
+    TS_ASSERT_EQUALS(cached->getName(), parsed->getName());
+    TS_ASSERT_EQUALS(cached->getMonitors(), parsed->getMonitors());
+    TS_ASSERT(!cached->getMonitors().empty());
+    const auto detIDs = parsed->getDetectorIDs();
+    TS_ASSERT_EQUALS(cached->getDetectorIDs(), detIDs);
+    for (const auto id : detIDs) {
+      const auto detector = parsed->getDetector(id);
+      const auto cachedDetector = cached->getDetector(id);
+      TS_ASSERT_EQUALS(cachedDetector->getFullName(),
+                       detector->getFullName());
+      TS_ASSERT_EQUALS(cachedDetector->getPos(), detector->getPos());
+      TS_ASSERT_EQUALS(cached->isMonitor(id), parsed->isMonitor(id));
+      const auto shape = detector->shape();
+      const auto cachedShape = cachedDetector->shape();
+      TS_ASSERT_EQUALS(bool(cachedShape), bool(shape));
+      if (!shape || !cachedShape)
+        continue;
+      const auto &box = shape->getBoundingBox();
+      const auto &cachedBox = cachedShape->getBoundingBox();
+      TS_ASSERT_EQUALS(cachedBox.minPoint(), box.minPoint());
+      TS_ASSERT_EQUALS(cachedBox.maxPoint(), box.maxPoint());
+    }
+
+    const auto &logfiles = parsed->getLogfileCache();
+    const auto &cachedLogfiles = cached->getLogfileCache();
+    TS_ASSERT(!logfiles.empty());
+    TS_ASSERT_EQUALS(cachedLogfiles.size(), logfiles.size());
+    for (const auto &item : logfiles) {
+      const auto component =
+          cached->getComponentByName(item.first.second->getFullName());
+      TS_ASSERT(component);
+      const auto found = cachedLogfiles.find(
+          std::make_pair(item.first.first, component.get()));
+      TS_ASSERT(found != cachedLogfiles.end());
+      if (found == cachedLogfiles.end())
+        continue;
+      TS_ASSERT_EQUALS(found->second->m_logfileID, item.second->m_logfileID);
+      TS_ASSERT_EQUALS(found->second->m_value, item.second->m_value);
+    }
+
+    removeFiles(cacheFiles);
+  }
+
   void test_parse_RectangularDetector() {
     std::string filename =
         ConfigService::Instance().getInstrumentDirectory() +
@@ -5,6 +5,8 @@
 #include "MantidGeometry/Instrument/ParameterFactory.h"
 #include "MantidGeometry/Instrument/ParameterMap.h"
 #include "MantidGeometry/Instrument/Detector.h"
+#include "MantidGeometry/Instrument/DetectorInfo.h"
+#include "MantidGeometry/Instrument/ParComponentFactory.h"
 #include "MantidBeamline/ComponentInfo.h"
 #include "MantidBeamline/DetectorInfo.h"
 #include "MantidTestHelpers/ComponentCreationHelper.h"
@@ -20,6 +22,7 @@ using Mantid::Geometry::Parameter_sptr;
 using Mantid::Geometry::Instrument_sptr;
 using Mantid::Geometry::IComponent;
 using Mantid::Geometry::IComponent_sptr;
+using Mantid::Geometry::ParComponentFactory;
 
 class ParameterMapTest : public CxxTest::TestSuite {
 public:
@@ -457,6 +460,50 @@ public:
     TS_ASSERT_EQUALS(fetched->value<int>(), value2);
   }
 
+  void test_getRecursive_from_parametrized_component_finds_on_parent() {
+    ParameterMap_sptr pmap(new ParameterMap);
+    pmap->addInt(m_testInstrument.get(), "top", 1);
+    auto detector = m_testInstrument->getDetector(1);
+    auto parametrized = ParComponentFactory::createDetector(detector.get(),
+                                                             pmap.get());
+    Parameter_sptr fetched = pmap->getRecursive(parametrized.get(), "top");
+    TS_ASSERT(fetched);
+    TS_ASSERT_EQUALS(fetched->value<int>(), 1);
+    fetched =
+        pmap->getRecursiveByType(parametrized.get(), ParameterMap::pInt());
+    TS_ASSERT(fetched);
+  }
+
+  void test_getRecursiveForDetectors_matches_getRecursive() {
+    auto instrument =
+        ComponentCreationHelper::createTestInstrumentCylindrical(2);
+    ParameterMap pmap;
+    pmap.setInstrument(instrument.get());
+    pmap.addDouble(instrument.get(), "value", 1.0);
+    pmap.addDouble(instrument->getComponentByName("bank2").get(), "value", 2.0);
+    pmap.addDouble(instrument->getDetector(1).get(), "value", 3.0);
+    pmap.addDouble(instrument->getDetector(2).get(), "other", 4.0);
+
+    const auto &detectorInfo = pmap.detectorInfo();
+    const auto params = pmap.getRecursiveForDetectors("VALUE");
+    TS_ASSERT_EQUALS(params.size(), detectorInfo.size());
+    for (size_t i = 0; i < params.size(); ++i) {
+      const auto detector =
+          instrument->getDetector(detectorInfo.detectorIDs()[i]);
+      TS_ASSERT_EQUALS(params[i], pmap.getRecursive(detector.get(), "value"));
+    }
+    const auto index = detectorInfo.indexOf(1);
+    TS_ASSERT_EQUALS(params[index]->value<double>(), 3.0);
+    TS_ASSERT(pmap.getRecursiveForDetectors("value", ParameterMap::pInt())
+                  .front() == nullptr);
+  }
+
+  void test_getRecursiveForDetectors_throws_without_instrument() {
+    ParameterMap pmap;
+    TS_ASSERT_THROWS(pmap.getRecursiveForDetectors("value"),
+                     std::runtime_error);
+  }
+
   void testClearByName_Only_Removes_Named_Parameter() {
     ParameterMap pmap;
     pmap.addDouble(m_testInstrument.get(), "first", 5.4);
@@ -775,6 +822,20 @@ public:
     TS_ASSERT_DELTA(11.0, par_sptr->value<double>(), 1e-12);
   }
 
+  void test_Inst_Par_Lookup_Via_GetRecursiveForDetectors() {
+    auto instrument =
+        ComponentCreationHelper::createTestInstrumentRectangular(10, 100);
+    ParameterMap pmap;
+    pmap.setInstrument(instrument.get());
+    pmap.addDouble(instrument->getComponentID(), "instlevel", 10.0);
+
+    std::vector<Mantid::Geometry::Parameter_sptr> params;
+    for (size_t i = 0; i < 10; ++i) {
+      params = pmap.getRecursiveForDetectors("instlevel");
+    }
+    TS_ASSERT_DELTA(10.0, params.back()->value<double>(), 1e-12);
+  }
+
   void test_Leaf_Par_Lookup_Via_Get_And_Leaf_Component() {
     Mantid::Geometry::Parameter_sptr par_sptr;
 
@@ -63,6 +63,7 @@ public:
     auto shape = ComponentCreationHelper::createSphere(1.0);
     TS_ASSERT_THROWS_NOTHING(kit->add(shape));
     TS_ASSERT_EQUALS(4, kit->nelements());
+    TS_ASSERT_EQUALS(shape.get(), &kit->getComponent(3));
     TS_ASSERT_EQUALS(kit->name(), "TestKit");
     TS_ASSERT_EQUALS(kit->containerID(), "8mm");
   }
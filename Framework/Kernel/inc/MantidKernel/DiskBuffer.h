@@ -10,6 +10,7 @@
 #include <boost/multi_index/ordered_index.hpp>
 #include <boost/multi_index/sequenced_index.hpp>
 #endif
+#include <atomic>
 #include <cstdint>
 #include <limits>
 #include <list>
@@ -81,7 +82,7 @@ public:
   virtual ~DiskBuffer() = default;
 
   void toWrite(ISaveable *item);
-  void flushCache();
+  virtual void flushCache();
   void objectDeleted(ISaveable *item);
 
   // Free space map methods
@@ -123,13 +124,16 @@ public:
   //-------------------------------------------------------------------------------------------
   ///@return the position of the last allocated point in the file (for testing
   /// only!)
-  uint64_t getFileLength() const { return m_fileLength; }
+  uint64_t getFileLength() const { return m_fileLength.load(); }
 
   /** Set the length of the file that this MRU writes to.
    * @param length :: length in the same units as the cache, etc. (not
    * necessarily bytes)  */
   void setFileLength(const uint64_t length) const { m_fileLength = length; }
 
+  /// Grow the file length to at least the given length
+  void extendFileLength(const uint64_t length) const;
+
   //-------------------------------------------------------------------------------------------
 
 protected:
@@ -166,7 +170,8 @@ protected:
 
   // ----------------------- File object --------------------------------------
   /// Length of the file. This is where new blocks that don't fit get placed.
-  mutable uint64_t m_fileLength;
+  /// Atomic, as the file IO may read it while other threads save blocks.
+  mutable std::atomic<uint64_t> m_fileLength;
 
 private:
 };
@@ -0,0 +1,217 @@
+#ifndef MANTID_KERNEL_RADIXSORT_H_
+#define MANTID_KERNEL_RADIXSORT_H_
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <tbb/parallel_for.h>
+
+namespace Mantid {
+namespace Kernel {
+
+/** RadixSort : Least-significant-digit radix sort on 64-bit unsigned keys.
+
+  The keys are computed once per element and the elements are then
+  distributed byte by byte, from the least significant byte up. The counts
+  of every byte are gathered in a single pass over the keys, so passes in
+  which all keys share the same byte (typically the exponent and sign bytes
+  of time-of-flight values) are skipped entirely. The sort is stable and
+  needs scratch space for a second copy of the elements and keys.
+
+  parallelSort() splits the elements into chunks that are counted and
+  distributed by separate TBB tasks. Each chunk writes its elements of a
+  bucket after those of the chunks before it, so the sort stays stable.
+
+  Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+namespace RadixSort {
+
+/// Map a double onto an unsigned key with the same ordering
+inline uint64_t keyFromDouble(const double value) {
+  uint64_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  // Negative values have all bits flipped, positive ones only the sign bit
+  const uint64_t signBit = uint64_t(1) << 63;
+  return (bits & signBit) ? ~bits : (bits | signBit);
+}
+
+/// Map a key produced by keyFromDouble back onto the double
+inline double doubleFromKey(const uint64_t key) {
+  const uint64_t signBit = uint64_t(1) << 63;
+  const uint64_t bits = (key & signBit) ? (key & ~signBit) : ~key;
+  double value;
+  std::memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+/// Map a signed integer onto an unsigned key with the same ordering
+inline uint64_t keyFromInt64(const int64_t value) {
+  return static_cast<uint64_t>(value) ^ (uint64_t(1) << 63);
+}
+
+/** Sort a vector by a 64-bit unsigned key.
+ * @param values :: the elements to sort
+ * @param keyFunction :: callable returning the uint64_t key of an element
+ */
+template <typename T, typename KeyFunction>
+void sort(std::vector<T> &values, KeyFunction keyFunction) {
+  const size_t size = values.size();
+  if (size < 2)
+    return;
+
+  const size_t numBytes = sizeof(uint64_t);
+  std::vector<uint64_t> keys(size);
+  std::vector<std::array<size_t, 256>> counts(numBytes);
+  for (auto &count : counts)
+    count.fill(0);
+  for (size_t i = 0; i < size; ++i) {
+    const uint64_t key = keyFunction(values[i]);
+    keys[i] = key;
+    for (size_t byte = 0; byte < numBytes; ++byte)
+      ++counts[byte][(key >> (8 * byte)) & 0xFF];
+  }
+
+  std::vector<T> valuesBuffer;
+  std::vector<uint64_t> keysBuffer;
+  for (size_t byte = 0; byte < numBytes; ++byte) {
+    auto &count = counts[byte];
+    const size_t shift = 8 * byte;
+    // All keys share this byte: the pass would not move anything
+    if (count[(keys[0] >> shift) & 0xFF] == size)
+      continue;
+    if (valuesBuffer.empty()) {
+      valuesBuffer.resize(size);
+      keysBuffer.resize(size);
+    }
+
+    // Turn the counts into the first output position of each bucket
+    size_t offset = 0;
+    for (auto &bucket : count) {
+      const size_t bucketSize = bucket;
+      bucket = offset;
+      offset += bucketSize;
+    }
+    for (size_t i = 0; i < size; ++i) {
+      const size_t destination = count[(keys[i] >> shift) & 0xFF]++;
+      keysBuffer[destination] = keys[i];
+      valuesBuffer[destination] = std::move(values[i]);
+    }
+    keys.swap(keysBuffer);
+    values.swap(valuesBuffer);
+  }
+}
+
+/** Sort a vector by a 64-bit unsigned key, using TBB tasks for chunks of the
+ * elements. Call it through TaskRuntime::execute() to keep to the thread
+ * limit. The result is the same as that of sort().
+ * @param values :: the elements to sort
+ * @param keyFunction :: callable returning the uint64_t key of an element
+ * @param numChunks :: the number of chunks to split the elements into,
+ * typically the number of threads
+ */
+template <typename T, typename KeyFunction>
+void parallelSort(std::vector<T> &values, KeyFunction keyFunction,
+                  const size_t numChunks) {
+  const size_t size = values.size();
+  if (size < 2)
+    return;
+
+  const size_t numBytes = sizeof(uint64_t);
+  const size_t chunks = std::max(size_t(1), std::min(numChunks, size));
+  const auto chunkStart = [size, chunks](const size_t chunk) {
+    return size * chunk / chunks;
+  };
+
+  // Compute the keys, and count the bytes of the keys of each chunk
+  std::vector<uint64_t> keys(size);
+  std::vector<std::array<size_t, 256>> counts(chunks * numBytes);
+  tbb::parallel_for(size_t(0), chunks, [&](const size_t chunk) {
+    auto *chunkCounts = &counts[chunk * numBytes];
+    for (size_t byte = 0; byte < numBytes; ++byte)
+      chunkCounts[byte].fill(0);
+    for (size_t i = chunkStart(chunk); i < chunkStart(chunk + 1); ++i) {
+      const uint64_t key = keyFunction(values[i]);
+      keys[i] = key;
+      for (size_t byte = 0; byte < numBytes; ++byte)
+        ++chunkCounts[byte][(key >> (8 * byte)) & 0xFF];
+    }
+  });
+
+  std::vector<T> valuesBuffer;
+  std::vector<uint64_t> keysBuffer;
+  // Offsets in the output of the first element of each chunk and bucket
+  std::vector<std::array<size_t, 256>> offsets(chunks);
+  bool moved = false;
+  for (size_t byte = 0; byte < numBytes; ++byte) {
+    const size_t shift = 8 * byte;
+    // All keys share this byte: the pass would not move anything. The
+    // totals do not depend on the order of the elements.
+    const size_t firstBucket = (keys[0] >> shift) & 0xFF;
+    size_t firstBucketSize = 0;
+    for (size_t chunk = 0; chunk < chunks; ++chunk)
+      firstBucketSize += counts[chunk * numBytes + byte][firstBucket];
+    if (firstBucketSize == size)
+      continue;
+    if (valuesBuffer.empty()) {
+      valuesBuffer.resize(size);
+      keysBuffer.resize(size);
+    }
+
+    // The counts of the chunks are out of date once the elements have moved
+    if (moved) {
+      tbb::parallel_for(size_t(0), chunks, [&](const size_t chunk) {
+        auto &count = counts[chunk * numBytes + byte];
+        count.fill(0);
+        for (size_t i = chunkStart(chunk); i < chunkStart(chunk + 1); ++i)
+          ++count[(keys[i] >> shift) & 0xFF];
+      });
+    }
+
+    size_t offset = 0;
+    for (size_t bucket = 0; bucket < 256; ++bucket) {
+      for (size_t chunk = 0; chunk < chunks; ++chunk) {
+        offsets[chunk][bucket] = offset;
+        offset += counts[chunk * numBytes + byte][bucket];
+      }
+    }
+    tbb::parallel_for(size_t(0), chunks, [&](const size_t chunk) {
+      auto &chunkOffsets = offsets[chunk];
+      for (size_t i = chunkStart(chunk); i < chunkStart(chunk + 1); ++i) {
+        const size_t destination = chunkOffsets[(keys[i] >> shift) & 0xFF]++;
+        keysBuffer[destination] = keys[i];
+        valuesBuffer[destination] = std::move(values[i]);
+      }
+    });
+    keys.swap(keysBuffer);
+    values.swap(valuesBuffer);
+    moved = true;
+  }
+}
+
+} // namespace RadixSort
+} // namespace Kernel
+} // namespace Mantid
+
+#endif /* MANTID_KERNEL_RADIXSORT_H_ */
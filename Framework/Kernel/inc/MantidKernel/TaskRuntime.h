@@ -0,0 +1,74 @@
+#ifndef MANTID_KERNEL_TASKRUNTIME_H_
+#define MANTID_KERNEL_TASKRUNTIME_H_
+
+#include "MantidKernel/DllConfig.h"
+
+#include <functional>
+
+namespace Mantid {
+namespace Kernel {
+
+/** TaskRuntime : The single concurrency limit shared by the three kinds of
+  parallelism used in the framework.
+
+  - OpenMP loops (the PARALLEL_* macros of MultiThreaded.h) use the number of
+    threads set for the thread that runs them. Algorithm::execute() applies
+    the limit to its thread with applyToCurrentThread(), and nested OpenMP
+    regions run on one thread.
+  - ThreadPool uses maxThreads() threads by default. Its threads are limited
+    to a single OpenMP thread each, since the pool already keeps every core
+    busy.
+  - TBB algorithms are started through execute(), which runs them in a task
+    arena of maxThreads() threads. When called from a thread that is already
+    one of many, e.g. inside an OpenMP loop, they run on that thread only.
+
+  The limit is the MultiThreaded.MaxCores setting of the ConfigService, if
+  set, and otherwise the number of cores. It follows changes of the setting.
+
+  Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+namespace TaskRuntime {
+
+/// The maximum number of threads used by any parallel construct
+MANTID_KERNEL_DLL int maxThreads();
+/// Set the maximum number of threads; 0 means the number of cores
+MANTID_KERNEL_DLL void setMaxThreads(int numThreads);
+/// Set the maximum number of threads from MultiThreaded.MaxCores
+MANTID_KERNEL_DLL void setMaxThreadsToConfigValue();
+/// The number of cores found on this machine
+MANTID_KERNEL_DLL int numCores();
+
+/// Limit the calling thread, and the parallel work it starts, to numThreads
+MANTID_KERNEL_DLL void limitCurrentThread(int numThreads);
+/// Apply the limit to the OpenMP regions started by the calling thread
+MANTID_KERNEL_DLL void applyToCurrentThread();
+/// True if the calling thread is one of several already running in parallel
+MANTID_KERNEL_DLL bool inParallelRegion();
+
+/// Run a function starting TBB algorithms within the concurrency limit
+MANTID_KERNEL_DLL void execute(const std::function<void()> &function);
+
+} // namespace TaskRuntime
+} // namespace Kernel
+} // namespace Mantid
+
+#endif /* MANTID_KERNEL_TASKRUNTIME_H_ */
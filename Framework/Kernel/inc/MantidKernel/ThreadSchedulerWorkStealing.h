@@ -0,0 +1,112 @@
+#ifndef MANTID_KERNEL_THREADSCHEDULERWORKSTEALING_H_
+#define MANTID_KERNEL_THREADSCHEDULERWORKSTEALING_H_
+
+#include "MantidKernel/DllConfig.h"
+#include "MantidKernel/ThreadScheduler.h"
+
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Mantid {
+namespace Kernel {
+
+/** ThreadSchedulerWorkStealing : A ThreadScheduler that gives every thread of
+  the ThreadPool its own queue instead of sharing a single locked queue.
+
+  - Tasks pushed from a worker thread (e.g. sub-tasks created while running a
+    task) go on that thread's own queue. Tasks pushed from any other thread
+    are dealt out round-robin over all queues.
+  - A thread pops the most recently pushed task from its own queue, which is
+    likely to still be in its cache.
+  - A thread whose queue is empty steals the oldest task from the next
+    non-empty queue of another thread.
+
+  Each queue has its own mutex, so threads only contend when stealing from the
+  same queue. The cost of the pushed tasks is also kept per queue, so push()
+  takes no other lock. The number of tasks is kept in an atomic counter and
+  empty() and size() take no lock.
+
+  The number of queues should match the number of threads of the ThreadPool;
+  both default to ThreadPool::getNumPhysicalCores(). The number of steals and
+  the time threads spent without a task are counted to help tuning.
+
+  Tasks are not sorted by cost and their mutexes are not taken into account;
+  use ThreadSchedulerMutexes for tasks that need them.
+
+  Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+class MANTID_KERNEL_DLL ThreadSchedulerWorkStealing : public ThreadScheduler {
+public:
+  explicit ThreadSchedulerWorkStealing(size_t numQueues = 0);
+  ~ThreadSchedulerWorkStealing() override;
+
+  void push(Task *newTask) override;
+  Task *pop(size_t threadnum) override;
+  size_t size() override;
+  bool empty() override;
+  void clear() override;
+  double totalCost() override;
+
+  /// Number of per-thread queues
+  size_t numQueues() const { return m_queues.size(); }
+  /// Number of tasks taken from the queue of another thread
+  size_t numSteals() const { return m_numSteals.load(); }
+  double idleSeconds() const;
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  /// The tasks of one thread and the lock protecting them
+  struct Queue {
+    std::mutex lock;
+    std::deque<Task *> tasks;
+    /// Total cost of the tasks pushed to this queue
+    double cost{0.0};
+    /// Time of the first pop that found no task, if still waiting
+    Clock::time_point idleSince;
+    bool idle{false};
+    /// Accumulated time without a task, in nanoseconds
+    std::atomic<int64_t> idleNanoseconds{0};
+  };
+
+  Task *popOwn(Queue &queue);
+  Task *steal(size_t thief);
+  void recordIdleTime(Queue &queue, bool foundTask);
+
+  /// One queue per thread
+  std::vector<std::unique_ptr<Queue>> m_queues;
+  /// Number of queued tasks
+  std::atomic<size_t> m_size{0};
+  /// Next queue for tasks pushed from outside the pool
+  std::atomic<size_t> m_nextQueue{0};
+  /// Number of tasks taken from the queue of another thread
+  std::atomic<size_t> m_numSteals{0};
+};
+
+} // namespace Kernel
+} // namespace Mantid
+
+#endif /* MANTID_KERNEL_THREADSCHEDULERWORKSTEALING_H_ */
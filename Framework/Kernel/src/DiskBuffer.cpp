@@ -147,8 +147,7 @@ void DiskBuffer::writeOldObjects() {
             obj->saveAt(fileIndexStart, NumObjEvents);
             // this is questionable operation, which adjust file size in case
             // when the file postions were allocated externaly
-            if (fileIndexStart + NumObjEvents > m_fileLength)
-              m_fileLength = fileIndexStart + NumObjEvents;
+            this->extendFileLength(fileIndexStart + NumObjEvents);
           } else // just clean the object up -- it just occupies memory
             obj->clearDataFromMemory();
         }
@@ -304,11 +303,9 @@ uint64_t DiskBuffer::allocate(uint64_t const newSize) {
   if (putAtFileEnd) {
     // No block found
     // Go to the end of the file.
-    uint64_t retVal = m_fileLength;
     // And we assume the file will grow by this much.
-    m_fileLength += newSize;
     // Will place the new block at the end of the file
-    return retVal;
+    return m_fileLength.fetch_add(newSize);
   } else {
     //      std::cout << "Block found for allocate " << newSize << '\n';
     uint64_t foundPos = it->getFilePosition();
@@ -345,6 +342,17 @@ uint64_t DiskBuffer::relocate(uint64_t const oldPos, uint64_t const oldSize,
   return this->allocate(newSize);
 }
 
+//---------------------------------------------------------------------------------------------
+/** Grow the length of the file to the given length, if it is shorter. Safe
+ * to call while other threads allocate space or read the length.
+ * @param length :: new minimal length of the file */
+void DiskBuffer::extendFileLength(const uint64_t length) const {
+  uint64_t current = m_fileLength.load();
+  while (current < length &&
+         !m_fileLength.compare_exchange_weak(current, length)) {
+  }
+}
+
 //---------------------------------------------------------------------------------------------
 /** Returns a vector with two entries per free block: position and size.
  * @param[out] free :: vector to fill */
@@ -0,0 +1,181 @@
+#include "MantidKernel/TaskRuntime.h"
+#include "MantidKernel/ConfigService.h"
+#include "MantidKernel/Logger.h"
+#include "MantidKernel/MultiThreaded.h"
+
+#include <Poco/NObserver.h>
+#if defined(_WIN32) || !defined(_OPENMP)
+#include <Poco/Environment.h>
+#endif
+
+#include "tbb/task_arena.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <ostream>
+
+namespace Mantid {
+namespace Kernel {
+namespace TaskRuntime {
+
+namespace {
+/// static logger
+Logger g_log("TaskRuntime");
+
+/// The limit; 0 until it is first needed
+std::atomic<int> g_maxThreads{0};
+/// Serialises changes of the limit
+std::mutex g_limitMutex;
+/// Arena running the TBB algorithms, swapped when the limit changes
+std::shared_ptr<tbb::task_arena> g_arena;
+/// Limit of the calling thread, e.g. 1 for ThreadPool threads; 0 if none
+thread_local int t_threadLimit = 0;
+
+/// Number of OpenMP threads for the calling thread
+int threadsForCurrentThread() {
+  const int limit = maxThreads();
+  return t_threadLimit > 0 ? std::min(t_threadLimit, limit) : limit;
+}
+
+/// Keeps the limit in step with the MultiThreaded.MaxCores setting
+class ConfigListener {
+public:
+  ConfigListener()
+      : m_observer(*this, &ConfigListener::handleConfigChange) {
+    ConfigService::Instance().addObserver(m_observer);
+  }
+
+private:
+  void handleConfigChange(ConfigValChangeNotification_ptr notification) {
+    if (notification->key() == "MultiThreaded.MaxCores")
+      setMaxThreadsToConfigValue();
+  }
+
+  Poco::NObserver<ConfigListener, ConfigValChangeNotification> m_observer;
+};
+
+/// Set the limit from the configuration and start following it
+void initialize() {
+  static std::once_flag once;
+  std::call_once(once, []() {
+    setMaxThreadsToConfigValue();
+    // Deliberately never deleted: it may outlive the ConfigService
+    new ConfigListener;
+  });
+}
+} // namespace
+
+/// @return the maximum number of threads used by any parallel construct
+int maxThreads() {
+  if (g_maxThreads.load() == 0)
+    initialize();
+  return g_maxThreads.load();
+}
+
+/** Set the maximum number of threads. This applies to OpenMP loops of the
+ * calling thread and of algorithms executed afterwards, to the TBB algorithms
+ * started afterwards, and to new ThreadPools.
+ * @param numThreads :: the limit; 0 or less means the number of cores
+ */
+void setMaxThreads(int numThreads) {
+  // Count the cores before the OpenMP setting changes
+  const int cores = numCores();
+  if (numThreads <= 0)
+    numThreads = cores;
+  {
+    std::lock_guard<std::mutex> lock(g_limitMutex);
+    if (numThreads != g_maxThreads.load() || !std::atomic_load(&g_arena)) {
+      g_log.debug() << "Setting maximum number of threads to " << numThreads
+                    << "\n";
+      std::atomic_store(&g_arena,
+                        std::make_shared<tbb::task_arena>(numThreads));
+      g_maxThreads = numThreads;
+    }
+  }
+  applyToCurrentThread();
+}
+
+/** Set the maximum number of threads from the MultiThreaded.MaxCores setting,
+ * which cannot exceed the number of cores. The number of cores is used if
+ * the setting is missing or not positive.
+ */
+void setMaxThreadsToConfigValue() {
+  int maxCores(0);
+  const int retVal = ConfigService::Instance().getValue(
+      "MultiThreaded.MaxCores", maxCores);
+  if (retVal > 0 && maxCores > 0)
+    setMaxThreads(std::min(maxCores, numCores()));
+  else
+    setMaxThreads(numCores());
+}
+
+/** Return the number of cores available to the process.
+ * NOTE: Uses OpenMP, which follows OMP_NUM_THREADS, or
+ * Poco::Environment::processorCount() to find the number.
+ * @return how many cores are present.
+ */
+int numCores() {
+  static const int cores = []() {
+// windows hangs with openmp for some reason
+#if defined(_WIN32) || !defined(_OPENMP)
+    return static_cast<int>(Poco::Environment::processorCount());
+#else
+    return PARALLEL_GET_MAX_THREADS;
+#endif
+  }();
+  return cores;
+}
+
+/** Limit the calling thread to fewer threads than maxThreads(), e.g. because
+ * it is one of several threads of a pool.
+ * @param numThreads :: the limit; 0 removes it
+ */
+void limitCurrentThread(int numThreads) {
+  t_threadLimit = std::max(numThreads, 0);
+  applyToCurrentThread();
+}
+
+/** Set the number of threads used by the OpenMP regions that the calling
+ * thread starts. The setting is per thread, so every thread running
+ * algorithms needs to call this.
+ */
+void applyToCurrentThread() {
+  PARALLEL_SET_NUM_THREADS(threadsForCurrentThread());
+#if defined(_OPENMP) && _OPENMP >= 200805
+  // Nested regions would multiply the number of threads
+  omp_set_max_active_levels(1);
+#endif
+}
+
+/// @return true if the calling thread is one of several already in parallel
+bool inParallelRegion() {
+#ifdef _OPENMP
+  if (omp_in_parallel())
+    return true;
+#endif
+  return t_threadLimit == 1;
+}
+
+/** Run a function that starts TBB algorithms (parallel_for, parallel_sort...)
+ * so that they use at most maxThreads() threads. If the calling thread is
+ * already one of several running in parallel the algorithms run on the
+ * calling thread only, rather than adding threads on top of the busy ones.
+ * @param function :: the function to run; exceptions are passed on
+ */
+void execute(const std::function<void()> &function) {
+  if (inParallelRegion()) {
+    thread_local tbb::task_arena serialArena(1, 1);
+    serialArena.execute(function);
+    return;
+  }
+  if (g_maxThreads.load() == 0)
+    initialize();
+  const auto arena = std::atomic_load(&g_arena);
+  arena->execute(function);
+}
+
+} // namespace TaskRuntime
+} // namespace Kernel
+} // namespace Mantid
@@ -3,10 +3,9 @@
 //----------------------------------------------------------------------
 #include "MantidKernel/ThreadPool.h"
 
-#include "MantidKernel/ConfigService.h"
-#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/ProgressBase.h"
 #include "MantidKernel/Task.h"
+#include "MantidKernel/TaskRuntime.h"
 #include "MantidKernel/ThreadPoolRunnable.h"
 
 #include <Poco/Thread.h>
@@ -14,10 +13,6 @@
 #include <algorithm>
 #include <stdexcept>
 #include <sstream>
-// needed on windows and any place missing openmp
-#if defined(_WIN32) || !defined(_OPENMP)
-#include <Poco/Environment.h>
-#endif
 
 namespace Mantid {
 namespace Kernel {
@@ -61,25 +56,14 @@ ThreadPool::~ThreadPool() {
 }
 
 //--------------------------------------------------------------------------------
-/** Return the number of physical cores available on the system.
- * NOTE: Uses OPENMP or Poco::Environment::processorCount() to find the number.
+/** Return the number of threads a ThreadPool uses by default: the number of
+ * physical cores, limited by MultiThreaded.MaxCores.
+ * NOTE: This is the concurrency limit shared with OpenMP and TBB, see
+ * TaskRuntime::maxThreads().
  * @return how many cores are present.
  */
 size_t ThreadPool::getNumPhysicalCores() {
-// windows hangs with openmp for some reason
-#if defined(_WIN32) || !defined(_OPENMP)
-  int physicalCores = Poco::Environment::processorCount();
-#else
-  int physicalCores = PARALLEL_GET_MAX_THREADS;
-#endif
-
-  int maxCores(0);
-  int retVal = Kernel::ConfigService::Instance().getValue(
-      "MultiThreaded.MaxCores", maxCores);
-  if (retVal > 0 && maxCores > 0)
-    return std::min(maxCores, physicalCores);
-  else
-    return physicalCores;
+  return static_cast<size_t>(TaskRuntime::maxThreads());
 }
 
 //--------------------------------------------------------------------------------
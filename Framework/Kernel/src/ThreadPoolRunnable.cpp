@@ -1,5 +1,6 @@
 #include "MantidKernel/ProgressBase.h"
 #include "MantidKernel/Task.h"
+#include "MantidKernel/TaskRuntime.h"
 #include "MantidKernel/ThreadPoolRunnable.h"
 #include "MantidKernel/ThreadScheduler.h"
 
@@ -40,6 +41,10 @@ void ThreadPoolRunnable::clearWait() { m_waitSec = 0.0; }
 void ThreadPoolRunnable::run() {
   Task *task;
 
+  // The pool keeps the cores busy, so parallel code within the tasks must not
+  // start more threads
+  TaskRuntime::limitCurrentThread(1);
+
   // If there are no tasks yet, wait up to m_waitSec for them to come up
   while (m_scheduler->empty() && m_waitSec > 0.0) {
     Poco::Thread::sleep(10); // millisec
@@ -0,0 +1,161 @@
+#include "MantidKernel/ThreadSchedulerWorkStealing.h"
+#include "MantidKernel/ThreadPool.h"
+
+namespace Mantid {
+namespace Kernel {
+
+namespace {
+/// The scheduler whose queue the current thread last popped from
+thread_local const ThreadSchedulerWorkStealing *currentScheduler = nullptr;
+/// The queue of the current thread in currentScheduler
+thread_local size_t currentQueue = 0;
+} // namespace
+
+/** Constructor
+ *
+ * @param numQueues :: number of per-thread queues, which should be the number
+ *        of threads of the ThreadPool; default = 0, meaning the number of
+ *        threads the ThreadPool uses by default.
+ */
+ThreadSchedulerWorkStealing::ThreadSchedulerWorkStealing(size_t numQueues) {
+  if (numQueues == 0)
+    numQueues = ThreadPool::getNumPhysicalCores();
+  m_queues.reserve(numQueues);
+  for (size_t i = 0; i < numQueues; ++i)
+    m_queues.emplace_back(new Queue);
+}
+
+ThreadSchedulerWorkStealing::~ThreadSchedulerWorkStealing() { clear(); }
+
+//----------------------------------------------------------------------------
+/** Add a Task to the queue of the calling thread, or to the next queue if the
+ * caller is not one of the threads popping from this scheduler.
+ * @param newTask :: Task to add to queue
+ */
+void ThreadSchedulerWorkStealing::push(Task *newTask) {
+  size_t index;
+  if (currentScheduler == this && currentQueue < m_queues.size())
+    index = currentQueue;
+  else
+    index = m_nextQueue.fetch_add(1) % m_queues.size();
+
+  Queue &queue = *m_queues[index];
+  std::lock_guard<std::mutex> lock(queue.lock);
+  queue.tasks.push_back(newTask);
+  queue.cost += newTask->cost();
+  ++m_size;
+}
+
+//----------------------------------------------------------------------------
+/** Retrieves the newest Task of the calling thread's queue or, if that is
+ * empty, steals the oldest Task of another queue.
+ * @param threadnum :: ID of the calling thread.
+ * @return a Task pointer to execute, or NULL if all queues are empty.
+ */
+Task *ThreadSchedulerWorkStealing::pop(size_t threadnum) {
+  const size_t index = threadnum % m_queues.size();
+  currentScheduler = this;
+  currentQueue = index;
+
+  Queue &queue = *m_queues[index];
+  Task *task = popOwn(queue);
+  if (!task)
+    task = steal(index);
+  recordIdleTime(queue, task != nullptr);
+  return task;
+}
+
+/// @return the newest task of the queue, or NULL if it is empty
+Task *ThreadSchedulerWorkStealing::popOwn(Queue &queue) {
+  std::lock_guard<std::mutex> lock(queue.lock);
+  if (queue.tasks.empty())
+    return nullptr;
+  Task *task = queue.tasks.back();
+  queue.tasks.pop_back();
+  --m_size;
+  return task;
+}
+
+/** Take the oldest task from the first non-empty queue after that of the thief
+ * @param thief :: index of the queue of the calling thread
+ * @return the stolen task, or NULL if all other queues are empty
+ */
+Task *ThreadSchedulerWorkStealing::steal(size_t thief) {
+  const size_t numQueues = m_queues.size();
+  for (size_t offset = 1; offset < numQueues && m_size > 0; ++offset) {
+    Queue &victim = *m_queues[(thief + offset) % numQueues];
+    std::lock_guard<std::mutex> lock(victim.lock);
+    if (victim.tasks.empty())
+      continue;
+    Task *task = victim.tasks.front();
+    victim.tasks.pop_front();
+    --m_size;
+    ++m_numSteals;
+    return task;
+  }
+  return nullptr;
+}
+
+/** Accumulate the time between the first pop of a thread that found no task
+ * and the next one that did.
+ * @param queue :: the queue of the calling thread
+ * @param foundTask :: true if the pop returned a task
+ */
+void ThreadSchedulerWorkStealing::recordIdleTime(Queue &queue,
+                                                 bool foundTask) {
+  if (foundTask) {
+    if (queue.idle) {
+      const auto idle = Clock::now() - queue.idleSince;
+      queue.idleNanoseconds +=
+          std::chrono::duration_cast<std::chrono::nanoseconds>(idle).count();
+      queue.idle = false;
+    }
+  } else if (!queue.idle) {
+    queue.idleSince = Clock::now();
+    queue.idle = true;
+  }
+}
+
+//----------------------------------------------------------------------------
+/// @return the number of tasks in all queues
+size_t ThreadSchedulerWorkStealing::size() { return m_size; }
+
+/// @return true if all queues are empty
+bool ThreadSchedulerWorkStealing::empty() { return m_size == 0; }
+
+/// Empty out all queues, deleting the tasks
+void ThreadSchedulerWorkStealing::clear() {
+  for (auto &queue : m_queues) {
+    std::lock_guard<std::mutex> lock(queue->lock);
+    for (auto task : queue->tasks)
+      delete task;
+    m_size -= queue->tasks.size();
+    queue->tasks.clear();
+    queue->cost = 0.0;
+  }
+}
+
+/// @return the total cost of the tasks pushed since the last clear()
+double ThreadSchedulerWorkStealing::totalCost() {
+  double total = 0.0;
+  for (auto &queue : m_queues) {
+    std::lock_guard<std::mutex> lock(queue->lock);
+    total += queue->cost;
+  }
+  return total;
+}
+
+/** Total time that threads spent between a pop that found no task and the
+ * next pop that found one. Time spent waiting after the last task is not
+ * included.
+ * @return the idle time summed over all threads, in seconds
+ */
+double ThreadSchedulerWorkStealing::idleSeconds() const {
+  int64_t total = 0;
+  for (const auto &queue : m_queues)
+    total += queue->idleNanoseconds.load();
+  return static_cast<double>(total) * 1e-9;
+}
+
+} // namespace Kernel
+} // namespace Mantid
@@ -442,6 +442,23 @@ public:
       mru2.allocate(20);
   }
 
+  /// The file length only grows and is not lost when extended in parallel
+  void test_extendFileLength() {
+    DiskBuffer dbuf(3);
+    dbuf.setFileLength(1000);
+    dbuf.extendFileLength(10);
+    TS_ASSERT_EQUALS(dbuf.getFileLength(), 1000);
+    dbuf.extendFileLength(1010);
+    TS_ASSERT_EQUALS(dbuf.getFileLength(), 1010);
+
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int i = 0; i < 10000; i++) {
+      dbuf.extendFileLength(static_cast<uint64_t>(i));
+      dbuf.allocate(1);
+    }
+    TS_ASSERT_EQUALS(dbuf.getFileLength(), 11010);
+  }
+
   /// Various tests of allocating and relocating
   void test_allocate_and_relocate() {
     DiskBuffer dbuf(3);
@@ -0,0 +1,146 @@
+#ifndef MANTID_KERNEL_RADIXSORTTEST_H_
+#define MANTID_KERNEL_RADIXSORTTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidKernel/RadixSort.h"
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <utility>
+
+using namespace Mantid::Kernel;
+
+class RadixSortTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static RadixSortTest *createSuite() { return new RadixSortTest(); }
+  static void destroySuite(RadixSortTest *suite) { delete suite; }
+
+  void test_keyFromDouble_preserves_order() {
+    std::vector<double> values{-std::numeric_limits<double>::infinity(),
+                               -1e300,
+                               -2.5,
+                               -std::numeric_limits<double>::min(),
+                               0.,
+                               std::numeric_limits<double>::min(),
+                               1.,
+                               1.0000000000000002,
+                               1e300,
+                               std::numeric_limits<double>::infinity()};
+    for (size_t i = 1; i < values.size(); ++i)
+      TS_ASSERT_LESS_THAN(RadixSort::keyFromDouble(values[i - 1]),
+                          RadixSort::keyFromDouble(values[i]));
+  }
+
+  void test_doubleFromKey_inverts_keyFromDouble() {
+    for (const double value : {-1e300, -2.5, -0., 0., 1e-310, 1., 1e300})
+      TS_ASSERT_EQUALS(
+          RadixSort::doubleFromKey(RadixSort::keyFromDouble(value)), value);
+  }
+
+  void test_keyFromInt64_preserves_order() {
+    std::vector<int64_t> values{std::numeric_limits<int64_t>::min(), -1000,
+                                -1, 0, 1, 1000,
+                                std::numeric_limits<int64_t>::max()};
+    for (size_t i = 1; i < values.size(); ++i)
+      TS_ASSERT_LESS_THAN(RadixSort::keyFromInt64(values[i - 1]),
+                          RadixSort::keyFromInt64(values[i]));
+  }
+
+  void test_sort_doubles() {
+    std::mt19937 generator(1234);
+    std::uniform_real_distribution<double> distribution(-1e4, 1e5);
+    std::vector<double> values(10000);
+    for (auto &value : values)
+      value = distribution(generator);
+    auto expected = values;
+    std::sort(expected.begin(), expected.end());
+
+    RadixSort::sort(values, RadixSort::keyFromDouble);
+    TS_ASSERT_EQUALS(values, expected);
+  }
+
+  void test_sort_is_stable() {
+    // Sort on the first member only; the second records the input order
+    std::vector<std::pair<int64_t, int>> values;
+    for (int i = 0; i < 1000; ++i)
+      values.emplace_back((i * 7919) % 13 - 6, i);
+    auto expected = values;
+    std::stable_sort(expected.begin(), expected.end(),
+                     [](const std::pair<int64_t, int> &lhs,
+                        const std::pair<int64_t, int> &rhs) {
+                       return lhs.first < rhs.first;
+                     });
+
+    RadixSort::sort(values, [](const std::pair<int64_t, int> &value) {
+      return RadixSort::keyFromInt64(value.first);
+    });
+    TS_ASSERT_EQUALS(values, expected);
+  }
+
+  void test_sort_short_and_uniform_vectors() {
+    std::vector<double> empty;
+    RadixSort::sort(empty, RadixSort::keyFromDouble);
+    TS_ASSERT(empty.empty());
+
+    std::vector<double> same(100, 3.);
+    RadixSort::sort(same, RadixSort::keyFromDouble);
+    TS_ASSERT_EQUALS(same, std::vector<double>(100, 3.));
+  }
+
+  void test_parallelSort_doubles() {
+    std::mt19937 generator(1234);
+    std::uniform_real_distribution<double> distribution(-1e4, 1e5);
+    std::vector<double> values(300000);
+    for (auto &value : values)
+      value = distribution(generator);
+    auto expected = values;
+    std::sort(expected.begin(), expected.end());
+
+    for (const size_t numChunks : {1, 3, 8}) {
+      auto sorted = values;
+      RadixSort::parallelSort(sorted, RadixSort::keyFromDouble, numChunks);
+      TS_ASSERT_EQUALS(sorted, expected);
+    }
+  }
+
+  void test_parallelSort_is_stable() {
+    // Sort on the first member only; the second records the input order
+    std::vector<std::pair<int64_t, int>> values;
+    for (int i = 0; i < 100000; ++i)
+      values.emplace_back((i * 7919) % 1013 - 500, i);
+    auto expected = values;
+    std::stable_sort(expected.begin(), expected.end(),
+                     [](const std::pair<int64_t, int> &lhs,
+                        const std::pair<int64_t, int> &rhs) {
+                       return lhs.first < rhs.first;
+                     });
+
+    RadixSort::parallelSort(values,
+                            [](const std::pair<int64_t, int> &value) {
+                              return RadixSort::keyFromInt64(value.first);
+                            },
+                            7);
+    TS_ASSERT_EQUALS(values, expected);
+  }
+
+  void test_parallelSort_short_and_uniform_vectors() {
+    std::vector<double> empty;
+    RadixSort::parallelSort(empty, RadixSort::keyFromDouble, 4);
+    TS_ASSERT(empty.empty());
+
+    // More chunks than elements
+    std::vector<double> few{3., -1., 2.};
+    RadixSort::parallelSort(few, RadixSort::keyFromDouble, 8);
+    TS_ASSERT_EQUALS(few, std::vector<double>({-1., 2., 3.}));
+
+    std::vector<double> same(100, 3.);
+    RadixSort::parallelSort(same, RadixSort::keyFromDouble, 4);
+    TS_ASSERT_EQUALS(same, std::vector<double>(100, 3.));
+  }
+};
+
+#endif /* MANTID_KERNEL_RADIXSORTTEST_H_ */
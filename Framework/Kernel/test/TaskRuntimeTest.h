@@ -0,0 +1,89 @@
+#ifndef MANTID_KERNEL_TASKRUNTIMETEST_H_
+#define MANTID_KERNEL_TASKRUNTIMETEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidKernel/ConfigService.h"
+#include "MantidKernel/MultiThreaded.h"
+#include "MantidKernel/TaskRuntime.h"
+#include "MantidKernel/ThreadPool.h"
+
+#include "tbb/task_arena.h"
+
+#include <stdexcept>
+#include <thread>
+
+using namespace Mantid::Kernel;
+
+class TaskRuntimeTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static TaskRuntimeTest *createSuite() { return new TaskRuntimeTest(); }
+  static void destroySuite(TaskRuntimeTest *suite) { delete suite; }
+
+  void tearDown() override {
+    TaskRuntime::limitCurrentThread(0);
+    TaskRuntime::setMaxThreadsToConfigValue();
+  }
+
+  void test_limit_applies_to_OpenMP_TBB_and_ThreadPool() {
+    TaskRuntime::setMaxThreads(3);
+    TS_ASSERT_EQUALS(TaskRuntime::maxThreads(), 3);
+    TS_ASSERT_EQUALS(ThreadPool::getNumPhysicalCores(), 3);
+#ifdef _OPENMP
+    TS_ASSERT_EQUALS(PARALLEL_GET_MAX_THREADS, 3);
+#endif
+    int concurrency = 0;
+    TaskRuntime::execute([&concurrency]() {
+      concurrency = tbb::this_task_arena::max_concurrency();
+    });
+    TS_ASSERT_EQUALS(concurrency, 3);
+  }
+
+  void test_zero_means_number_of_cores() {
+    TaskRuntime::setMaxThreads(0);
+    TS_ASSERT_EQUALS(TaskRuntime::maxThreads(), TaskRuntime::numCores());
+    TS_ASSERT_LESS_THAN_EQUALS(1, TaskRuntime::numCores());
+  }
+
+  void test_follows_MaxCores_setting() {
+    auto &config = ConfigService::Instance();
+    const std::string previous = config.getString("MultiThreaded.MaxCores");
+    config.setString("MultiThreaded.MaxCores", "1");
+    TS_ASSERT_EQUALS(TaskRuntime::maxThreads(), 1);
+    config.setString("MultiThreaded.MaxCores", previous);
+  }
+
+  void test_limited_thread_counts_as_parallel() {
+    TS_ASSERT(!TaskRuntime::inParallelRegion());
+    TaskRuntime::limitCurrentThread(1);
+    TS_ASSERT(TaskRuntime::inParallelRegion());
+#ifdef _OPENMP
+    TS_ASSERT_EQUALS(PARALLEL_GET_MAX_THREADS, 1);
+#endif
+    TaskRuntime::limitCurrentThread(0);
+    TS_ASSERT(!TaskRuntime::inParallelRegion());
+  }
+
+  void test_execute_within_parallel_region_uses_calling_thread() {
+    TaskRuntime::limitCurrentThread(1);
+    const auto caller = std::this_thread::get_id();
+    std::thread::id runner;
+    int concurrency = 0;
+    TaskRuntime::execute([&runner, &concurrency]() {
+      runner = std::this_thread::get_id();
+      concurrency = tbb::this_task_arena::max_concurrency();
+    });
+    TS_ASSERT_EQUALS(runner, caller);
+    TS_ASSERT_EQUALS(concurrency, 1);
+  }
+
+  void test_execute_passes_on_exceptions() {
+    TS_ASSERT_THROWS(TaskRuntime::execute(
+                         []() { throw std::runtime_error("task failed"); }),
+                     std::runtime_error);
+  }
+};
+
+#endif /* MANTID_KERNEL_TASKRUNTIMETEST_H_ */
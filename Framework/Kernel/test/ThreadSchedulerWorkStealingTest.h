@@ -0,0 +1,136 @@
+#ifndef MANTID_KERNEL_THREADSCHEDULERWORKSTEALINGTEST_H_
+#define MANTID_KERNEL_THREADSCHEDULERWORKSTEALINGTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidKernel/FunctionTask.h"
+#include "MantidKernel/ThreadPool.h"
+#include "MantidKernel/ThreadSchedulerWorkStealing.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace Mantid::Kernel;
+
+class ThreadSchedulerWorkStealingTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static ThreadSchedulerWorkStealingTest *createSuite() {
+    return new ThreadSchedulerWorkStealingTest();
+  }
+  static void destroySuite(ThreadSchedulerWorkStealingTest *suite) {
+    delete suite;
+  }
+
+  class TaskCountDeletes : public Task {
+  public:
+    TaskCountDeletes(int &deleted, double cost = 1.0)
+        : Task(cost), m_deleted(deleted) {}
+    ~TaskCountDeletes() override { ++m_deleted; }
+    void run() override {}
+
+  private:
+    int &m_deleted;
+  };
+
+  void test_push_size_and_clear() {
+    int deleted = 0;
+    ThreadSchedulerWorkStealing sc(3);
+    TS_ASSERT_EQUALS(sc.numQueues(), 3);
+    TS_ASSERT(sc.empty());
+    for (int i = 0; i < 5; ++i)
+      sc.push(new TaskCountDeletes(deleted, 2.0));
+    TS_ASSERT_EQUALS(sc.size(), 5);
+    TS_ASSERT(!sc.empty());
+    TS_ASSERT_DELTA(sc.totalCost(), 10.0, 1e-9);
+    sc.clear();
+    TS_ASSERT(sc.empty());
+    TS_ASSERT_EQUALS(deleted, 5);
+    TS_ASSERT_EQUALS(sc.totalCost(), 0.0);
+  }
+
+  void test_totalCost_of_tasks_pushed_from_several_threads() {
+    int deleted = 0;
+    ThreadSchedulerWorkStealing sc(4);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i)
+      threads.emplace_back([&sc, &deleted]() {
+        for (int j = 0; j < 1000; ++j)
+          sc.push(new TaskCountDeletes(deleted, 0.5));
+      });
+    for (auto &thread : threads)
+      thread.join();
+    TS_ASSERT_EQUALS(sc.size(), 4000);
+    TS_ASSERT_DELTA(sc.totalCost(), 2000.0, 1e-9);
+    sc.clear();
+    TS_ASSERT_EQUALS(sc.totalCost(), 0.0);
+  }
+
+  void test_default_number_of_queues_matches_ThreadPool() {
+    ThreadSchedulerWorkStealing sc;
+    TS_ASSERT_EQUALS(sc.numQueues(), ThreadPool::getNumPhysicalCores());
+  }
+
+  void test_pop_own_queue_newest_first_then_steal_oldest() {
+    int deleted = 0;
+    ThreadSchedulerWorkStealing sc(2);
+    // Pushed from outside the pool: dealt out to queues 0, 1, 0, 1
+    Task *tasks[4];
+    for (auto &task : tasks) {
+      task = new TaskCountDeletes(deleted);
+      sc.push(task);
+    }
+    // Thread 0 pops its newest task, then its oldest one
+    TS_ASSERT_EQUALS(sc.pop(0), tasks[2]);
+    TS_ASSERT_EQUALS(sc.pop(0), tasks[0]);
+    TS_ASSERT_EQUALS(sc.numSteals(), 0);
+    // Then steals the oldest task of thread 1
+    TS_ASSERT_EQUALS(sc.pop(0), tasks[1]);
+    TS_ASSERT_EQUALS(sc.numSteals(), 1);
+    TS_ASSERT_EQUALS(sc.pop(1), tasks[3]);
+    TS_ASSERT_EQUALS(sc.pop(1), static_cast<Task *>(nullptr));
+    TS_ASSERT(sc.empty());
+    for (auto task : tasks)
+      delete task;
+  }
+
+  void test_push_from_a_worker_goes_to_its_own_queue() {
+    int deleted = 0;
+    ThreadSchedulerWorkStealing sc(4);
+    TS_ASSERT_EQUALS(sc.pop(2), static_cast<Task *>(nullptr));
+    // This thread is now known as thread 2
+    Task *task = new TaskCountDeletes(deleted);
+    sc.push(task);
+    TS_ASSERT_EQUALS(sc.pop(2), task);
+    TS_ASSERT_EQUALS(sc.numSteals(), 0);
+    TS_ASSERT_LESS_THAN_EQUALS(0.0, sc.idleSeconds());
+    delete task;
+  }
+
+  void test_ThreadPool_runs_all_tasks() {
+    std::atomic<int> counter{0};
+    ThreadPool pool(new ThreadSchedulerWorkStealing(4), 4);
+    for (int i = 0; i < 1000; ++i)
+      pool.schedule(new FunctionTask([&counter]() { ++counter; }));
+    pool.joinAll();
+    TS_ASSERT_EQUALS(counter, 1000);
+  }
+
+  void test_ThreadPool_runs_tasks_pushed_by_tasks() {
+    std::atomic<int> counter{0};
+    auto scheduler = new ThreadSchedulerWorkStealing(4);
+    ThreadPool pool(scheduler, 4);
+    // A few large tasks that each create many small ones on their own queue
+    for (int i = 0; i < 4; ++i)
+      pool.schedule(new FunctionTask([scheduler, &counter]() {
+        for (int j = 0; j < 500; ++j)
+          scheduler->push(new FunctionTask([&counter]() { ++counter; }));
+      }));
+    pool.joinAll();
+    TS_ASSERT_EQUALS(counter, 2000);
+  }
+};
+
+#endif /* MANTID_KERNEL_THREADSCHEDULERWORKSTEALINGTEST_H_ */
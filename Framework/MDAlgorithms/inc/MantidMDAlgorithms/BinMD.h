@@ -63,11 +63,29 @@ private:
   template <typename MDE, size_t nd>
   void binByIterating(typename DataObjects::MDEventWorkspace<MDE, nd>::sptr ws);
 
+  /// Bin a file-backed workspace on several threads
+  template <typename MDE, size_t nd>
+  void binFileBackedInParallel(
+      typename DataObjects::MDEventWorkspace<MDE, nd>::sptr ws);
+
   /// Method to bin a single MDBox
   template <typename MDE, size_t nd>
   void binMDBox(DataObjects::MDBox<MDE, nd> *box, const size_t *const chunkMin,
                 const size_t *const chunkMax);
 
+  /// Find the single bin holding a whole MDBox, if there is one
+  template <typename MDE, size_t nd>
+  bool getSingleBinIndex(DataObjects::MDBox<MDE, nd> *box,
+                         const size_t *const chunkMin,
+                         const size_t *const chunkMax,
+                         size_t &linearIndex) const;
+
+  /// Add events to the given signal, error and number of events arrays
+  template <typename MDE, size_t nd>
+  void binEvents(const std::vector<MDE> &events, const size_t *const chunkMin,
+                 const size_t *const chunkMax, signal_t *signalArray,
+                 signal_t *errorArray, signal_t *numEventsArray) const;
+
   /// The output MDHistoWorkspace
   Mantid::DataObjects::MDHistoWorkspace_sptr outWS;
   /// Progress reporting
@@ -61,15 +61,42 @@ public:
   void runConversion(API::Progress *pProgress) override;
 
 private:
+  /// MD events converted from a number of spectra, before they are added to
+  /// the workspace
+  struct EventBuffer {
+    std::vector<coord_t> coord;
+    std::vector<float> sigErr;
+    std::vector<uint16_t> runIndex;
+    std::vector<uint32_t> detIds;
+    size_t size() const { return runIndex.size(); }
+    void clear() {
+      coord.clear();
+      sigErr.clear();
+      runIndex.clear();
+      detIds.clear();
+    }
+  };
+  /// Number of events a conversion task buffers before adding them
+  enum { EVENTS_PER_ADD = 65536 };
+  /// Number of conversion tasks per core, to balance uneven spectra
+  enum { TASKS_PER_CORE = 8 };
+
   // function runs the conversion on
   size_t conversionChunk(size_t workspaceIndex) override;
+  // converts a range of spectra, adding the events from one task
+  void convertSpectraAndSplit(size_t firstIndex, size_t lastIndex);
+  size_t convertSpectrum(size_t workspaceIndex, MDTransfInterface &qConverter,
+                         EventBuffer &buffer);
+  void addAndSplit(EventBuffer &buffer);
   // the pointer to the source event workspace as event ws does not work through
   // the public Matrix WS interface
   DataObjects::EventWorkspace_const_sptr m_EventWS;
 
-  /**function converts particular type of events into MD space and add these
-   * events to the workspace itself    */
-  template <class T> size_t convertEventList(size_t workspaceIndex);
+  /**function converts particular type of events into MD space and appends
+   * these events to the buffer */
+  template <class T>
+  size_t convertEventList(size_t workspaceIndex, MDTransfInterface &qConverter,
+                          EventBuffer &buffer);
 };
 
 } // endNamespace DataObjects
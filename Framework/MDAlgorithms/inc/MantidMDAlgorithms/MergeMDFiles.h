@@ -73,6 +73,7 @@ private:
   void finalizeOutput(const std::string &outputFile);
 
   uint64_t loadEventsFromSubBoxes(API::IMDNode *TargetBox);
+  void readAheadSubBoxes(API::IMDNode *TargetBox);
 
   // the class which flatten the box structure and deal with it
   DataObjects::MDBoxFlatTree m_BoxStruct;
@@ -12,10 +12,18 @@
 #include "MantidGeometry/MDGeometry/MDHistoDimension.h"
 #include "MantidKernel/CPUTimer.h"
 #include "MantidKernel/EnabledWhenProperty.h"
+#include "MantidKernel/FunctionTask.h"
+#include "MantidKernel/Memory.h"
 #include "MantidKernel/Strings.h"
 #include "MantidKernel/System.h"
+#include "MantidKernel/ThreadPool.h"
+#include "MantidKernel/ThreadScheduler.h"
 #include "MantidKernel/Utils.h"
 #include <boost/algorithm/string.hpp>
+#include <boost/make_shared.hpp>
+
+#include <mutex>
+#include <numeric>
 
 namespace Mantid {
 namespace MDAlgorithms {
@@ -28,6 +36,12 @@ using namespace Mantid::API;
 using namespace Mantid::Geometry;
 using namespace Mantid::DataObjects;
 
+namespace {
+/// Largest number of events read from file at once when binning file-backed
+/// workspaces in parallel
+const uint64_t FILE_BACKED_BATCH_EVENTS = 1 << 20;
+} // namespace
+
 //----------------------------------------------------------------------------------------------
 /** Constructor
  */
@@ -66,9 +80,9 @@ void BinMD::init() {
 
   declareProperty(
       make_unique<PropertyWithValue<bool>>("Parallel", false, Direction::Input),
-      "Temporary parameter: true to run in parallel. This is ignored for "
-      "file-backed workspaces, where running in parallel makes things slower "
-      "due to disk thrashing.");
+      "Temporary parameter: true to run in parallel. For file-backed "
+      "workspaces the boxes are read in file order, in large contiguous "
+      "blocks, while other threads bin the blocks already read.");
   setPropertyGroup("Parallel", grp);
 
   declareProperty(make_unique<WorkspaceProperty<IMDHistoWorkspace>>(
@@ -95,95 +109,112 @@ void BinMD::init() {
 template <typename MDE, size_t nd>
 inline void BinMD::binMDBox(MDBox<MDE, nd> *box, const size_t *const chunkMin,
                             const size_t *const chunkMax) {
-  // An array to hold the rotated/transformed coordinates
-  auto outCenter = new coord_t[m_outD];
-
-  // Evaluate whether the entire box is in the same bin
-  if (box->getNPoints() > (1 << nd) * 2) {
-    // There is a check that the number of events is enough for it to make sense
-    // to do all this processing.
-    size_t numVertexes = 0;
-    coord_t *vertexes = box->getVertexesArray(numVertexes);
-
-    // All vertexes have to be within THE SAME BIN = have the same linear index.
-    size_t lastLinearIndex = 0;
-    bool badOne = false;
-
-    for (size_t i = 0; i < numVertexes; i++) {
-      // Cache the center of the event (again for speed)
-      const coord_t *inCenter = vertexes + i * nd;
-
-      // Now transform to the output dimensions
-      m_transform->apply(inCenter, outCenter);
-      // std::cout << "Input coord " << VMD(nd,inCenter) << " transformed to "
-      // <<  VMD(nd,outCenter) << '\n';
-
-      // To build up the linear index
-      size_t linearIndex = 0;
-      // To mark VERTEXES outside range
-      badOne = false;
+  size_t linearIndex = 0;
+  if (this->getSingleBinIndex(box, chunkMin, chunkMax, linearIndex)) {
+    // Yes, the entire box is within a single bin
+    // Add the CACHED signal from the entire box
+    signals[linearIndex] += box->getSignal();
+    errors[linearIndex] += box->getErrorSquared();
+    // TODO: If DataObjects get a weight, this would need to get the summed
+    // weight.
+    numEvents[linearIndex] += static_cast<signal_t>(box->getNPoints());
+
+    // And don't bother looking at each event. This may save lots of time
+    // loading from disk.
+    return;
+  }
 
-      /// Loop through the dimensions on which we bin
-      for (size_t bd = 0; bd < m_outD; bd++) {
-        // What is the bin index in that dimension
-        coord_t x = outCenter[bd];
-        size_t ix = size_t(x);
-        // Within range (for this chunk)?
-        if ((x >= 0) && (ix >= chunkMin[bd]) && (ix < chunkMax[bd])) {
-          // Build up the linear index
-          linearIndex += indexMultiplier[bd] * ix;
-        } else {
-          // Outside the range
-          badOne = true;
-          break;
-        }
-      } // (for each dim in MDHisto)
+  // If you get here, you could not determine that the entire box was in the
+  // same bin.
+  // So you need to iterate through events.
+  const std::vector<MDE> &events = box->getConstEvents();
+  this->binEvents<MDE, nd>(events, chunkMin, chunkMax, signals, errors,
+                           numEvents);
+  // Done with the events list
+  box->releaseEvents();
+}
 
-      // Is the vertex at the same place as the last one?
-      if (!badOne) {
-        if ((i > 0) && (linearIndex != lastLinearIndex)) {
-          // Change of index
-          badOne = true;
-          break;
-        }
-        lastLinearIndex = linearIndex;
-      }
+//----------------------------------------------------------------------------------------------
+/** Evaluate whether the entire box is in the same bin. This is only checked
+ * if the box holds enough events for it to make sense.
+ *
+ * @param box :: pointer to the MDBox
+ * @param chunkMin :: the minimum index in each dimension to consider "valid"
+ *(inclusive)
+ * @param chunkMax :: the maximum index in each dimension to consider "valid"
+ *(exclusive)
+ * @param linearIndex :: set to the index of the bin holding the box
+ * @return true if all the vertexes of the box are within the same bin
+ */
+template <typename MDE, size_t nd>
+bool BinMD::getSingleBinIndex(MDBox<MDE, nd> *box,
+                              const size_t *const chunkMin,
+                              const size_t *const chunkMax,
+                              size_t &linearIndex) const {
+  // There is a check that the number of events is enough for it to make sense
+  // to do all this processing.
+  if (box->getNPoints() <= (1 << nd) * 2)
+    return false;
 
-      // Was the vertex completely outside the range?
-      if (badOne)
-        break;
-    } // (for each vertex)
+  // An array to hold the rotated/transformed coordinates
+  std::vector<coord_t> outCenter(m_outD);
+  size_t numVertexes = 0;
+  std::unique_ptr<coord_t[]> vertexes(box->getVertexesArray(numVertexes));
 
-    delete[] vertexes;
+  // All vertexes have to be within THE SAME BIN = have the same linear index.
+  for (size_t i = 0; i < numVertexes; i++) {
+    // Now transform to the output dimensions
+    m_transform->apply(vertexes.get() + i * nd, outCenter.data());
 
-    if (!badOne) {
-      // Yes, the entire box is within a single bin
-      //        std::cout << "Box at " << box->getExtentsStr() << " is within a
-      //        single bin.\n";
-      // Add the CACHED signal from the entire box
-      signals[lastLinearIndex] += box->getSignal();
-      errors[lastLinearIndex] += box->getErrorSquared();
-      // TODO: If DataObjects get a weight, this would need to get the summed
-      // weight.
-      numEvents[lastLinearIndex] += static_cast<signal_t>(box->getNPoints());
+    // To build up the linear index
+    size_t vertexIndex = 0;
+    /// Loop through the dimensions on which we bin
+    for (size_t bd = 0; bd < m_outD; bd++) {
+      // What is the bin index in that dimension
+      coord_t x = outCenter[bd];
+      size_t ix = size_t(x);
+      // Within range (for this chunk)?
+      if ((x >= 0) && (ix >= chunkMin[bd]) && (ix < chunkMax[bd]))
+        // Build up the linear index
+        vertexIndex += indexMultiplier[bd] * ix;
+      else
+        // The vertex is outside the range
+        return false;
+    } // (for each dim in MDHisto)
 
-      // And don't bother looking at each event. This may save lots of time
-      // loading from disk.
-      delete[] outCenter;
-      return;
-    }
-  }
+    // Is the vertex at the same place as the last one?
+    if ((i > 0) && (vertexIndex != linearIndex))
+      return false;
+    linearIndex = vertexIndex;
+  } // (for each vertex)
+  return numVertexes > 0;
+}
 
-  // If you get here, you could not determine that the entire box was in the
-  // same bin.
-  // So you need to iterate through events.
-  const std::vector<MDE> &events = box->getConstEvents();
+//----------------------------------------------------------------------------------------------
+/** Add events to the bins of the output workspace they fall in
+ *
+ * @param events :: the events to bin
+ * @param chunkMin :: the minimum index in each dimension to consider "valid"
+ *(inclusive)
+ * @param chunkMax :: the maximum index in each dimension to consider "valid"
+ *(exclusive)
+ * @param signalArray :: signal of each bin
+ * @param errorArray :: squared error of each bin
+ * @param numEventsArray :: number of events in each bin
+ */
+template <typename MDE, size_t nd>
+void BinMD::binEvents(const std::vector<MDE> &events,
+                      const size_t *const chunkMin,
+                      const size_t *const chunkMax, signal_t *signalArray,
+                      signal_t *errorArray, signal_t *numEventsArray) const {
+  // An array to hold the rotated/transformed coordinates
+  std::vector<coord_t> outCenter(m_outD);
   for (auto it = events.begin(); it != events.end(); ++it) {
     // Cache the center of the event (again for speed)
     const coord_t *inCenter = it->getCenter();
 
     // Now transform to the output dimensions
-    m_transform->apply(inCenter, outCenter);
+    m_transform->apply(inCenter, outCenter.data());
 
     // To build up the linear index
     size_t linearIndex = 0;
@@ -208,17 +239,13 @@ inline void BinMD::binMDBox(MDBox<MDE, nd> *box, const size_t *const chunkMin,
 
     if (!badOne) {
       // Sum the signals as doubles to preserve precision
-      signals[linearIndex] += static_cast<signal_t>(it->getSignal());
-      errors[linearIndex] += static_cast<signal_t>(it->getErrorSquared());
+      signalArray[linearIndex] += static_cast<signal_t>(it->getSignal());
+      errorArray[linearIndex] += static_cast<signal_t>(it->getErrorSquared());
       // TODO: If DataObjects get a weight, this would need to get the summed
       // weight.
-      numEvents[linearIndex] += 1.0;
+      numEventsArray[linearIndex] += 1.0;
     }
   }
-  // Done with the events list
-  box->releaseEvents();
-
-  delete[] outCenter;
 }
 
 //----------------------------------------------------------------------------------------------
@@ -267,9 +294,14 @@ void BinMD::binByIterating(typename MDEventWorkspace<MDE, nd>::sptr ws) {
 
   // Do we actually do it in parallel?
   bool doParallel = getProperty("Parallel");
-  // Not if file-backed!
-  if (bc->isFileBacked())
+  if (bc->isFileBacked()) {
+    // Not by chunks if file-backed: boxes would be read in random order
+    if (doParallel) {
+      this->binFileBackedInParallel<MDE, nd>(ws);
+      return;
+    }
     doParallel = false;
+  }
   if (!doParallel)
     chunkNumBins = int(m_binDimensions[chunkDimension]->getNBins());
 
@@ -347,18 +379,180 @@ void BinMD::binByIterating(typename MDEventWorkspace<MDE, nd>::sptr ws) {
     } // for each chunk in parallel
     PARALLEL_CHECK_INTERUPT_REGION
 
-    // Now the implicit function
-    if (implicitFunction) {
-      if (prog)
-        prog->report("Applying implicit function.");
-      signal_t nan = std::numeric_limits<signal_t>::quiet_NaN();
-      outWS->applyImplicitFunction(implicitFunction, nan, nan);
-    }
-
     // return the size of the input workspace write buffer to its initial value
     // bc->setCacheParameters(sizeof(MDE),writeBufSize);
 }
 
+//----------------------------------------------------------------------------------------------
+/** Bin a file-backed workspace on several threads.
+ *
+ * The boxes whose events are only on disk are sorted by file position and
+ * grouped into batches of contiguous boxes, each read with a single call to
+ * the file IO. Reading a batch and binning its events are separate tasks;
+ * binning has priority, so batches are read only as fast as they are binned.
+ * Each binning task adds to a partial copy of the output arrays that no other
+ * task uses at the same time, and the copies are summed at the end. Boxes in
+ * memory are binned before the threads start, so the disk buffer is only
+ * used from this thread.
+ *
+ * @param ws :: MDEventWorkspace of the given type.
+ */
+template <typename MDE, size_t nd>
+void BinMD::binFileBackedInParallel(
+    typename MDEventWorkspace<MDE, nd>::sptr ws) {
+  BoxController_sptr bc = ws->getBoxController();
+  API::IBoxControllerIO *fileIO = bc->getFileIO();
+
+  // The whole output workspace is a single chunk
+  std::vector<size_t> chunkMin(m_outD, 0);
+  std::vector<size_t> chunkMax(m_outD);
+  for (size_t bd = 0; bd < m_outD; bd++)
+    chunkMax[bd] = m_binDimensions[bd]->getNBins();
+  std::unique_ptr<MDImplicitFunction> function(
+      this->getImplicitFunctionForChunk(chunkMin.data(), chunkMax.data()));
+  std::vector<API::IMDNode *> boxes;
+  ws->getBox()->getBoxes(boxes, 1000, true, function.get());
+
+  // Boxes in a single bin only need their cached signal. Of the others, only
+  // those whose events are all on disk can be read directly from the file.
+  std::vector<MDBox<MDE, nd> *> onDisk;
+  std::vector<MDBox<MDE, nd> *> inMemory;
+  for (auto node : boxes) {
+    auto box = dynamic_cast<MDBox<MDE, nd> *>(node);
+    if (!box || box->getIsMasked())
+      continue;
+    size_t linearIndex = 0;
+    if (this->getSingleBinIndex(box, chunkMin.data(), chunkMax.data(),
+                                linearIndex)) {
+      signals[linearIndex] += box->getSignal();
+      errors[linearIndex] += box->getErrorSquared();
+      numEvents[linearIndex] += static_cast<signal_t>(box->getNPoints());
+      continue;
+    }
+    const Kernel::ISaveable *saveable = box->getISaveable();
+    if (saveable && saveable->wasSaved() && !saveable->isLoaded() &&
+        box->getDataInMemorySize() == 0)
+      onDisk.push_back(box);
+    else
+      inMemory.push_back(box);
+  }
+  std::sort(onDisk.begin(), onDisk.end(),
+            [](MDBox<MDE, nd> *lhs, MDBox<MDE, nd> *rhs) {
+              return lhs->getISaveable()->getFilePosition() <
+                     rhs->getISaveable()->getFilePosition();
+            });
+
+  // Group contiguous boxes into batches of (file position, number of events)
+  std::vector<std::pair<uint64_t, uint64_t>> batches;
+  for (auto box : onDisk) {
+    const uint64_t position = box->getISaveable()->getFilePosition();
+    const uint64_t size = box->getISaveable()->getFileSize();
+    if (!batches.empty() &&
+        batches.back().first + batches.back().second == position &&
+        batches.back().second + size <= FILE_BACKED_BATCH_EVENTS)
+      batches.back().second += size;
+    else
+      batches.emplace_back(position, size);
+  }
+  g_log.debug() << "Reading " << onDisk.size() << " boxes from file in "
+                << batches.size() << " batches; binning " << inMemory.size()
+                << " boxes from memory.\n";
+  if (prog)
+    prog->resetNumSteps(static_cast<int64_t>(inMemory.size() + batches.size()),
+                        0.0, 1.0);
+
+  for (auto box : inMemory) {
+    this->binEvents<MDE, nd>(box->getConstEvents(), chunkMin.data(),
+                             chunkMax.data(), signals, errors, numEvents);
+    box->releaseEvents();
+    if (prog)
+      prog->report();
+    interruption_point();
+  }
+  if (batches.empty())
+    return;
+
+  // One set of partial sums per thread, as far as memory allows. The first
+  // set is the output workspace itself.
+  const size_t numBins = outWS->getNPoints();
+  const size_t bytesPerSet = 3 * numBins * sizeof(signal_t);
+  const size_t batchBytes =
+      FILE_BACKED_BATCH_EVENTS * (sizeof(MDE) + (nd + 4) * sizeof(coord_t));
+  const size_t numThreads = ThreadPool::getNumPhysicalCores();
+  const size_t availableBytes = MemoryStats().availMem() * 1024 / 2;
+  size_t numSets = 1;
+  while (numSets < numThreads &&
+         (numSets + 1) * (bytesPerSet + batchBytes) <= availableBytes)
+    ++numSets;
+  std::vector<std::vector<signal_t>> partialSums(numSets - 1);
+  std::vector<signal_t *> setSignals{signals};
+  std::vector<signal_t *> setErrors{errors};
+  std::vector<signal_t *> setNumEvents{numEvents};
+  for (auto &sums : partialSums) {
+    sums.assign(3 * numBins, 0.0);
+    setSignals.push_back(sums.data());
+    setErrors.push_back(sums.data() + numBins);
+    setNumEvents.push_back(sums.data() + 2 * numBins);
+  }
+  // Sets not in use by a binning task; there is one per thread
+  std::vector<size_t> freeSets(numSets);
+  std::iota(freeSets.begin(), freeSets.end(), size_t{0});
+  std::mutex freeSetsMutex;
+
+  // Binning tasks cost more than any reading task so they run first. Reading
+  // tasks have decreasing costs to start in file order.
+  auto scheduler = new ThreadSchedulerLargestCost();
+  ThreadPool pool(scheduler, numSets);
+  const double binningCost = static_cast<double>(batches.size() + 1);
+  for (size_t i = 0; i < batches.size(); ++i) {
+    const auto batch = batches[i];
+    auto binBatch = [&, batch]() {
+      if (m_cancel)
+        return;
+      auto events = boost::make_shared<std::vector<MDE>>();
+      {
+        std::vector<coord_t> table;
+        fileIO->loadBlock(table, batch.first, batch.second);
+        MDE::dataToEvents(table, *events);
+      }
+      scheduler->push(new FunctionTask(
+          [&, events]() {
+            if (m_cancel)
+              return;
+            size_t set;
+            {
+              std::lock_guard<std::mutex> lock(freeSetsMutex);
+              set = freeSets.back();
+              freeSets.pop_back();
+            }
+            this->binEvents<MDE, nd>(*events, chunkMin.data(),
+                                     chunkMax.data(), setSignals[set],
+                                     setErrors[set], setNumEvents[set]);
+            {
+              std::lock_guard<std::mutex> lock(freeSetsMutex);
+              freeSets.push_back(set);
+            }
+            if (prog)
+              prog->report();
+          },
+          binningCost));
+    };
+    pool.schedule(new FunctionTask(binBatch, binningCost - 1.0 - double(i)));
+  }
+  pool.joinAll();
+  interruption_point();
+
+  // Sum the partial results into the output workspace
+  for (size_t set = 1; set < numSets; ++set) {
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int64_t i = 0; i < static_cast<int64_t>(numBins); ++i) {
+      signals[i] += setSignals[set][i];
+      errors[i] += setErrors[set][i];
+      numEvents[i] += setNumEvents[set][i];
+    }
+  }
+}
+
 //----------------------------------------------------------------------------------------------
 /** Execute the algorithm.
  */
@@ -429,6 +623,14 @@ void BinMD::exec() {
 
   CALL_MDEVENT_FUNCTION(this->binByIterating, m_inWS);
 
+  // Now the implicit function
+  if (implicitFunction) {
+    if (prog)
+      prog->report("Applying implicit function.");
+    signal_t nan = std::numeric_limits<signal_t>::quiet_NaN();
+    outWS->applyImplicitFunction(implicitFunction, nan, nan);
+  }
+
   // Copy the coordinate system & experiment infos to the output
   IMDEventWorkspace_sptr inEWS =
       boost::dynamic_pointer_cast<IMDEventWorkspace>(m_inWS);
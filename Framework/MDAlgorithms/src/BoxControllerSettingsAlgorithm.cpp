@@ -55,10 +55,17 @@ void BoxControllerSettingsAlgorithm::initBoxControllerProps(
                   "Default " +
                       Strings::toString(MaxRecursionDepth) + ".");
 
+  declareProperty("SpaceFillingCurveOrder", false,
+                  "Keep the events of each box sorted along a space-filling "
+                  "curve, and save the boxes of a file-backed workspace in "
+                  "the curve order, so that events close in space are close "
+                  "in memory and on disk.");
+
   std::string grp = getBoxSettingsGroupName();
   setPropertyGroup("SplitInto", grp);
   setPropertyGroup("SplitThreshold", grp);
   setPropertyGroup("MaxRecursionDepth", grp);
+  setPropertyGroup("SpaceFillingCurveOrder", grp);
 }
 
 /**
@@ -133,6 +140,8 @@ void BoxControllerSettingsAlgorithm::setBoxController(BoxController_sptr bc) {
   bc->setSplitThreshold(val);
   val = this->getProperty("MaxRecursionDepth");
   bc->setMaxDepth(val);
+  bool curveOrder = this->getProperty("SpaceFillingCurveOrder");
+  bc->setUseSpaceFillingCurve(curveOrder);
 
   // Build MDGridBox
   std::vector<int> splits = getProperty("SplitInto");
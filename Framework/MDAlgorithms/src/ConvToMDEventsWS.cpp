@@ -1,13 +1,27 @@
 #include "MantidMDAlgorithms/ConvToMDEventsWS.h"
 
+#include "MantidKernel/FunctionTask.h"
+#include "MantidKernel/ThreadSchedulerWorkStealing.h"
 #include "MantidMDAlgorithms/UnitsConversionHelper.h"
 
+#include <boost/bind.hpp>
+
+#include <algorithm>
+#include <memory>
+
 namespace Mantid {
 namespace MDAlgorithms {
-/**function converts particular list of events of type T into MD workspace and
- * adds these events to the workspace itself  */
+/**function converts particular list of events of type T into MD workspace
+ * coordinates and appends these events to the buffer
+ * @param workspaceIndex -- the index of the spectrum to convert
+ * @param qConverter     -- the transformation to use; it keeps the state of
+ *                          the spectrum being converted
+ * @param buffer         -- the buffer to append the MD events to
+ * @return the number of events appended */
 template <class T>
-size_t ConvToMDEventsWS::convertEventList(size_t workspaceIndex) {
+size_t ConvToMDEventsWS::convertEventList(size_t workspaceIndex,
+                                          MDTransfInterface &qConverter,
+                                          EventBuffer &buffer) {
 
   const Mantid::DataObjects::EventList &el =
       m_EventWS->getSpectrum(workspaceIndex);
@@ -24,21 +38,9 @@ size_t ConvToMDEventsWS::convertEventList(size_t workspaceIndex) {
   std::vector<coord_t> locCoord(m_Coord);
   // set up unit conversion and calculate up all coordinates, which depend on
   // spectra index only
-  if (!m_QConverter->calcYDepCoordinates(locCoord, workspaceIndex))
+  if (!qConverter.calcYDepCoordinates(locCoord, workspaceIndex))
     return 0; // skip if any y outsize of the range of interest;
   localUnitConv.updateConversion(workspaceIndex);
-  //
-  // allocate temporary buffers for MD Events data
-  // MD events coordinates buffer
-  std::vector<coord_t> allCoord;
-  std::vector<float> sig_err;      // array for signal and error.
-  std::vector<uint16_t> run_index; // Buffer for run index for each event
-  std::vector<uint32_t> det_ids;   // Buffer of det Id-s for each event
-
-  allCoord.reserve(this->m_NDims * numEvents);
-  sig_err.reserve(2 * numEvents);
-  run_index.reserve(numEvents);
-  det_ids.reserve(numEvents);
 
   // This little dance makes the getting vector of events more general (since
   // you can't overload by return type).
@@ -46,47 +48,93 @@ size_t ConvToMDEventsWS::convertEventList(size_t workspaceIndex) {
   getEventsFrom(el, events_ptr);
   const typename std::vector<T> &events = *events_ptr;
 
+  const size_t nStart = buffer.size();
   // Iterators to start/end
   for (auto it = events.cbegin(); it != events.cend(); it++) {
     double val = localUnitConv.convertUnits(it->tof());
     double signal = it->weight();
     double errorSq = it->errorSquared();
-    if (!m_QConverter->calcMatrixCoord(val, locCoord, signal, errorSq))
+    if (!qConverter.calcMatrixCoord(val, locCoord, signal, errorSq))
       continue; // skip ND outside the range
 
-    sig_err.push_back(static_cast<float>(signal));
-    sig_err.push_back(static_cast<float>(errorSq));
-    run_index.push_back(runIndexLoc);
-    det_ids.push_back(detID);
-    allCoord.insert(allCoord.end(), locCoord.begin(), locCoord.end());
+    buffer.sigErr.push_back(static_cast<float>(signal));
+    buffer.sigErr.push_back(static_cast<float>(errorSq));
+    buffer.runIndex.push_back(runIndexLoc);
+    buffer.detIds.push_back(detID);
+    buffer.coord.insert(buffer.coord.end(), locCoord.begin(), locCoord.end());
   }
-
-  // Add them to the MDEW
-  size_t n_added_events = run_index.size();
-  m_OutWSWrapper->addMDData(sig_err, run_index, det_ids, allCoord,
-                            n_added_events);
-  return n_added_events;
+  return buffer.size() - nStart;
 }
 
-/** The method runs conversion for a single event list, corresponding to a
- * particular workspace index */
-size_t ConvToMDEventsWS::conversionChunk(size_t workspaceIndex) {
+/** The method converts the events of a single spectrum into MD events
+ * @param workspaceIndex -- the index of the spectrum to convert
+ * @param qConverter     -- the transformation to use
+ * @param buffer         -- the buffer to append the MD events to
+ * @return the number of events appended */
+size_t ConvToMDEventsWS::convertSpectrum(size_t workspaceIndex,
+                                         MDTransfInterface &qConverter,
+                                         EventBuffer &buffer) {
 
   switch (m_EventWS->getSpectrum(workspaceIndex).getEventType()) {
   case Mantid::API::TOF:
     return this->convertEventList<Mantid::Types::Event::TofEvent>(
-        workspaceIndex);
+        workspaceIndex, qConverter, buffer);
   case Mantid::API::WEIGHTED:
     return this->convertEventList<Mantid::DataObjects::WeightedEvent>(
-        workspaceIndex);
+        workspaceIndex, qConverter, buffer);
   case Mantid::API::WEIGHTED_NOTIME:
     return this->convertEventList<Mantid::DataObjects::WeightedEventNoTime>(
-        workspaceIndex);
+        workspaceIndex, qConverter, buffer);
   default:
     throw std::runtime_error("EventList had an unexpected data type!");
   }
 }
 
+/** The method runs conversion for a single event list, corresponding to a
+ * particular workspace index, and adds the events to the workspace */
+size_t ConvToMDEventsWS::conversionChunk(size_t workspaceIndex) {
+  EventBuffer buffer;
+  size_t n_added_events =
+      this->convertSpectrum(workspaceIndex, *m_QConverter, buffer);
+  // Add them to the MDEW
+  m_OutWSWrapper->addMDData(buffer.sigErr, buffer.runIndex, buffer.detIds,
+                            buffer.coord, n_added_events);
+  return n_added_events;
+}
+
+/** Add the buffered events to the workspace, splitting boxes as they fill up,
+ * and empty the buffer. Several tasks may add their events at once. */
+void ConvToMDEventsWS::addAndSplit(EventBuffer &buffer) {
+  m_OutWSWrapper->addAndSplitMDData(buffer.sigErr, buffer.runIndex,
+                                    buffer.detIds, buffer.coord,
+                                    buffer.size());
+  buffer.clear();
+}
+
+/** The method converts a range of spectra in one task. The events are
+ * gathered in a buffer of the task and added to the workspace in blocks, so
+ * that many tasks can add events and split boxes at the same time.
+ * @param firstIndex -- the first workspace index to convert
+ * @param lastIndex  -- one past the last workspace index to convert */
+void ConvToMDEventsWS::convertSpectraAndSplit(size_t firstIndex,
+                                              size_t lastIndex) {
+  // the transformation keeps the state of the spectrum it converts, so every
+  // task needs its own copy
+  std::unique_ptr<MDTransfInterface> qConverter(m_QConverter->clone());
+  EventBuffer buffer;
+  buffer.coord.reserve(EVENTS_PER_ADD * m_NDims);
+  buffer.sigErr.reserve(2 * EVENTS_PER_ADD);
+  buffer.runIndex.reserve(EVENTS_PER_ADD);
+  buffer.detIds.reserve(EVENTS_PER_ADD);
+
+  for (size_t wi = firstIndex; wi < lastIndex; ++wi) {
+    this->convertSpectrum(wi, *qConverter, buffer);
+    if (buffer.size() >= EVENTS_PER_ADD)
+      addAndSplit(buffer);
+  }
+  addAndSplit(buffer);
+}
+
 /** method sets up all internal variables necessary to convert from Event
 Workspace to MDEvent workspace
 @param WSD         -- the class describing the target MD workspace, sorurce
@@ -125,21 +173,32 @@ void ConvToMDEventsWS::runConversion(API::Progress *pProgress) {
   size_t nValidSpectra = m_NSpectra;
 
   //--->>> Thread control stuff
-  Kernel::ThreadSchedulerFIFO *ts(nullptr);
+  Kernel::ThreadSchedulerWorkStealing *ts(nullptr);
 
   int nThreads(m_NumThreads);
   if (nThreads < 0)
     nThreads = 0; // negative m_NumThreads correspond to all cores used, 0 no
                   // threads and positive number -- nThreads requested;
   bool runMultithreaded = false;
+  // The boxes of a file-backed workspace are saved and cleared by the disk
+  // buffer without taking the locks used to add events concurrently, so the
+  // events are added to them from one thread and only split in parallel.
+  const bool addInParallel = !bc->isFileBacked();
+  size_t nTasks(0);
   if (m_NumThreads != 0) {
     runMultithreaded = true;
     // Create the thread pool that will run all of these. It will be deleted by
     // the threadpool
-    ts = new Kernel::ThreadSchedulerFIFO();
+    ts = new Kernel::ThreadSchedulerWorkStealing(nThreads);
+    // Split the spectra between several tasks per core, each converting a
+    // contiguous block of spectra
+    const size_t nCores = nThreads > 0
+                              ? size_t(nThreads)
+                              : Kernel::ThreadPool::getNumPhysicalCores();
+    nTasks = std::min(size_t(nValidSpectra), TASKS_PER_CORE * nCores);
     // it will initiate thread pool with number threads or machine's cores (0 in
     // tp constructor)
-    pProgress->resetNumSteps(nValidSpectra, 0, 1);
+    pProgress->resetNumSteps(addInParallel ? nTasks : nValidSpectra, 0, 1);
   }
   Kernel::ThreadPool tp(ts, nThreads, new API::Progress(*pProgress));
   //<<<--  Thread control stuff
@@ -149,39 +208,53 @@ void ConvToMDEventsWS::runConversion(API::Progress *pProgress) {
   if (!m_QConverter->calcGenericVariables(m_Coord, m_NDims))
     return;
 
-  size_t eventsAdded = 0;
-  for (size_t wi = 0; wi < nValidSpectra; wi++) {
-
-    size_t nConverted = this->conversionChunk(wi);
-    eventsAdded += nConverted;
-    nEventsInWS += nConverted;
-    // Keep a running total of how many events we've added
-    if (bc->shouldSplitBoxes(nEventsInWS, eventsAdded, lastNumBoxes)) {
-      if (runMultithreaded) {
-        // Now do all the splitting tasks
-        m_OutWSWrapper->pWorkspace()->splitAllIfNeeded(ts);
-        if (ts->size() > 0)
-          tp.joinAll();
-      } else {
-        m_OutWSWrapper->pWorkspace()->splitAllIfNeeded(
-            nullptr); // it is done this way as it is possible trying to do
-                      // single
-                      // threaded split more efficiently
-      }
-      // Count the new # of boxes.
-      lastNumBoxes = m_OutWSWrapper->pWorkspace()
-                         ->getBoxController()
-                         ->getTotalNumMDBoxes();
-      eventsAdded = 0;
-      pProgress->report(wi);
+  if (runMultithreaded && addInParallel) {
+    // Every task adds the events it converted and splits the boxes which fill
+    // up, so the events stream into the box structure in a single pass.
+    for (size_t task = 0; task < nTasks; ++task) {
+      const size_t first = task * nValidSpectra / nTasks;
+      const size_t last = (task + 1) * nValidSpectra / nTasks;
+      ts->push(new Kernel::FunctionTask(boost::bind(
+          &ConvToMDEventsWS::convertSpectraAndSplit, this, first, last)));
     }
-  }
-  // Do a final splitting of everything
-  if (runMultithreaded) {
+    tp.joinAll();
+    // Split what the tasks left behind, e.g. if the top box is not a grid box
     m_OutWSWrapper->pWorkspace()->splitAllIfNeeded(ts);
     tp.joinAll();
   } else {
-    m_OutWSWrapper->pWorkspace()->splitAllIfNeeded(nullptr);
+    size_t eventsAdded = 0;
+    for (size_t wi = 0; wi < nValidSpectra; wi++) {
+
+      size_t nConverted = this->conversionChunk(wi);
+      eventsAdded += nConverted;
+      nEventsInWS += nConverted;
+      // Keep a running total of how many events we've added
+      if (bc->shouldSplitBoxes(nEventsInWS, eventsAdded, lastNumBoxes)) {
+        if (runMultithreaded) {
+          // Now do all the splitting tasks
+          m_OutWSWrapper->pWorkspace()->splitAllIfNeeded(ts);
+          if (ts->size() > 0)
+            tp.joinAll();
+        } else {
+          // it is done this way as it is possible trying to do single
+          // threaded split more efficiently
+          m_OutWSWrapper->pWorkspace()->splitAllIfNeeded(nullptr);
+        }
+        // Count the new # of boxes.
+        lastNumBoxes = m_OutWSWrapper->pWorkspace()
+                           ->getBoxController()
+                           ->getTotalNumMDBoxes();
+        eventsAdded = 0;
+        pProgress->report(wi);
+      }
+    }
+    // Do a final splitting of everything
+    if (runMultithreaded) {
+      m_OutWSWrapper->pWorkspace()->splitAllIfNeeded(ts);
+      tp.joinAll();
+    } else {
+      m_OutWSWrapper->pWorkspace()->splitAllIfNeeded(nullptr);
+    }
   }
 
   // Recount totals at the end.
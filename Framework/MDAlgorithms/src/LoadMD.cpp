@@ -5,6 +5,7 @@
 #include "MantidAPI/IMDWorkspace.h"
 #include "MantidAPI/RegisterFileLoader.h"
 #include "MantidAPI/WorkspaceHistory.h"
+#include "MantidDataObjects/BoxControllerMappedIO.h"
 #include "MantidDataObjects/BoxControllerNeXusIO.h"
 #include "MantidDataObjects/CoordTransformAffine.h"
 #include "MantidDataObjects/MDBoxFlatTree.h"
@@ -38,6 +39,21 @@ using namespace Mantid::API;
 using namespace Mantid::Geometry;
 using namespace Mantid::DataObjects;
 
+namespace {
+/** Create the IO for the events saved with a workspace, which are either in
+ * the NeXus file or in an event file next to it.
+ * @param bc :: the box controller of the workspace
+ * @param filename :: the full name of the NeXus file
+ * @return the IO; ownership is passed to the caller
+ */
+IBoxControllerIO *createEventIO(BoxController *bc,
+                                const std::string &filename) {
+  if (BoxControllerMappedIO::hasEventFile(filename))
+    return new BoxControllerMappedIO(bc);
+  return new BoxControllerNeXusIO(bc);
+}
+} // namespace
+
 namespace Mantid {
 namespace MDAlgorithms {
 
@@ -541,9 +557,9 @@ void LoadMD::doLoad(typename MDEventWorkspace<MDE, nd>::sptr ws) {
 
   // ---------------------------------------- DEAL WITH BOXES
   // ------------------------------------
-  if (fileBackEnd) { // TODO:: call to the file format factory
+  if (fileBackEnd) {
     auto loader = boost::shared_ptr<API::IBoxControllerIO>(
-        new DataObjects::BoxControllerNeXusIO(bc.get()));
+        createEventIO(bc.get(), m_filename));
     loader->setDataType(sizeof(coord_t), MDE::getTypeName());
     bc->setFileBacked(loader, m_filename);
     // boxes have been already made file-backed when restoring the boxTree;
@@ -572,9 +588,7 @@ void LoadMD::doLoad(typename MDEventWorkspace<MDE, nd>::sptr ws) {
   else if (!m_BoxStructureAndMethadata) {
     // ---------------------------------------- READ IN THE BOXES
     // ------------------------------------
-    // TODO:: call to the file format factory
-    auto loader =
-        file_holder_type(new DataObjects::BoxControllerNeXusIO(bc.get()));
+    auto loader = file_holder_type(createEventIO(bc.get(), m_filename));
     loader->setDataType(sizeof(coord_t), MDE::getTypeName());
 
     loader->openFile(m_filename, "r");
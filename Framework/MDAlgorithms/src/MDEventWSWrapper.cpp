@@ -111,6 +111,57 @@ void MDEventWSWrapper::addMDDataND(float *sigErr, uint16_t *runIndex,
   }
 }
 
+/** Add the events to the workspace, splitting boxes as they fill up.
+ * Thread-safe: several threads may add events at once.
+ * The parameters are the same as for addMDDataND
+ */
+template <size_t nd>
+void MDEventWSWrapper::addAndSplitMDDataND(float *sigErr, uint16_t *runIndex,
+                                           uint32_t *detId, coord_t *Coord,
+                                           size_t dataSize) const {
+
+  DataObjects::MDEventWorkspace<DataObjects::MDEvent<nd>, nd> *const pWs =
+      dynamic_cast<
+          DataObjects::MDEventWorkspace<DataObjects::MDEvent<nd>, nd> *>(
+          m_Workspace.get());
+  if (pWs) {
+    std::vector<DataObjects::MDEvent<nd>> events;
+    events.reserve(dataSize);
+    for (size_t i = 0; i < dataSize; i++) {
+      events.emplace_back(*(sigErr + 2 * i), *(sigErr + 2 * i + 1),
+                          *(runIndex + i), *(detId + i), (Coord + i * nd));
+    }
+    pWs->addEventsAndSplit(events);
+  } else {
+    DataObjects::MDEventWorkspace<DataObjects::MDLeanEvent<nd>, nd> *const
+        pLWs = dynamic_cast<
+            DataObjects::MDEventWorkspace<DataObjects::MDLeanEvent<nd>, nd> *>(
+            m_Workspace.get());
+
+    if (!pLWs)
+      throw std::runtime_error("Bad Cast: Target MD workspace to add events "
+                               "does not correspond to type of events you try "
+                               "to add to it");
+
+    std::vector<DataObjects::MDLeanEvent<nd>> events;
+    events.reserve(dataSize);
+    for (size_t i = 0; i < dataSize; i++) {
+      events.emplace_back(*(sigErr + 2 * i), *(sigErr + 2 * i + 1),
+                          (Coord + i * nd));
+    }
+    pLWs->addEventsAndSplit(events);
+  }
+}
+
+/// the function used in template metaloop termination on 0 dimensions and to
+/// throw the error in attempt to add data to 0-dimension workspace
+template <>
+void MDEventWSWrapper::addAndSplitMDDataND<0>(float *, uint16_t *, uint32_t *,
+                                              coord_t *, size_t) const {
+  throw(std::invalid_argument(" class has not been initiated, can not add data "
+                              "to 0-dimensional workspace"));
+}
+
 /// the function used in template metaloop termination on 0 dimensions and to
 /// throw the error in attempt to add data to 0-dimension workspace
 template <>
@@ -226,6 +277,23 @@ void MDEventWSWrapper::addMDData(std::vector<float> &sigErr,
                                              &detId[0], &Coord[0], dataSize);
 }
 
+/** method adds the data to the workspace which was initiated before and
+ * splits the boxes which fill up. Unlike addMDData, several threads may call it
+ * at once. The parameters are the same as for addMDData.
+ */
+void MDEventWSWrapper::addAndSplitMDData(std::vector<float> &sigErr,
+                                         std::vector<uint16_t> &runIndex,
+                                         std::vector<uint32_t> &detId,
+                                         std::vector<coord_t> &Coord,
+                                         size_t dataSize) const {
+
+  if (dataSize == 0)
+    return;
+  // perform the actual dimension-dependent addition
+  (this->*(mdEvAddAndSplit[m_NDimensions]))(&sigErr[0], &runIndex[0],
+                                            &detId[0], &Coord[0], dataSize);
+}
+
 /** method should be called at the end of the algorithm, to let the workspace
 manager know that it has whole responsibility for the workspace
 (As the algorithm is static, it will hold the pointer to the workspace
@@ -247,6 +315,7 @@ public:
     LOOP<i - 1>::EXEC(pH);
     pH->wsCreator[i] = &MDEventWSWrapper::createEmptyEventWS<i>;
     pH->mdEvAddAndForget[i] = &MDEventWSWrapper::addMDDataND<i>;
+    pH->mdEvAddAndSplit[i] = &MDEventWSWrapper::addAndSplitMDDataND<i>;
     pH->mdCalCentroid[i] = &MDEventWSWrapper::calcCentroidND<i>;
     pH->mdBoxListSplitter[i] = &MDEventWSWrapper::splitBoxList<i>;
   }
@@ -258,6 +327,7 @@ public:
   static inline void EXEC(MDEventWSWrapper *pH) {
     pH->wsCreator[0] = &MDEventWSWrapper::createEmptyEventWS<0>;
     pH->mdEvAddAndForget[0] = &MDEventWSWrapper::addMDDataND<0>;
+    pH->mdEvAddAndSplit[0] = &MDEventWSWrapper::addAndSplitMDDataND<0>;
     pH->mdCalCentroid[0] = &MDEventWSWrapper::calcCentroidND<0>;
     pH->mdBoxListSplitter[0] = &MDEventWSWrapper::splitBoxList<0>;
   }
@@ -268,6 +338,7 @@ MDEventWSWrapper::MDEventWSWrapper()
     : m_NDimensions(0), m_needSplitting(false) {
   wsCreator.resize(MAX_N_DIM + 1);
   mdEvAddAndForget.resize(MAX_N_DIM + 1);
+  mdEvAddAndSplit.resize(MAX_N_DIM + 1);
   mdCalCentroid.resize(MAX_N_DIM + 1);
   mdBoxListSplitter.resize(MAX_N_DIM + 1);
   LOOP<MAX_N_DIM>::EXEC(this);
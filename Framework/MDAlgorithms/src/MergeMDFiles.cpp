@@ -1,6 +1,7 @@
 #include "MantidMDAlgorithms/MergeMDFiles.h"
 #include "MantidAPI/FileProperty.h"
 #include "MantidAPI/MultipleFileProperty.h"
+#include "MantidDataObjects/BoxControllerMappedIO.h"
 #include "MantidDataObjects/BoxControllerNeXusIO.h"
 #include "MantidDataObjects/MDBoxBase.h"
 #include "MantidDataObjects/MDEventFactory.h"
@@ -19,6 +20,12 @@ using namespace Mantid::DataObjects;
 namespace Mantid {
 namespace MDAlgorithms {
 
+namespace {
+/// Number of boxes ahead of the one being merged whose events are read in
+/// the background
+const size_t READ_AHEAD_BOXES = 64;
+} // namespace
+
 // Register the algorithm into the AlgorithmFactory
 DECLARE_ALGORITHM(MergeMDFiles)
 
@@ -114,7 +121,10 @@ void MergeMDFiles::loadBoxData() {
           new API::BoxController(static_cast<size_t>(m_nDims)));
       bc->fromXMLString(m_fileComponentsStructure[i].getBCXMLdescr());
 
-      m_EventLoader[i] = new BoxControllerNeXusIO(bc.get());
+      if (BoxControllerMappedIO::hasEventFile(m_Filenames[i]))
+        m_EventLoader[i] = new BoxControllerMappedIO(bc.get());
+      else
+        m_EventLoader[i] = new BoxControllerNeXusIO(bc.get());
       m_EventLoader[i]->setDataType(sizeof(coord_t), m_MDEventType);
       m_EventLoader[i]->openFile(m_Filenames[i], "r");
     }
@@ -182,6 +192,21 @@ uint64_t MergeMDFiles::loadEventsFromSubBoxes(API::IMDNode *TargetBox) {
   return nBoxEvents;
 }
 
+/** Ask for the events of all files that are merged into a particular box to
+ * be read in the background, as the box will be merged soon.
+ */
+void MergeMDFiles::readAheadSubBoxes(API::IMDNode *TargetBox) {
+  if (!TargetBox->isBox())
+    return;
+  const size_t ID = TargetBox->getID();
+  for (size_t iw = 0; iw < this->m_EventLoader.size(); iw++) {
+    const auto &eventIndex = m_fileComponentsStructure[iw].getEventIndex();
+    const auto numFileEvents = static_cast<size_t>(eventIndex[2 * ID + 1]);
+    if (numFileEvents > 0)
+      m_EventLoader[iw]->readAhead(eventIndex[2 * ID + 0], numFileEvents);
+  }
+}
+
 //----------------------------------------------------------------------------------------------
 /** Perform the merging, but clone the initial workspace and use the same
  *splitting
@@ -251,7 +276,16 @@ void MergeMDFiles::doExecByCloning(Mantid::API::IMDEventWorkspace_sptr ws,
   this->m_totalLoaded = 0;
   std::vector<API::IMDNode *> &boxes = m_BoxStruct.getBoxes();
 
+  // The boxes are merged in the order of their IDs. Their events need not be
+  // in that order in the input files, which may be laid out along a Morton
+  // curve, so the read-ahead only overlaps reading the next few boxes with
+  // merging the current one and is not always sequential on disk.
+  for (size_t ib = 0; ib < std::min(numBoxes, READ_AHEAD_BOXES); ib++)
+    this->readAheadSubBoxes(boxes[ib]);
+
   for (size_t ib = 0; ib < numBoxes; ib++) {
+    if (ib + READ_AHEAD_BOXES < numBoxes)
+      this->readAheadSubBoxes(boxes[ib + READ_AHEAD_BOXES]);
     auto box = boxes[ib];
     if (!box->isBox())
       continue;
@@ -4,6 +4,7 @@
 #include "MantidAPI/IMDEventWorkspace.h"
 #include "MantidAPI/Progress.h"
 #include "MantidAPI/WorkspaceHistory.h"
+#include "MantidDataObjects/BoxControllerMappedIO.h"
 #include "MantidDataObjects/BoxControllerNeXusIO.h"
 #include "MantidDataObjects/MDBox.h"
 #include "MantidDataObjects/MDBoxFlatTree.h"
@@ -12,6 +13,7 @@
 #include "MantidDataObjects/MDEventWorkspace.h"
 #include "MantidDataObjects/MDHistoWorkspace.h"
 #include "MantidKernel/EnabledWhenProperty.h"
+#include "MantidKernel/ListValidator.h"
 #include "MantidKernel/Matrix.h"
 #include "MantidKernel/Strings.h"
 #include "MantidKernel/System.h"
@@ -76,6 +78,17 @@ void SaveMD::init() {
   setPropertySettings(
       "MakeFileBacked",
       make_unique<EnabledWhenProperty>("UpdateFileBackEnd", IS_EQUAL_TO, "0"));
+
+  std::vector<std::string> eventFormats{"NeXus", "MemoryMapped"};
+  declareProperty(
+      "EventDataFormat", "NeXus",
+      boost::make_shared<StringListValidator>(eventFormats),
+      "For an MDEventWorkspace that was created in memory: where to save the "
+      "events.\n"
+      "NeXus: in the NeXus file.\n"
+      "MemoryMapped: in a flat file named after the NeXus file with .events "
+      "appended, which is memory-mapped when the events are loaded.\n"
+      "File-backed workspaces keep the format of their file.");
 }
 
 //----------------------------------------------------------------------------------------------
@@ -114,6 +127,9 @@ void SaveMD::doSaveEvents(typename MDEventWorkspace<MDE, nd>::sptr ws) {
     Poco::File oldFile(filename);
     if (oldFile.exists())
       oldFile.remove();
+    Poco::File oldEventFile(BoxControllerMappedIO::eventFileName(filename));
+    if (oldEventFile.exists())
+      oldEventFile.remove();
   }
 
   auto prog = make_unique<Progress>(this, 0.0, 0.05, 1);
@@ -154,13 +170,23 @@ void SaveMD::doSaveEvents(typename MDEventWorkspace<MDE, nd>::sptr ws) {
       BoxFlatStruct.saveBoxStructure(filename);
     }
     Poco::File(bc->getFilename()).copyTo(filename);
+    // the events may be in an event file next to the NeXus file
+    Poco::File eventFile(BoxControllerMappedIO::eventFileName(filename));
+    if (BoxControllerMappedIO::hasEventFile(bc->getFilename()))
+      Poco::File(BoxControllerMappedIO::eventFileName(bc->getFilename()))
+          .copyTo(eventFile.path());
+    else if (eventFile.exists())
+      eventFile.remove();
   } else // not file backed;
   {
     // the boxes file positions are unknown and we need to calculate it.
     BoxFlatStruct.initFlatStructure(ws, filename);
     // create saver class
-    auto Saver = boost::shared_ptr<API::IBoxControllerIO>(
-        new DataObjects::BoxControllerNeXusIO(bc.get()));
+    boost::shared_ptr<API::IBoxControllerIO> Saver;
+    if (getPropertyValue("EventDataFormat") == "MemoryMapped")
+      Saver = boost::make_shared<DataObjects::BoxControllerMappedIO>(bc.get());
+    else
+      Saver = boost::make_shared<DataObjects::BoxControllerNeXusIO>(bc.get());
     Saver->setDataType(sizeof(coord_t), MDE::getTypeName());
     if (makeFileBackend) {
       // store saver with box controller
@@ -12,6 +12,7 @@
 #include "MantidDataObjects/MDBox.h"
 #include "MantidAPI/Progress.h"
 #include "MantidKernel/EnabledWhenProperty.h"
+#include "MantidKernel/ListValidator.h"
 #include <Poco/File.h>
 #include "MantidDataObjects/MDHistoWorkspace.h"
 #include "MantidDataObjects/MDBoxFlatTree.h"
@@ -64,6 +65,17 @@ void SaveMD2::init() {
   setPropertySettings(
       "MakeFileBacked",
       make_unique<EnabledWhenProperty>("UpdateFileBackEnd", IS_EQUAL_TO, "0"));
+
+  std::vector<std::string> eventFormats{"NeXus", "MemoryMapped"};
+  declareProperty(
+      "EventDataFormat", "NeXus",
+      boost::make_shared<StringListValidator>(eventFormats),
+      "For an MDEventWorkspace that was created in memory: where to save the "
+      "events.\n"
+      "NeXus: in the NeXus file.\n"
+      "MemoryMapped: in a flat file named after the NeXus file with .events "
+      "appended, which is memory-mapped when the events are loaded.\n"
+      "File-backed workspaces keep the format of their file.");
 }
 
 //----------------------------------------------------------------------------------------------
@@ -210,6 +222,8 @@ void SaveMD2::exec() {
                                 getProperty("UpdateFileBackEnd"));
     saveMDv1->setProperty<bool>("MakeFileBacked",
                                 getProperty("MakeFileBacked"));
+    saveMDv1->setPropertyValue("EventDataFormat",
+                               getPropertyValue("EventDataFormat"));
     saveMDv1->execute();
   } else if (histoWS) {
     this->doSaveHisto(histoWS);
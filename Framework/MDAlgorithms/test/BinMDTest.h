@@ -1032,6 +1032,54 @@ public:
     runBinMDOnFileBackWorkspace(outWSName);
   }
 
+  void test_filebackend_parallel_matches_in_memory() {
+    Mantid::Geometry::QSample frame;
+    IMDEventWorkspace_sptr in_ws =
+        MDEventsTestHelper::makeAnyMDEWWithFrames<MDLeanEvent<3>, 3>(
+            10, 0.0, 10.0, frame, 10);
+    auto filename = saveWorkspace(in_ws);
+    auto fileBackedName = loadFileBackWorkspace(filename);
+    auto fileBacked =
+        AnalysisDataService::Instance().retrieveWS<IMDEventWorkspace>(
+            fileBackedName);
+
+    auto expected = binAligned3D(in_ws, false);
+    auto binned = binAligned3D(fileBacked, true);
+    TS_ASSERT_EQUALS(binned->getNPoints(), expected->getNPoints());
+    for (size_t i = 0; i < expected->getNPoints(); ++i) {
+      TS_ASSERT_DELTA(binned->getSignalAt(i), expected->getSignalAt(i), 1e-5);
+      TS_ASSERT_DELTA(binned->getErrorAt(i), expected->getErrorAt(i), 1e-5);
+      TS_ASSERT_DELTA(binned->getNumEventsAt(i), expected->getNumEventsAt(i),
+                      1e-5);
+    }
+
+    AnalysisDataService::Instance().remove(fileBackedName);
+    fileBacked.reset();
+    if (Poco::File(filename).exists())
+      Poco::File(filename).remove();
+  }
+
+  IMDHistoWorkspace_sptr binAligned3D(IMDEventWorkspace_sptr ws,
+                                      bool parallel) {
+    BinMD alg;
+    alg.setChild(true);
+    alg.setRethrows(true);
+    alg.initialize();
+    TS_ASSERT_THROWS_NOTHING(alg.setProperty("InputWorkspace", ws));
+    TS_ASSERT_THROWS_NOTHING(
+        alg.setPropertyValue("AlignedDim0", "Axis0,1.5,8.5, 7"));
+    TS_ASSERT_THROWS_NOTHING(
+        alg.setPropertyValue("AlignedDim1", "Axis1,0.0,10.0, 4"));
+    TS_ASSERT_THROWS_NOTHING(
+        alg.setPropertyValue("AlignedDim2", "Axis2,0.0,10.0, 1"));
+    TS_ASSERT_THROWS_NOTHING(alg.setProperty("IterateEvents", true));
+    TS_ASSERT_THROWS_NOTHING(alg.setProperty("Parallel", parallel));
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("OutputWorkspace", "dummy"));
+    TS_ASSERT_THROWS_NOTHING(alg.execute();)
+    TS_ASSERT(alg.isExecuted());
+    return alg.getProperty("OutputWorkspace");
+  }
+
   void runBinMDOnFileBackWorkspace(const std::string &outWSName) {
     BinMD alg;
     alg.setChild(true);
@@ -101,6 +101,7 @@ public:
     TS_ASSERT_EQUALS(bc->getSplitInto(0), 5);
     TS_ASSERT_EQUALS(bc->getSplitThreshold(), 1000);
     TS_ASSERT_EQUALS(bc->getMaxDepth(), 5);
+    TS_ASSERT(!bc->useSpaceFillingCurve());
   }
 
   /** You can change the defaults given to the props */
@@ -155,6 +156,15 @@ public:
     TS_ASSERT_EQUALS(bc->getMaxDepth(), 34);
   }
 
+  void test_SpaceFillingCurveOrder() {
+    BoxControllerSettingsAlgorithmImpl alg;
+    alg.initBoxControllerProps();
+    alg.setProperty("SpaceFillingCurveOrder", true);
+    BoxController_sptr bc(new BoxController(3));
+    alg.setBoxController(bc);
+    TS_ASSERT(bc->useSpaceFillingCurve());
+  }
+
   void test_take_instrument_parameters() {
     const int splitInto = 4;
     const int splitThreshold = 16;
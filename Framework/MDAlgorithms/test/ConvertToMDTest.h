@@ -83,7 +83,7 @@ public:
     TS_ASSERT_THROWS_NOTHING(pAlg->initialize())
     TS_ASSERT(pAlg->isInitialized())
 
-    TSM_ASSERT_EQUALS("algorithm should have 25 properties", 25,
+    TSM_ASSERT_EQUALS("algorithm should have 26 properties", 26,
                       (size_t)(pAlg->getProperties().size()));
   }
 
@@ -530,7 +530,91 @@ public:
     }
   }
 
+  void test_execute_filebackend_with_events() {
+    // Arrange
+    std::string file_name = "convert_to_md_test_events_file.nxs";
+    if (Poco::File(file_name).exists())
+      Poco::File(file_name).remove();
+    {
+      Algorithm_sptr events_alg = AlgorithmManager::Instance().createUnmanaged(
+          "ConvertToEventWorkspace");
+      events_alg->initialize();
+      events_alg->setChild(true);
+      events_alg->setProperty("InputWorkspace", createTestWorkspaces());
+      events_alg->setPropertyValue("OutputWorkspace", "events");
+      events_alg->executeAsChildAlg();
+      Mantid::API::MatrixWorkspace_sptr test_workspace =
+          events_alg->getProperty("OutputWorkspace");
+
+      // Act
+      // The events are converted in parallel; with the file back-end the
+      // boxes are written out while the events are added and split.
+      auto out_ws = convertEventsToMD(test_workspace, "");
+      auto file_backed_ws = convertEventsToMD(test_workspace, file_name);
+
+      // Assert
+      TS_ASSERT(out_ws);
+      TS_ASSERT(file_backed_ws);
+      file_name = file_backed_ws->getBoxController()->getFilename();
+      TS_ASSERT(file_backed_ws->isFileBacked());
+      TS_ASSERT_EQUALS(file_backed_ws->getNEvents(), out_ws->getNEvents());
+
+      auto compare_alg =
+          Mantid::API::AlgorithmManager::Instance().createUnmanaged(
+              "CompareMDWorkspaces");
+      compare_alg->setChild(true);
+      compare_alg->initialize();
+      compare_alg->setProperty("Workspace1", out_ws);
+      compare_alg->setProperty("Workspace2", file_backed_ws);
+      compare_alg->setProperty("Tolerance", 0.00001);
+      compare_alg->setProperty("CheckEvents", true);
+      compare_alg->setProperty("IgnoreBoxID", true);
+      TS_ASSERT_THROWS_NOTHING(compare_alg->execute());
+      bool is_equal = compare_alg->getProperty("Equals");
+      TS_ASSERT(is_equal);
+    }
+
+    // Remove the file
+    if (Poco::File(file_name).exists()) {
+      Poco::File(file_name).remove();
+    }
+  }
+
 private:
+  Mantid::API::IMDEventWorkspace_sptr
+  convertEventsToMD(const Mantid::API::MatrixWorkspace_sptr &events,
+                    const std::string &file_name) {
+    Algorithm_sptr min_max_alg =
+        AlgorithmManager::Instance().createUnmanaged("ConvertToMDMinMaxGlobal");
+    min_max_alg->initialize();
+    min_max_alg->setChild(true);
+    min_max_alg->setProperty("InputWorkspace", events);
+    min_max_alg->setProperty("QDimensions", "Q3D");
+    min_max_alg->setProperty("dEAnalysisMode", "Direct");
+    min_max_alg->executeAsChildAlg();
+
+    Algorithm_sptr convert_alg =
+        AlgorithmManager::Instance().createUnmanaged("ConvertToMD");
+    convert_alg->initialize();
+    convert_alg->setChild(true);
+    convert_alg->setProperty("InputWorkspace", events);
+    convert_alg->setProperty("QDimensions", "Q3D");
+    convert_alg->setProperty("dEAnalysisMode", "Direct");
+    convert_alg->setPropertyValue("MinValues",
+                                  min_max_alg->getPropertyValue("MinValues"));
+    convert_alg->setPropertyValue("MaxValues",
+                                  min_max_alg->getPropertyValue("MaxValues"));
+    // Split often, so that many boxes are split and written out
+    convert_alg->setProperty("SplitThreshold", 50);
+    if (!file_name.empty()) {
+      convert_alg->setProperty("Filename", file_name);
+      convert_alg->setProperty("FileBackEnd", true);
+    }
+    convert_alg->setProperty("OutputWorkspace", "blank");
+    TS_ASSERT_THROWS_NOTHING(convert_alg->execute());
+    return convert_alg->getProperty("OutputWorkspace");
+  }
+
   void checkHistogramsHaveBeenStored(const std::string &wsName,
                                      double val = 0.34, double bin_min = 0.3,
                                      double bin_max = 0.4) {
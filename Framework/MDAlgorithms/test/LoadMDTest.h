@@ -12,6 +12,7 @@
 #include "MantidDataObjects/MDGridBox.h"
 #include "MantidDataObjects/MDEventFactory.h"
 #include "MantidDataObjects/MDEventWorkspace.h"
+#include "MantidDataObjects/BoxControllerMappedIO.h"
 #include "MantidDataObjects/BoxControllerNeXusIO.h"
 #include "MantidGeometry/MDGeometry/QSample.h"
 #include "MantidGeometry/MDGeometry/GeneralFrame.h"
@@ -170,7 +171,8 @@ public:
   //=================================================================================================================
   template <size_t nd>
   void do_test_exec(bool FileBackEnd, bool deleteWorkspace = true,
-                    double memory = 0, bool BoxStructureOnly = false) {
+                    double memory = 0, bool BoxStructureOnly = false,
+                    const std::string &eventDataFormat = "NeXus") {
     typedef MDLeanEvent<nd> MDE;
 
     //------ Start by creating the file
@@ -203,14 +205,18 @@ public:
         saver.setProperty("InputWorkspace", "LoadMDTest_ws"));
     TS_ASSERT_THROWS_NOTHING(saver.setPropertyValue(
         "Filename", "LoadMDTest" + Strings::toString(nd) + ".nxs"));
+    TS_ASSERT_THROWS_NOTHING(
+        saver.setPropertyValue("EventDataFormat", eventDataFormat));
 
     // Retrieve the full path; delete any pre-existing file
     std::string filename = saver.getPropertyValue("Filename");
     if (Poco::File(filename).exists())
       Poco::File(filename).remove();
+    Poco::File eventFile(BoxControllerMappedIO::eventFileName(filename));
 
     TS_ASSERT_THROWS_NOTHING(saver.execute(););
     TS_ASSERT(saver.isExecuted());
+    TS_ASSERT_EQUALS(eventFile.exists(), eventDataFormat == "MemoryMapped");
 
     //------ Now the loading -------------------------------------
     // Name of the output workspace.
@@ -270,6 +276,8 @@ public:
       AnalysisDataService::Instance().remove(outWSName);
       if (Poco::File(filename).exists())
         Poco::File(filename).remove();
+      if (eventFile.exists())
+        eventFile.remove();
     }
   }
 
@@ -401,6 +409,16 @@ public:
   /// Run the loading but keep the events on file and load on demand
   void test_exec_3D_with_FileBackEnd() { do_test_exec<3>(true); }
 
+  /// Save the events to a memory-mapped event file and load them to memory
+  void test_exec_3D_with_memory_mapped_events() {
+    do_test_exec<3>(false, true, 0, false, "MemoryMapped");
+  }
+
+  /// Keep the events in a memory-mapped event file and load on demand
+  void test_exec_3D_with_memory_mapped_events_and_FileBackEnd() {
+    do_test_exec<3>(true, true, 0, false, "MemoryMapped");
+  }
+
   /// Run the loading but keep the events on file and load on demand
   void test_exec_3D_with_FileBackEnd_andSmallBuffer() {
     do_test_exec<3>(true, true, 1.0);
@@ -18,7 +18,8 @@ class Communicator;
 namespace IO {
 
 /** Loader for event data from Nexus files with parallelism based on multiple
-  processes (MPI) for performance.
+  processes (MPI) for performance. Without MPI, the events can be parsed by
+  multiple threads of a single process.
 
   @author Simon Heybrock
   @date 2017
@@ -54,6 +55,11 @@ load(const Communicator &communicator, const std::string &filename,
      const std::string &groupName, const std::vector<std::string> &bankNames,
      const std::vector<int32_t> &bankOffsets,
      std::vector<std::vector<Types::Event::TofEvent> *> eventLists);
+MANTID_PARALLEL_DLL void
+load(const int numThreads, const std::string &filename,
+     const std::string &groupName, const std::vector<std::string> &bankNames,
+     const std::vector<int32_t> &bankOffsets,
+     std::vector<std::vector<Types::Event::TofEvent> *> eventLists);
 }
 
 } // namespace IO
@@ -112,6 +112,21 @@ void load(const Communicator &comm, const H5::Group &group,
   load<TimeOffsetType>(chunker, loader, consumer);
 }
 
+template <class TimeOffsetType>
+void load(const int numThreads, const H5::Group &group,
+          const std::vector<std::string> &bankNames,
+          const std::vector<int32_t> &bankOffsets,
+          std::vector<std::vector<Types::Event::TofEvent> *> eventLists) {
+  // Larger than for MPI, since the threads populating the event lists are
+  // started for every chunk.
+  const size_t chunkSize = 4 * 1024 * 1024;
+  // A single reader, the events of every chunk are spread over the threads.
+  const Chunker chunker(1, 0, readBankSizes(group, bankNames), chunkSize);
+  NXEventDataLoader<TimeOffsetType> loader(numThreads, group, bankNames);
+  EventParser<TimeOffsetType> consumer(numThreads, bankOffsets, eventLists);
+  load<TimeOffsetType>(chunker, loader, consumer);
+}
+
 /// Translate from H5::DataType to actual type, forward to load implementation.
 template <class... T> void load(const H5::DataType &type, T &&... args) {
   if (type == H5::PredType::NATIVE_INT32)
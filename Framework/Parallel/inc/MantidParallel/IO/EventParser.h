@@ -24,7 +24,8 @@ namespace IO {
 
 /** Distributed (MPI) parsing of Nexus events from a data stream. Data is
 distributed accross MPI ranks for writing to event lists on the correct target
-rank.
+rank. Without MPI, data can instead be distributed across threads that write to
+disjoint sets of event lists.
 
 @author Lamar Moore
 @date 2017
@@ -63,6 +64,8 @@ public:
               std::vector<std::vector<int>> rankGroups,
               std::vector<int32_t> bankOffsets,
               std::vector<std::vector<Types::Event::TofEvent> *> eventLists);
+  EventParser(const int numThreads, std::vector<int32_t> bankOffsets,
+              std::vector<std::vector<Types::Event::TofEvent> *> eventLists);
 
   void setEventDataPartitioner(std::unique_ptr<
       AbstractEventDataPartitioner<TimeOffsetType>> partitioner);
@@ -80,11 +83,14 @@ private:
                  const Chunker::LoadRange &range);
 
   void redistributeDataMPI();
-  void populateEventLists();
+  void populateEventLists(const std::vector<Event> &events, const int stride,
+                          const int offset);
+  void populateEventListsMultiThreaded();
 
   // Default to 0 such that failure to set unit is easily detected.
   double m_timeOffsetScale{0.0};
   Communicator m_comm;
+  int m_numThreads{1};
   std::vector<std::vector<int>> m_rankGroups;
   std::vector<int32_t> m_bankOffsets;
   std::vector<std::vector<Types::Event::TofEvent> *> m_eventLists;
@@ -116,6 +122,22 @@ EventParser<TimeOffsetType>::EventParser(
       m_bankOffsets(std::move(bankOffsets)),
       m_eventLists(std::move(eventLists)) {}
 
+/** Constructor for EventParser without MPI, using multiple threads.
+ *
+ * @param numThreads number of threads populating the event lists. Thread i
+ * writes to the event lists with global spectrum index % numThreads == i, so
+ * threads never write to the same event list. The EventDataPartitioner must
+ * be created for numThreads workers.
+ * @param bankOffsets used to convert from event ID to global spectrum index.
+ * @param eventLists workspace event lists for all global spectrum indices.
+ */
+template <class TimeOffsetType>
+EventParser<TimeOffsetType>::EventParser(
+    const int numThreads, std::vector<int32_t> bankOffsets,
+    std::vector<std::vector<TofEvent> *> eventLists)
+    : m_numThreads(numThreads), m_bankOffsets(std::move(bankOffsets)),
+      m_eventLists(std::move(eventLists)) {}
+
 /// Set the EventDataPartitioner to use for parsing subsequent events.
 template <class TimeOffsetType>
 void EventParser<TimeOffsetType>::setEventDataPartitioner(
@@ -199,22 +221,41 @@ void EventParser<TimeOffsetType>::redistributeDataMPI() {
   Parallel::wait_all(recv_requests.begin(), recv_requests.end());
 }
 
-/// Append events in m_thisRankData to m_eventLists.
+/** Append events to m_eventLists.
+ *
+ * @param events events with a partition-local spectrum index
+ * @param stride number of partitions
+ * @param offset partition the events belong to
+ */
 template <class TimeOffsetType>
-void EventParser<TimeOffsetType>::populateEventLists() {
-  for (const auto &event : m_thisRankData) {
-    m_eventLists[event.index]->emplace_back(
-        m_timeOffsetScale * static_cast<double>(event.tof), event.pulseTime);
+void EventParser<TimeOffsetType>::populateEventLists(
+    const std::vector<Event> &events, const int stride, const int offset) {
+  for (const auto &event : events) {
+    auto &eventList = *m_eventLists[stride * event.index + offset];
+    eventList.emplace_back(m_timeOffsetScale * static_cast<double>(event.tof),
+                           event.pulseTime);
     // In general `index` is random so this loop suffers from frequent cache
     // misses (probably because the hardware prefetchers cannot keep up with the
     // number of different memory locations that are getting accessed). We
     // manually prefetch into L2 cache to reduce the amount of misses.
-    _mm_prefetch(
-        reinterpret_cast<char *>(&m_eventLists[event.index]->back() + 1),
-        _MM_HINT_T1);
+    _mm_prefetch(reinterpret_cast<char *>(&eventList.back() + 1), _MM_HINT_T1);
   }
 }
 
+/// Append the events of every partition in m_allRankData to m_eventLists,
+/// using one thread per partition.
+template <class TimeOffsetType>
+void EventParser<TimeOffsetType>::populateEventListsMultiThreaded() {
+  std::vector<std::thread> threads;
+  for (int thread = 1; thread < m_numThreads; ++thread)
+    threads.emplace_back([this, thread] {
+      populateEventLists(m_allRankData[thread], m_numThreads, thread);
+    });
+  populateEventLists(m_allRankData[0], m_numThreads, 0);
+  for (auto &thread : threads)
+    thread.join();
+}
+
 /** Accepts raw data from file which has been pre-treated and sorted into chunks
  * for parsing. The parser extracts event data from the provided buffers,
  * separates then according to MPI ranks and then appends them to the workspace
@@ -250,8 +291,12 @@ void EventParser<TimeOffsetType>::doParsing(
   m_partitioner->partition(m_allRankData, event_id_start,
                            event_time_offset_start, range);
 
-  redistributeDataMPI();
-  populateEventLists();
+  if (m_numThreads > 1) {
+    populateEventListsMultiThreaded();
+  } else {
+    redistributeDataMPI();
+    populateEventLists(m_thisRankData, 1, 0);
+  }
 }
 
 template <class TimeOffsetType> void EventParser<TimeOffsetType>::wait() {
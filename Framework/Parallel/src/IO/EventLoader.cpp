@@ -44,6 +44,21 @@ void load(const Communicator &comm, const std::string &filename,
   load(readDataType(group, bankNames, "event_time_offset"), comm, group,
        bankNames, bankOffsets, std::move(eventLists));
 }
+
+/** Load events from given banks into event lists, without MPI. Reading is
+ * done by one thread while the events of the previous chunk are written to
+ * the event lists by numThreads threads, each one handling a disjoint set of
+ * event lists. */
+void load(const int numThreads, const std::string &filename,
+          const std::string &groupName,
+          const std::vector<std::string> &bankNames,
+          const std::vector<int32_t> &bankOffsets,
+          std::vector<std::vector<Types::Event::TofEvent> *> eventLists) {
+  H5::H5File file(filename, H5F_ACC_RDONLY);
+  H5::Group group = file.openGroup(groupName);
+  load(readDataType(group, bankNames, "event_time_offset"), numThreads, group,
+       bankNames, bankOffsets, std::move(eventLists));
+}
 }
 
 } // namespace IO
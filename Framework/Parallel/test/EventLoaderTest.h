@@ -84,27 +84,15 @@ private:
   size_t m_bank{0};
 };
 
-void do_test_load(const Parallel::Communicator &comm, const size_t chunkSize) {
-  const std::vector<size_t> bankSizes{111, 1111, 11111};
-  Chunker chunker(comm.size(), comm.rank(), bankSizes, chunkSize);
-  // FakeDataSource encodes information on bank and position in file into TOF
-  // and pulse times, such that we can verify correct mapping.
-  FakeDataSource dataSource(comm.size());
-  const std::vector<int32_t> bankOffsets{0, 12 * 77, 24 * 77};
-  std::vector<std::vector<Types::Event::TofEvent>> eventLists(
-      (3 * 77 + comm.size() - 1 - comm.rank()) / comm.size());
-  std::vector<std::vector<Types::Event::TofEvent> *> eventListPtrs;
-  for (auto &eventList : eventLists)
-    eventListPtrs.emplace_back(&eventList);
-
-  EventParser<int32_t> dataSink(comm, chunker.makeWorkerGroups(), bankOffsets,
-                                eventListPtrs);
-  TS_ASSERT_THROWS_NOTHING(
-      (EventLoader::load<int32_t>(chunker, dataSource, dataSink)));
+const std::vector<size_t> bankSizes{111, 1111, 11111};
+const std::vector<int32_t> bankOffsets{0, 12 * 77, 24 * 77};
 
+void check_event_lists(
+    const std::vector<std::vector<Types::Event::TofEvent>> &eventLists,
+    const int numRanks, const int rank) {
   for (size_t localSpectrumIndex = 0; localSpectrumIndex < eventLists.size();
        ++localSpectrumIndex) {
-    size_t globalSpectrumIndex = comm.size() * localSpectrumIndex + comm.rank();
+    size_t globalSpectrumIndex = numRanks * localSpectrumIndex + rank;
     size_t bank = globalSpectrumIndex / 77;
     size_t pixelInBank = globalSpectrumIndex % 77;
     TS_ASSERT_EQUALS(eventLists[localSpectrumIndex].size(),
@@ -144,6 +132,41 @@ void do_test_load(const Parallel::Communicator &comm, const size_t chunkSize) {
     }
   }
 }
+
+void do_test_load(const Parallel::Communicator &comm, const size_t chunkSize) {
+  Chunker chunker(comm.size(), comm.rank(), bankSizes, chunkSize);
+  // FakeDataSource encodes information on bank and position in file into TOF
+  // and pulse times, such that we can verify correct mapping.
+  FakeDataSource dataSource(comm.size());
+  std::vector<std::vector<Types::Event::TofEvent>> eventLists(
+      (3 * 77 + comm.size() - 1 - comm.rank()) / comm.size());
+  std::vector<std::vector<Types::Event::TofEvent> *> eventListPtrs;
+  for (auto &eventList : eventLists)
+    eventListPtrs.emplace_back(&eventList);
+
+  EventParser<int32_t> dataSink(comm, chunker.makeWorkerGroups(), bankOffsets,
+                                eventListPtrs);
+  TS_ASSERT_THROWS_NOTHING(
+      (EventLoader::load<int32_t>(chunker, dataSource, dataSink)));
+
+  check_event_lists(eventLists, comm.size(), comm.rank());
+}
+
+void do_test_load_multi_threaded(const int numThreads,
+                                 const size_t chunkSize) {
+  Chunker chunker(1, 0, bankSizes, chunkSize);
+  FakeDataSource dataSource(numThreads);
+  std::vector<std::vector<Types::Event::TofEvent>> eventLists(3 * 77);
+  std::vector<std::vector<Types::Event::TofEvent> *> eventListPtrs;
+  for (auto &eventList : eventLists)
+    eventListPtrs.emplace_back(&eventList);
+
+  EventParser<int32_t> dataSink(numThreads, bankOffsets, eventListPtrs);
+  TS_ASSERT_THROWS_NOTHING(
+      (EventLoader::load<int32_t>(chunker, dataSource, dataSink)));
+
+  check_event_lists(eventLists, 1, 0);
+}
 }
 
 class EventLoaderTest : public CxxTest::TestSuite {
@@ -193,6 +216,12 @@ public:
       }
     }
   }
+
+  void test_load_multi_threaded() {
+    for (const size_t chunkSize : {37, 123, 1111})
+      for (const auto threads : {1, 2, 3, 5, 7, 13})
+        do_test_load_multi_threaded(threads, chunkSize);
+  }
 };
 
 #endif /* MANTID_PARALLEL_EVENTLOADERTEST_H_ */
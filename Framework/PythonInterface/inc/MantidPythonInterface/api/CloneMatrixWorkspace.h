@@ -43,6 +43,12 @@ PyObject *cloneE(API::MatrixWorkspace &self);
 /// Create a numpy array from the E values of the given workspace reference
 PyObject *cloneDx(API::MatrixWorkspace &self);
 ///@}
+
+//** @name Read-only numpy views of data*/
+///{
+/// Create a read-only numpy array of the X values, copied only if needed
+PyObject *viewX(API::MatrixWorkspace &self);
+///@}
 }
 }
 
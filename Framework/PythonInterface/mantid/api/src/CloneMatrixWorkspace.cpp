@@ -3,7 +3,9 @@
 //-----------------------------------------------------------------------------
 #include "MantidPythonInterface/api/CloneMatrixWorkspace.h"
 #include "MantidAPI/MatrixWorkspace.h"
+#include "MantidKernel/cow_ptr.h"
 
+#include <boost/python/errors.hpp>
 #include <boost/python/extract.hpp>
 
 // See
@@ -64,6 +66,8 @@ PyArrayObject *cloneArray(MatrixWorkspace &workspace, DataField field,
                            2,         // rank 2
                            arrayDims, // Length in each dimension
                            nullptr, nullptr, 0, nullptr));
+  if (!nparray)
+    bpl::throw_error_already_set();
   double *dest = reinterpret_cast<double *>(
       PyArray_DATA(nparray)); // HEAD of the contiguous numpy data array
   for (size_t i = start; i < endp1; ++i) {
@@ -73,6 +77,116 @@ PyArrayObject *cloneArray(MatrixWorkspace &workspace, DataField field,
   }
   return nparray;
 }
+
+/// Name of the capsules holding the data shared with numpy arrays
+const char *SHARED_DATA_CAPSULE = "mantid.api.SharedHistogramData";
+
+/**
+ * Releases the reference to the data held by a capsule, when the numpy array
+ * viewing the data is deleted.
+ * @param capsule :: A capsule created by shareArray
+ */
+template <typename DataType> void releaseSharedData(PyObject *capsule) {
+  delete static_cast<Kernel::cow_ptr<DataType> *>(
+      PyCapsule_GetPointer(capsule, SHARED_DATA_CAPSULE));
+}
+
+/**
+ * Helper method for read-only views of workspace data in numpy.
+ * If every spectrum of the workspace refers to the same copy of the data,
+ * which is common for X values, return a read-only 2D array that views this
+ * data without copying it. The array keeps a reference to the data, so
+ * writing to the workspace afterwards copies the data of the spectrum being
+ * written to rather than changing the array.
+ * @param workspace :: A reference to the workspace that contains the data
+ * @param sharedData :: The method giving the shared data of a spectrum
+ * @return A new array, or nullptr if the spectra do not all share their data
+ * @throws boost::python::error_already_set if the array cannot be created
+ */
+template <typename DataType>
+PyArrayObject *
+shareArray(const MatrixWorkspace &workspace,
+           Kernel::cow_ptr<DataType> (MatrixWorkspace::*sharedData)(size_t)
+               const) {
+  const size_t numHist = workspace.getNumberHistograms();
+  if (numHist == 0)
+    return nullptr;
+  const auto data = (workspace.*sharedData)(0);
+  if (!data)
+    return nullptr;
+  for (size_t i = 1; i < numHist; ++i) {
+    if ((workspace.*sharedData)(i).get() != data.get())
+      return nullptr;
+  }
+
+  const auto &values = data->rawData();
+  npy_intp arrayDims[2] = {static_cast<npy_intp>(numHist),
+                           static_cast<npy_intp>(values.size())};
+  // Every row starts at the same place in memory
+  npy_intp arrayStrides[2] = {0, static_cast<npy_intp>(sizeof(double))};
+  PyArrayObject *nparray = reinterpret_cast<PyArrayObject *>(
+      PyArray_NewFromDescr(&PyArray_Type, PyArray_DescrFromType(NPY_DOUBLE),
+                           2, arrayDims, arrayStrides,
+                           const_cast<double *>(values.data()),
+                           0, // not writeable
+                           nullptr));
+  if (!nparray)
+    bpl::throw_error_already_set();
+  auto *reference = new Kernel::cow_ptr<DataType>(data);
+  PyObject *capsule = PyCapsule_New(reference, SHARED_DATA_CAPSULE,
+                                    &releaseSharedData<DataType>);
+  if (!capsule) {
+    delete reference;
+    Py_DECREF(nparray);
+    bpl::throw_error_already_set();
+  }
+#if NPY_API_VERSION >= 0x00000007 //(1.7)
+  // On failure the capsule is released, and with it the reference
+  if (PyArray_SetBaseObject(nparray, capsule) < 0) {
+    Py_DECREF(nparray);
+    bpl::throw_error_already_set();
+  }
+#else
+  nparray->base = capsule;
+#endif
+  return nparray;
+}
+
+/**
+ * Helper method for read-only numpy arrays of workspace data. The data are
+ * shared with the workspace if possible, see shareArray. Otherwise they are
+ * copied and a RuntimeWarning is issued, so that a copy is never made
+ * silently.
+ * @param workspace :: A reference to the workspace that contains the data
+ * @param field :: Which field should be extracted
+ * @param sharedData :: The method giving the shared data of a spectrum
+ */
+template <typename DataType>
+PyArrayObject *
+viewArray(MatrixWorkspace &workspace, DataField field,
+          Kernel::cow_ptr<DataType> (MatrixWorkspace::*sharedData)(size_t)
+              const) {
+  PyArrayObject *nparray = shareArray(workspace, sharedData);
+  if (!nparray) {
+    nparray =
+        cloneArray(workspace, field, 0, workspace.getNumberHistograms());
+#if NPY_API_VERSION >= 0x00000007 //(1.7)
+    PyArray_CLEARFLAGS(nparray, NPY_ARRAY_WRITEABLE);
+#else
+    nparray->flags &= ~NPY_WRITEABLE;
+#endif
+    const char *names[] = {"X", "Y", "E", "Dx"};
+    const std::string msg =
+        std::string("The spectra do not all share the same ") + names[field] +
+        " data, so a read-only copy of the data is returned instead of a view.";
+    // The warning may have been turned into an exception by a filter
+    if (PyErr_Warn(PyExc_RuntimeWarning, msg.c_str()) < 0) {
+      Py_DECREF(nparray);
+      bpl::throw_error_already_set();
+    }
+  }
+  return nparray;
+}
 }
 
 // -------------------------------------- Cloned
@@ -115,5 +229,19 @@ PyObject *cloneDx(MatrixWorkspace &self) {
   return reinterpret_cast<PyObject *>(
       cloneArray(self, DxValues, 0, self.getNumberHistograms()));
 }
+
+// -------------------------------------- Read-only views
+// ---------------------------------------------------
+/* Create a read-only numpy array of the X values of the given workspace
+ * reference, which shares the data of the workspace if all spectra have the
+ * same X values. Otherwise the values are copied with a RuntimeWarning.
+ * This acts like a python method on a Matrixworkspace object
+ * @param self :: A pointer to a PyObject representing the calling object
+ * @return A read-only 2D numpy array of the X values
+ */
+PyObject *viewX(MatrixWorkspace &self) {
+  return reinterpret_cast<PyObject *>(
+      viewArray(self, XValues, &MatrixWorkspace::sharedX));
+}
 }
 }
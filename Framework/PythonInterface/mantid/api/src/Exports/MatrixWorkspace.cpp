@@ -359,6 +359,12 @@ void export_MatrixWorkspace() {
            "Note: This can fail for large workspaces as numpy will require a "
            "block "
            "of memory free that will fit all of the data.")
+      .def("extractXView", Mantid::PythonInterface::viewX, args("self"),
+           "Returns the X data of the workspace as a read-only 2D numpy "
+           "array. If all spectra share the same X values, e.g. common "
+           "bins, the array refers to the data of the workspace rather than "
+           "copying it. Otherwise the data are copied and a RuntimeWarning "
+           "is issued.")
       //-------------------------------------- Operators
       //-----------------------------------
       .def("equals", &Mantid::API::equals, args("self", "other", "tolerance"),
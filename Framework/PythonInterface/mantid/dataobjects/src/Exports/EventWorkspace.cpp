@@ -3,9 +3,11 @@
 #include "MantidPythonInterface/kernel/Registry/RegisterWorkspacePtrToPython.h"
 
 #include <boost/python/class.hpp>
+#include <boost/python/enum.hpp>
 #include <boost/python/object/inheritance.hpp>
 
 using Mantid::API::IEventWorkspace;
+using Mantid::DataObjects::EventStorageType;
 using Mantid::DataObjects::EventWorkspace;
 using namespace Mantid::PythonInterface::Registry;
 using namespace boost::python;
@@ -13,8 +15,19 @@ using namespace boost::python;
 GET_POINTER_SPECIALIZATION(EventWorkspace)
 
 void export_EventWorkspace() {
+  enum_<EventStorageType>("EventStorageType")
+      .value("STRUCT_STORAGE", Mantid::DataObjects::STRUCT_STORAGE)
+      .value("COLUMN_STORAGE", Mantid::DataObjects::COLUMN_STORAGE)
+      .value("COMPRESSED_STORAGE", Mantid::DataObjects::COMPRESSED_STORAGE)
+      .export_values();
+
   class_<EventWorkspace, bases<IEventWorkspace>, boost::noncopyable>(
-      "EventWorkspace", no_init);
+      "EventWorkspace", no_init)
+      .def("setEventStorageType", &EventWorkspace::setEventStorageType,
+           args("self", "type"),
+           "Switch the events of all spectra to the given storage. "
+           "COMPRESSED_STORAGE reduces the memory held by workspaces that "
+           "are kept for a long time.");
 
   // register pointers
   RegisterWorkspacePtrToPython<EventWorkspace>();
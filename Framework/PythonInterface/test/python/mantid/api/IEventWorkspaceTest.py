@@ -39,6 +39,15 @@ class IEventWorkspaceTest(unittest.TestCase):
         self.assertTrue(isinstance(el, IEventList))
         self.assertEquals(el.getNumberEvents(), 200)
 
+    def test_compressed_event_storage_keeps_the_events(self):
+        from mantid.dataobjects import EventStorageType
+        ws = WorkspaceCreationHelper.createEventWorkspace2(self._npixels, self._nbins)
+        counts = list(ws.readY(0))
+        ws.setEventStorageType(EventStorageType.COMPRESSED_STORAGE)
+        self.assertEquals(ws.getNumberEvents(), 1000)
+        self.assertEquals(list(ws.readY(0)), counts)
+        self.assertAlmostEquals(ws.getSpectrum(0).getTofs()[0], 0.5)
+
     def test_event_list_getWeights(self):
         el = self._test_ws.getSpectrum(0)
         self.assertTrue(isinstance(el, IEventList))
@@ -3,6 +3,7 @@ from __future__ import (absolute_import, print_function)
 import unittest
 import sys
 import math
+import warnings
 from testhelpers import create_algorithm, run_algorithm, can_be_instantiated, WorkspaceCreationHelper
 from mantid.api import (MatrixWorkspace, MatrixWorkspaceProperty, WorkspaceProperty, Workspace,
                         ExperimentInfo, AnalysisDataService, WorkspaceFactory)
@@ -193,6 +194,42 @@ class MatrixWorkspaceTest(unittest.TestCase):
         self.assertTrue(len(dx), 0)
         self._do_numpy_comparison(self._test_ws, x, y, e)
 
+    def test_x_data_can_be_viewed_as_read_only_numpy_array(self):
+        with warnings.catch_warnings():
+            # X values that are not shared by all spectra are copied with a warning
+            warnings.simplefilter("ignore", RuntimeWarning)
+            x = self._test_ws.extractXView()
+
+        self.assertTrue(np.array_equal(x, self._test_ws.extractX()))
+        self.assertFalse(x.flags.writeable)
+
+    def test_view_of_shared_x_data_is_unchanged_by_writes_to_workspace(self):
+        nvectors, xlength, ylength = 3, 5, 4
+        test_ws = WorkspaceFactory.create("Workspace2D", nvectors, xlength, ylength)
+        # All spectra of a new workspace share their X values
+        with warnings.catch_warnings(record=True) as caught:
+            warnings.simplefilter("always")
+            x_view = test_ws.extractXView()
+        self.assertEquals(len(caught), 0)
+        self.assertEquals(x_view.shape, (nvectors, xlength))
+        self.assertFalse(x_view.flags.writeable)
+        x_before = test_ws.extractX()
+        self.assertTrue(np.array_equal(x_view, x_before))
+
+        values = np.arange(xlength, dtype=float) * 10.0
+        test_ws.setX(1, values)
+        self.assertTrue(np.array_equal(x_view, x_before))
+
+        # The spectra no longer share X, so the values are copied with a warning
+        with warnings.catch_warnings(record=True) as caught:
+            warnings.simplefilter("always")
+            x_after = test_ws.extractXView()
+        self.assertEquals(len(caught), 1)
+        self.assertTrue(issubclass(caught[0].category, RuntimeWarning))
+        self.assertFalse(x_after.flags.writeable)
+        self.assertTrue(np.array_equal(x_after, test_ws.extractX()))
+        self.assertTrue(np.array_equal(x_after[1], values))
+
     def _do_numpy_comparison(self, workspace, x_np, y_np, e_np, index = None):
         if index is None:
             nhist = workspace.getNumberHistograms()
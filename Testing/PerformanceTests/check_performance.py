@@ -72,7 +72,10 @@ def run(args):
         # this is the timing of the current revision
         current_time = t[r == rev]
         tolerance = tol
-        if current_time < timer_resolution_hi:
+        # Micro-benchmark times are means over runs of at least half a second,
+        # so they are not limited by the resolution of the clock
+        is_benchmark = name.startswith("Benchmarks.")
+        if current_time < timer_resolution_hi and not is_benchmark:
             # Increase the tolerance to avoid false positives
             if current_time < timer_resolution_lo:
                 # Very fast tests are twitchy